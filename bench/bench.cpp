@@ -0,0 +1,400 @@
+#include "bench/bench.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <numeric>
+
+namespace tz::bench
+{
+    namespace detail
+    {
+        double time_repetition_ns(const Body& body, std::size_t iterations)
+        {
+            auto begin = std::chrono::steady_clock::now();
+            body(iterations);
+            auto end = std::chrono::steady_clock::now();
+            return std::chrono::duration<double, std::nano>(end - begin).count();
+        }
+
+        std::size_t calibrate_iterations(const Body& body, double min_repetition_ms)
+        {
+            // Keep doubling until a repetition takes long enough to time reliably, then scale up to the target.
+            constexpr std::size_t max_iterations = std::size_t{1} << 32;
+            const double min_ns = min_repetition_ms * 1000000.0;
+            std::size_t iterations = 1;
+            while(iterations < max_iterations)
+            {
+                double elapsed_ns = time_repetition_ns(body, iterations);
+                if(elapsed_ns >= min_ns)
+                {
+                    break;
+                }
+                if(elapsed_ns > min_ns / 10.0)
+                {
+                    return std::max(iterations, static_cast<std::size_t>(std::ceil(iterations * (min_ns / elapsed_ns))));
+                }
+                iterations *= 2;
+            }
+            return iterations;
+        }
+
+        const char* get_build_type()
+        {
+            #if TZ_DEBUG
+                return "debug";
+            #else
+                return "release";
+            #endif
+        }
+
+        /**
+         * Reads the JSON that write_json writes. Unknown keys are skipped, so fields can be added later without breaking older baselines.
+         */
+        class JSONReader
+        {
+        public:
+            JSONReader(std::string text):
+            text(std::move(text)),
+            position(0)
+            {}
+
+            bool read_results(std::vector<Result>& results)
+            {
+                if(!this->expect('{'))
+                {
+                    return false;
+                }
+                do
+                {
+                    std::string key;
+                    if(!this->read_string(key) || !this->expect(':'))
+                    {
+                        return false;
+                    }
+                    if(key == "benchmarks")
+                    {
+                        if(!this->read_benchmarks(results))
+                        {
+                            return false;
+                        }
+                    }
+                    else if(!this->skip_value())
+                    {
+                        return false;
+                    }
+                }
+                while(this->accept(','));
+                return this->expect('}');
+            }
+        private:
+            bool read_benchmarks(std::vector<Result>& results)
+            {
+                if(!this->expect('['))
+                {
+                    return false;
+                }
+                if(this->accept(']'))
+                {
+                    return true;
+                }
+                do
+                {
+                    Result& result = results.emplace_back();
+                    if(!this->read_result(result))
+                    {
+                        return false;
+                    }
+                }
+                while(this->accept(','));
+                return this->expect(']');
+            }
+
+            bool read_result(Result& result)
+            {
+                if(!this->expect('{'))
+                {
+                    return false;
+                }
+                do
+                {
+                    std::string key;
+                    if(!this->read_string(key) || !this->expect(':'))
+                    {
+                        return false;
+                    }
+                    double number = 0.0;
+                    bool ok = true;
+                    if(key == "name")
+                    {
+                        ok = this->read_string(result.name);
+                    }
+                    else if(this->peek() == '"' || this->peek() == '{' || this->peek() == '[')
+                    {
+                        ok = this->skip_value();
+                    }
+                    else
+                    {
+                        ok = this->read_number(number);
+                    }
+                    if(!ok)
+                    {
+                        return false;
+                    }
+                    if(key == "iterations") result.iterations = static_cast<std::size_t>(number);
+                    else if(key == "repetitions") result.repetitions = static_cast<std::size_t>(number);
+                    else if(key == "mean_ns") result.mean_ns = number;
+                    else if(key == "median_ns") result.median_ns = number;
+                    else if(key == "min_ns") result.min_ns = number;
+                    else if(key == "max_ns") result.max_ns = number;
+                    else if(key == "p10_ns") result.p10_ns = number;
+                    else if(key == "p90_ns") result.p90_ns = number;
+                    else if(key == "p99_ns") result.p99_ns = number;
+                }
+                while(this->accept(','));
+                return this->expect('}');
+            }
+
+            bool read_string(std::string& str)
+            {
+                if(!this->expect('"'))
+                {
+                    return false;
+                }
+                str.clear();
+                while(this->position < this->text.size() && this->text[this->position] != '"')
+                {
+                    char c = this->text[this->position++];
+                    if(c == '\\' && this->position < this->text.size())
+                    {
+                        c = this->text[this->position++];
+                    }
+                    str.push_back(c);
+                }
+                return this->expect('"');
+            }
+
+            bool read_number(double& number)
+            {
+                this->skip_whitespace();
+                const char* begin = this->text.c_str() + this->position;
+                char* end = nullptr;
+                number = std::strtod(begin, &end);
+                if(end == begin)
+                {
+                    return false;
+                }
+                this->position += static_cast<std::size_t>(end - begin);
+                return true;
+            }
+
+            bool skip_value()
+            {
+                char c = this->peek();
+                if(c == '"')
+                {
+                    std::string ignored;
+                    return this->read_string(ignored);
+                }
+                if(c == '{' || c == '[')
+                {
+                    // Nested values are never written, but skip them properly anyway.
+                    std::size_t depth = 0;
+                    while(this->position < this->text.size())
+                    {
+                        c = this->text[this->position];
+                        if(c == '"')
+                        {
+                            std::string ignored;
+                            if(!this->read_string(ignored))
+                            {
+                                return false;
+                            }
+                            continue;
+                        }
+                        this->position++;
+                        if(c == '{' || c == '[')
+                        {
+                            depth++;
+                        }
+                        else if((c == '}' || c == ']') && --depth == 0)
+                        {
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+                // Numbers, true, false, null.
+                while(this->position < this->text.size() && std::strchr(",}] \t\r\n", this->text[this->position]) == nullptr)
+                {
+                    this->position++;
+                }
+                return true;
+            }
+
+            void skip_whitespace()
+            {
+                while(this->position < this->text.size() && std::strchr(" \t\r\n", this->text[this->position]) != nullptr)
+                {
+                    this->position++;
+                }
+            }
+
+            char peek()
+            {
+                this->skip_whitespace();
+                return this->position < this->text.size() ? this->text[this->position] : '\0';
+            }
+
+            bool accept(char c)
+            {
+                if(this->peek() == c)
+                {
+                    this->position++;
+                    return true;
+                }
+                return false;
+            }
+
+            bool expect(char c)
+            {
+                if(!this->accept(c))
+                {
+                    std::fprintf(stderr, "tzbench: Malformed JSON. Expected '%c' at offset %zu\n", c, this->position);
+                    return false;
+                }
+                return true;
+            }
+
+            std::string text;
+            std::size_t position;
+        };
+    }
+
+    void Suite::add(std::string name, Body body)
+    {
+        this->benchmarks.push_back({.name = std::move(name), .body = std::move(body)});
+    }
+
+    std::vector<Result> Suite::run(const Options& options) const
+    {
+        std::vector<Result> results;
+        #if TZ_DEBUG
+            std::printf("Warning: tzbench was built with TZ_DEBUG. topaz itself is unoptimised and has assertions enabled, so these numbers are not meaningful. Benchmark a release build instead.\n");
+        #endif
+        std::printf("%-48s %12s %12s %12s %12s %12s\n", "Benchmark", "Iterations", "Median(ns)", "P10(ns)", "P90(ns)", "P99(ns)");
+        for(const Benchmark& benchmark : this->benchmarks)
+        {
+            if(benchmark.name.find(options.filter) == std::string::npos)
+            {
+                continue;
+            }
+            std::size_t iterations = detail::calibrate_iterations(benchmark.body, options.min_repetition_ms);
+            for(std::size_t i = 0; i < options.warmup_repetitions; i++)
+            {
+                detail::time_repetition_ns(benchmark.body, iterations);
+            }
+            std::vector<double> samples;
+            samples.reserve(options.repetitions);
+            for(std::size_t i = 0; i < std::max(options.repetitions, std::size_t{1}); i++)
+            {
+                samples.push_back(detail::time_repetition_ns(benchmark.body, iterations) / static_cast<double>(iterations));
+            }
+            std::sort(samples.begin(), samples.end());
+            Result& result = results.emplace_back(Result
+            {
+                .name = benchmark.name,
+                .iterations = iterations,
+                .repetitions = samples.size(),
+                .mean_ns = std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(samples.size()),
+                .median_ns = percentile(samples, 50.0),
+                .min_ns = samples.front(),
+                .max_ns = samples.back(),
+                .p10_ns = percentile(samples, 10.0),
+                .p90_ns = percentile(samples, 90.0),
+                .p99_ns = percentile(samples, 99.0)
+            });
+            std::printf("%-48s %12zu %12.3f %12.3f %12.3f %12.3f\n", result.name.c_str(), result.iterations, result.median_ns, result.p10_ns, result.p90_ns, result.p99_ns);
+            std::fflush(stdout);
+        }
+        return results;
+    }
+
+    double percentile(const std::vector<double>& sorted_samples, double percent)
+    {
+        double rank = (percent / 100.0) * static_cast<double>(sorted_samples.size() - 1);
+        auto lower = static_cast<std::size_t>(std::floor(rank));
+        std::size_t upper = std::min(lower + 1, sorted_samples.size() - 1);
+        double fraction = rank - static_cast<double>(lower);
+        return sorted_samples[lower] + (sorted_samples[upper] - sorted_samples[lower]) * fraction;
+    }
+
+    bool write_json(const std::vector<Result>& results, const char* path)
+    {
+        std::FILE* file = std::fopen(path, "w");
+        if(file == nullptr)
+        {
+            return false;
+        }
+        std::fprintf(file, "{\n  \"build\": \"%s\",\n  \"benchmarks\": [", detail::get_build_type());
+        for(std::size_t i = 0; i < results.size(); i++)
+        {
+            const Result& result = results[i];
+            // Benchmark names are ours, and never contain anything that needs escaping.
+            std::fprintf(file, "%s\n    {\"name\": \"%s\", \"iterations\": %zu, \"repetitions\": %zu, \"mean_ns\": %.4f, \"median_ns\": %.4f, \"min_ns\": %.4f, \"max_ns\": %.4f, \"p10_ns\": %.4f, \"p90_ns\": %.4f, \"p99_ns\": %.4f}", i == 0 ? "" : ",", result.name.c_str(), result.iterations, result.repetitions, result.mean_ns, result.median_ns, result.min_ns, result.max_ns, result.p10_ns, result.p90_ns, result.p99_ns);
+        }
+        std::fputs("\n  ]\n}\n", file);
+        bool success = std::ferror(file) == 0;
+        return std::fclose(file) == 0 && success;
+    }
+
+    bool read_json(const char* path, std::vector<Result>& results)
+    {
+        std::FILE* file = std::fopen(path, "r");
+        if(file == nullptr)
+        {
+            std::fprintf(stderr, "tzbench: Could not open \"%s\"\n", path);
+            return false;
+        }
+        std::string text;
+        char buffer[4096];
+        for(std::size_t read = std::fread(buffer, 1, sizeof(buffer), file); read > 0; read = std::fread(buffer, 1, sizeof(buffer), file))
+        {
+            text.append(buffer, read);
+        }
+        std::fclose(file);
+        return detail::JSONReader{std::move(text)}.read_results(results);
+    }
+
+    std::size_t compare(const std::vector<Result>& baseline, const std::vector<Result>& candidate, double threshold_percent)
+    {
+        std::size_t regressions = 0;
+        std::printf("%-48s %14s %14s %9s\n", "Benchmark", "Baseline(ns)", "Candidate(ns)", "Change");
+        for(const Result& result : candidate)
+        {
+            auto base = std::find_if(baseline.begin(), baseline.end(), [&result](const Result& r){return r.name == result.name;});
+            if(base == baseline.end())
+            {
+                std::printf("%-48s %14s %14.3f %9s\n", result.name.c_str(), "-", result.median_ns, "new");
+                continue;
+            }
+            double change_percent = (result.median_ns - base->median_ns) / base->median_ns * 100.0;
+            bool regressed = change_percent > threshold_percent;
+            if(regressed)
+            {
+                regressions++;
+            }
+            std::printf("%-48s %14.3f %14.3f %+8.1f%%%s\n", result.name.c_str(), base->median_ns, result.median_ns, change_percent, regressed ? "  REGRESSION" : "");
+        }
+        for(const Result& base : baseline)
+        {
+            if(std::none_of(candidate.begin(), candidate.end(), [&base](const Result& r){return r.name == base.name;}))
+            {
+                std::printf("%-48s %14.3f %14s %9s\n", base.name.c_str(), base.median_ns, "-", "removed");
+            }
+        }
+        std::printf("%zu regression%s (threshold %.1f%%)\n", regressions, regressions == 1 ? "" : "s", threshold_percent);
+        return regressions;
+    }
+}
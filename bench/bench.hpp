@@ -0,0 +1,103 @@
+#ifndef TOPAZ_BENCH_BENCH_HPP
+#define TOPAZ_BENCH_BENCH_HPP
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace tz::bench
+{
+    /**
+     * @brief A benchmark body. It must perform the operation being measured exactly `iterations` times.
+     */
+    using Body = std::function<void(std::size_t iterations)>;
+
+    struct Options
+    {
+        /// Only run benchmarks whose name contains this.
+        std::string filter = "";
+        /// Repetitions run and thrown away before measuring, to warm caches and let clocks settle.
+        std::size_t warmup_repetitions = 3;
+        /// Measured repetitions. Statistics are taken across these.
+        std::size_t repetitions = 30;
+        /// Iterations per repetition are chosen so that a single repetition takes at least this long.
+        double min_repetition_ms = 5.0;
+    };
+
+    /**
+     * @brief Timing statistics for a single benchmark, in nanoseconds per iteration.
+     */
+    struct Result
+    {
+        std::string name;
+        std::size_t iterations;
+        std::size_t repetitions;
+        double mean_ns;
+        double median_ns;
+        double min_ns;
+        double max_ns;
+        double p10_ns;
+        double p90_ns;
+        double p99_ns;
+    };
+
+    class Suite
+    {
+    public:
+        Suite() = default;
+        /**
+         * @brief Register a benchmark. Names should be unique, as they're how runs are compared.
+         */
+        void add(std::string name, Body body);
+        /**
+         * @brief Run every registered benchmark matching the options' filter, printing results as each one finishes.
+         */
+        std::vector<Result> run(const Options& options) const;
+    private:
+        struct Benchmark
+        {
+            std::string name;
+            Body body;
+        };
+        std::vector<Benchmark> benchmarks;
+    };
+
+    /**
+     * @brief Retrieve the value at the given percentile (0-100) of some samples, interpolating between the nearest two.
+     * @pre samples is sorted in ascending order, and is not empty.
+     */
+    double percentile(const std::vector<double>& sorted_samples, double percent);
+
+    /**
+     * @brief Write results as JSON. @ref read_json can read it back in.
+     * @return True on success.
+     */
+    bool write_json(const std::vector<Result>& results, const char* path);
+    /**
+     * @brief Read results written by @ref write_json. Only understands the subset of JSON that write_json produces.
+     * @return True on success.
+     */
+    bool read_json(const char* path, std::vector<Result>& results);
+    /**
+     * @brief Print a table comparing the median of each benchmark in both runs.
+     * @param threshold_percent A benchmark whose median is slower than the baseline by more than this is considered a regression.
+     * @return Number of regressions found.
+     */
+    std::size_t compare(const std::vector<Result>& baseline, const std::vector<Result>& candidate, double threshold_percent);
+
+    /**
+     * @brief Stop the compiler from optimising away a value that's computed but never used.
+     */
+    template<typename T>
+    inline void do_not_optimise(const T& value)
+    {
+        #if defined(__GNUC__) || defined(__clang__)
+            asm volatile("" : : "r,m"(value) : "memory");
+        #else
+            static volatile const T* volatile sink;
+            sink = &value;
+        #endif
+    }
+}
+
+#endif // TOPAZ_BENCH_BENCH_HPP
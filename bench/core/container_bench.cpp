@@ -0,0 +1,78 @@
+#include "bench/bench.hpp"
+#include "core/containers/basic_list.hpp"
+#include "core/containers/enum_field.hpp"
+#include <array>
+
+namespace
+{
+    enum class BenchFlag
+    {
+        A, B, C, D, E, F, G, H
+    };
+}
+
+void container_benches(tz::bench::Suite& suite)
+{
+    suite.add("BasicList::add (64 ints)", [](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::BasicList<int> list;
+            for(int j = 0; j < 64; j++)
+            {
+                list.add(j);
+            }
+            tz::bench::do_not_optimise(list.length());
+        }
+    });
+    suite.add("BasicList::contains (64 ints)", [](std::size_t iterations)
+    {
+        tz::BasicList<int> list;
+        for(int j = 0; j < 64; j++)
+        {
+            list.add(j);
+        }
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            bool result = list.contains(static_cast<int>(i % 128));
+            tz::bench::do_not_optimise(result);
+        }
+    });
+    suite.add("BasicList iterate (1024 floats)", [](std::size_t iterations)
+    {
+        tz::BasicList<float> list;
+        for(std::size_t j = 0; j < 1024; j++)
+        {
+            list.add(static_cast<float>(j));
+        }
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            float sum = 0.0f;
+            for(float value : list)
+            {
+                sum += value;
+            }
+            tz::bench::do_not_optimise(sum);
+        }
+    });
+    suite.add("EnumField::contains", [](std::size_t iterations)
+    {
+        constexpr std::array<BenchFlag, 8> flags{BenchFlag::A, BenchFlag::B, BenchFlag::C, BenchFlag::D, BenchFlag::E, BenchFlag::F, BenchFlag::G, BenchFlag::H};
+        tz::EnumField<BenchFlag> field{BenchFlag::B, BenchFlag::D, BenchFlag::F, BenchFlag::H};
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            bool result = field.contains(flags[i % flags.size()]);
+            tz::bench::do_not_optimise(result);
+        }
+    });
+    suite.add("EnumField::contains(EnumField)", [](std::size_t iterations)
+    {
+        tz::EnumField<BenchFlag> field{BenchFlag::B, BenchFlag::D, BenchFlag::F, BenchFlag::H};
+        tz::EnumField<BenchFlag> subset{BenchFlag::D, BenchFlag::H};
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            bool result = field.contains(subset);
+            tz::bench::do_not_optimise(result);
+        }
+    });
+}
@@ -0,0 +1,259 @@
+#include "bench/bench.hpp"
+#include "core/matrix.hpp"
+#include "core/matrix_transform.hpp"
+#include "core/simd.hpp"
+#include <array>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // Cycling through a handful of inputs stops the compiler from hoisting the work out of the loop, while staying in cache.
+    constexpr std::size_t input_count = 64;
+
+    std::array<tz::Vec3, input_count> random_vec3s(std::mt19937& rng, float min, float max)
+    {
+        std::uniform_real_distribution<float> dist{min, max};
+        std::array<tz::Vec3, input_count> vecs;
+        for(tz::Vec3& vec : vecs)
+        {
+            vec = tz::Vec3{dist(rng), dist(rng), dist(rng)};
+        }
+        return vecs;
+    }
+
+    std::array<tz::Mat4, input_count> random_model_matrices(std::mt19937& rng)
+    {
+        std::array<tz::Vec3, input_count> positions = random_vec3s(rng, -100.0f, 100.0f);
+        std::array<tz::Vec3, input_count> rotations = random_vec3s(rng, -3.14f, 3.14f);
+        std::array<tz::Vec3, input_count> scales = random_vec3s(rng, 0.5f, 2.0f);
+        std::array<tz::Mat4, input_count> matrices;
+        for(std::size_t i = 0; i < input_count; i++)
+        {
+            matrices[i] = tz::model(positions[i], rotations[i], scales[i]);
+        }
+        return matrices;
+    }
+
+    std::array<tz::Mat4, input_count> random_rigid_matrices(std::mt19937& rng)
+    {
+        std::array<tz::Vec3, input_count> positions = random_vec3s(rng, -100.0f, 100.0f);
+        std::array<tz::Vec3, input_count> rotations = random_vec3s(rng, -3.14f, 3.14f);
+        std::array<tz::Mat4, input_count> matrices;
+        for(std::size_t i = 0; i < input_count; i++)
+        {
+            matrices[i] = tz::translate(positions[i]) * tz::rotate(rotations[i]);
+        }
+        return matrices;
+    }
+
+    std::array<tz::Mat4, input_count> random_matrices(std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> dist{-10.0f, 10.0f};
+        std::array<tz::Mat4, input_count> matrices;
+        for(tz::Mat4& matrix : matrices)
+        {
+            for(std::size_t i = 0; i < 4; i++)
+            {
+                for(std::size_t j = 0; j < 4; j++)
+                {
+                    matrix(i, j) = dist(rng);
+                }
+            }
+        }
+        return matrices;
+    }
+}
+
+void matrix_benches(tz::bench::Suite& suite)
+{
+    std::mt19937 rng{1234};
+    auto matrices = random_matrices(rng);
+    auto model_matrices = random_model_matrices(rng);
+    auto rigid_matrices = random_rigid_matrices(rng);
+    std::array<tz::Mat3, input_count> mat3s;
+    for(std::size_t i = 0; i < input_count; i++)
+    {
+        for(std::size_t j = 0; j < 3; j++)
+        {
+            for(std::size_t k = 0; k < 3; k++)
+            {
+                mat3s[i](j, k) = matrices[i](j, k);
+            }
+        }
+    }
+    auto positions = random_vec3s(rng, -100.0f, 100.0f);
+    auto rotations = random_vec3s(rng, -3.14f, 3.14f);
+    auto scales = random_vec3s(rng, 0.5f, 2.0f);
+    std::array<tz::Vec4, input_count> vec4s;
+    for(std::size_t i = 0; i < input_count; i++)
+    {
+        vec4s[i] = tz::Vec4{std::array<float, 4>{positions[i][0], positions[i][1], positions[i][2], 1.0f}};
+    }
+
+    suite.add("Mat4::operator*(Mat4)", [matrices](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::Mat4 result = matrices[i % input_count] * matrices[(i + 1) % input_count];
+            tz::bench::do_not_optimise(result);
+        }
+    });
+    suite.add("Mat4::operator*(Mat4) [scalar]", [matrices](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::Mat4 result;
+            tz::simd::scalar::mat4_multiply(&matrices[i % input_count](0, 0), &matrices[(i + 1) % input_count](0, 0), &result(0, 0));
+            tz::bench::do_not_optimise(result);
+        }
+    });
+    suite.add("Mat4::operator*(Vec4)", [matrices, vec4s](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::Vec4 result = matrices[i % input_count] * vec4s[(i + 1) % input_count];
+            tz::bench::do_not_optimise(result);
+        }
+    });
+    suite.add("Mat4::operator*(Vec4) [scalar]", [matrices, vec4s](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::Vec4 result;
+            tz::simd::scalar::mat4_columns_dot(&matrices[i % input_count](0, 0), vec4s[(i + 1) % input_count].data(), result.data());
+            tz::bench::do_not_optimise(result);
+        }
+    });
+    suite.add("Mat4::inverse", [matrices](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::Mat4 result = matrices[i % input_count].inverse();
+            tz::bench::do_not_optimise(result);
+        }
+    });
+    suite.add("Mat4::inverse (model)", [model_matrices](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::Mat4 result = model_matrices[i % input_count].inverse();
+            tz::bench::do_not_optimise(result);
+        }
+    });
+    suite.add("Mat4::inverse [scalar]", [matrices](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::Mat4 result;
+            tz::simd::scalar::mat4_inverse(&matrices[i % input_count](0, 0), &result(0, 0));
+            tz::bench::do_not_optimise(result);
+        }
+    });
+    suite.add("Mat4::inverse_affine (model)", [model_matrices](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::Mat4 result = model_matrices[i % input_count].inverse_affine();
+            tz::bench::do_not_optimise(result);
+        }
+    });
+    suite.add("Mat4::inverse_rigid (camera)", [rigid_matrices](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::Mat4 result = rigid_matrices[i % input_count].inverse_rigid();
+            tz::bench::do_not_optimise(result);
+        }
+    });
+    suite.add("Mat3::inverse", [mat3s](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::Mat3 result = mat3s[i % input_count].inverse();
+            tz::bench::do_not_optimise(result);
+        }
+    });
+    suite.add("Mat4::transpose", [matrices](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::Mat4 result = matrices[i % input_count].transpose();
+            tz::bench::do_not_optimise(result);
+        }
+    });
+    suite.add("tz::model", [positions, rotations, scales](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::Mat4 result = tz::model(positions[i % input_count], rotations[i % input_count], scales[i % input_count]);
+            tz::bench::do_not_optimise(result);
+        }
+    });
+    // Batches are big enough that tz::model_batch would split them across threads, if allowed.
+    constexpr std::size_t batch_size = 65536;
+    auto batch_positions = std::make_shared<std::vector<tz::Vec3>>();
+    auto batch_rotations = std::make_shared<std::vector<tz::Vec3>>();
+    auto batch_scales = std::make_shared<std::vector<tz::Vec3>>();
+    for(std::size_t i = 0; i < batch_size; i++)
+    {
+        batch_positions->push_back(positions[i % input_count]);
+        batch_rotations->push_back(rotations[i % input_count]);
+        batch_scales->push_back(scales[i % input_count]);
+    }
+    auto batch_models = std::make_shared<std::vector<tz::Mat4>>(batch_size);
+    suite.add("tz::model x65536", [batch_positions, batch_rotations, batch_scales, batch_models](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            for(std::size_t j = 0; j < batch_size; j++)
+            {
+                (*batch_models)[j] = tz::model((*batch_positions)[j], (*batch_rotations)[j], (*batch_scales)[j]);
+            }
+            tz::bench::do_not_optimise(batch_models->front());
+        }
+    });
+    suite.add("tz::model_batch x65536", [batch_positions, batch_rotations, batch_scales, batch_models](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::model_batch(*batch_positions, *batch_rotations, *batch_scales, *batch_models);
+            tz::bench::do_not_optimise(batch_models->front());
+        }
+    });
+    suite.add("tz::model_batch x65536 [scalar]", [batch_positions, batch_rotations, batch_scales, batch_models](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::simd::scalar::mat4_model_batch(batch_positions->front().data(), batch_rotations->front().data(), batch_scales->front().data(), &batch_models->front()(0, 0), batch_size);
+            tz::bench::do_not_optimise(batch_models->front());
+        }
+    });
+    suite.add("tz::model_batch x65536 (all threads)", [batch_positions, batch_rotations, batch_scales, batch_models](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::model_batch(*batch_positions, *batch_rotations, *batch_scales, *batch_models, std::thread::hardware_concurrency());
+            tz::bench::do_not_optimise(batch_models->front());
+        }
+    });
+    suite.add("tz::view", [positions, rotations](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::Mat4 result = tz::view(positions[i % input_count], rotations[i % input_count]);
+            tz::bench::do_not_optimise(result);
+        }
+    });
+    suite.add("tz::perspective", [scales](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            const tz::Vec3& params = scales[i % input_count];
+            tz::Mat4 result = tz::perspective(params[0], params[1], 0.1f, 100.0f * params[2]);
+            tz::bench::do_not_optimise(result);
+        }
+    });
+}
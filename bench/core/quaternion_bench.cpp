@@ -0,0 +1,107 @@
+#include "bench/bench.hpp"
+#include "core/matrix_transform.hpp"
+#include "core/quaternion.hpp"
+#include "core/simd.hpp"
+#include <array>
+#include <random>
+
+namespace
+{
+    constexpr std::size_t input_count = 64;
+
+    std::array<tz::Vec3, input_count> random_rotations(std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> dist{-3.14f, 3.14f};
+        std::array<tz::Vec3, input_count> rotations;
+        for(tz::Vec3& rotation : rotations)
+        {
+            rotation = tz::Vec3{dist(rng), dist(rng), dist(rng)};
+        }
+        return rotations;
+    }
+}
+
+void quaternion_benches(tz::bench::Suite& suite)
+{
+    std::mt19937 rng{9012};
+    auto rotations = random_rotations(rng);
+    std::array<tz::Quaternion, input_count> quaternions;
+    for(std::size_t i = 0; i < input_count; i++)
+    {
+        quaternions[i] = tz::Quaternion::from_euler(rotations[i]);
+    }
+
+    suite.add("Quaternion::operator*", [quaternions](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::Quaternion result = quaternions[i % input_count] * quaternions[(i + 1) % input_count];
+            tz::bench::do_not_optimise(result);
+        }
+    });
+    suite.add("Quaternion::operator* [scalar]", [quaternions](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::Quaternion result;
+            tz::simd::scalar::quat_multiply(quaternions[i % input_count].data(), quaternions[(i + 1) % input_count].data(), result.data());
+            tz::bench::do_not_optimise(result);
+        }
+    });
+    suite.add("Quaternion::from_euler", [rotations](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::Quaternion result = tz::Quaternion::from_euler(rotations[i % input_count]);
+            tz::bench::do_not_optimise(result);
+        }
+    });
+    suite.add("Quaternion::to_mat4", [quaternions](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::Mat4 result = quaternions[i % input_count].to_mat4();
+            tz::bench::do_not_optimise(result);
+        }
+    });
+    suite.add("tz::rotate", [rotations](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::Mat4 result = tz::rotate(rotations[i % input_count]);
+            tz::bench::do_not_optimise(result);
+        }
+    });
+    suite.add("tz::nlerp", [quaternions](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::Quaternion result = tz::nlerp(quaternions[i % input_count], quaternions[(i + 1) % input_count], 0.3f);
+            tz::bench::do_not_optimise(result);
+        }
+    });
+    suite.add("tz::slerp", [quaternions](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::Quaternion result = tz::slerp(quaternions[i % input_count], quaternions[(i + 1) % input_count], 0.3f);
+            tz::bench::do_not_optimise(result);
+        }
+    });
+    suite.add("tz::model (quaternion)", [quaternions](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::Mat4 result = tz::model({1.0f, 2.0f, 3.0f}, quaternions[i % input_count], {1.0f, 1.0f, 1.0f});
+            tz::bench::do_not_optimise(result);
+        }
+    });
+    suite.add("tz::view (quaternion)", [quaternions](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::Mat4 result = tz::view({1.0f, 2.0f, 3.0f}, quaternions[i % input_count]);
+            tz::bench::do_not_optimise(result);
+        }
+    });
+}
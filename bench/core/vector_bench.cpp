@@ -0,0 +1,109 @@
+#include "bench/bench.hpp"
+#include "core/simd.hpp"
+#include "core/vector.hpp"
+#include <array>
+#include <random>
+
+namespace
+{
+    constexpr std::size_t input_count = 64;
+
+    template<std::size_t S>
+    std::array<tz::Vector<float, S>, input_count> random_vectors(std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> dist{-100.0f, 100.0f};
+        std::array<tz::Vector<float, S>, input_count> vecs;
+        for(tz::Vector<float, S>& vec : vecs)
+        {
+            for(std::size_t i = 0; i < S; i++)
+            {
+                vec[i] = dist(rng);
+            }
+        }
+        return vecs;
+    }
+}
+
+void vector_benches(tz::bench::Suite& suite)
+{
+    std::mt19937 rng{5678};
+    auto vec3s = random_vectors<3>(rng);
+    auto vec4s = random_vectors<4>(rng);
+
+    suite.add("Vec3::normalise", [vec3s](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::Vec3 vec = vec3s[i % input_count];
+            vec.normalise();
+            tz::bench::do_not_optimise(vec);
+        }
+    });
+    suite.add("Vec4::normalise", [vec4s](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::Vec4 vec = vec4s[i % input_count];
+            vec.normalise();
+            tz::bench::do_not_optimise(vec);
+        }
+    });
+    suite.add("Vec4::normalise [scalar]", [vec4s](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::Vec4 vec = vec4s[i % input_count];
+            tz::simd::scalar::vec4_normalise(vec.data());
+            tz::bench::do_not_optimise(vec);
+        }
+    });
+    suite.add("Vec4::dot", [vec4s](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            float result = vec4s[i % input_count].dot(vec4s[(i + 1) % input_count]);
+            tz::bench::do_not_optimise(result);
+        }
+    });
+    suite.add("Vec4::dot [scalar]", [vec4s](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            float result = tz::simd::scalar::vec4_dot(vec4s[i % input_count].data(), vec4s[(i + 1) % input_count].data());
+            tz::bench::do_not_optimise(result);
+        }
+    });
+    suite.add("Vec4::length", [vec4s](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            float result = vec4s[i % input_count].length();
+            tz::bench::do_not_optimise(result);
+        }
+    });
+    suite.add("Vec4::length [scalar]", [vec4s](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            float result = tz::simd::scalar::vec4_length(vec4s[i % input_count].data());
+            tz::bench::do_not_optimise(result);
+        }
+    });
+    suite.add("tz::cross", [vec3s](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::Vec3 result = tz::cross(vec3s[i % input_count], vec3s[(i + 1) % input_count]);
+            tz::bench::do_not_optimise(result);
+        }
+    });
+    suite.add("tz::cross [scalar]", [vec3s](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            tz::Vec3 result;
+            tz::simd::scalar::vec3_cross(vec3s[i % input_count].data(), vec3s[(i + 1) % input_count].data(), result.data());
+            tz::bench::do_not_optimise(result);
+        }
+    });
+}
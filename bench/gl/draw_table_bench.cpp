@@ -0,0 +1,109 @@
+#include "bench/bench.hpp"
+#include "gl/input.hpp"
+#include "gl/impl/frontend/common/draw_table.hpp"
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t input_count = 16384;
+
+    tz::gl::Mesh make_mesh(std::size_t triangle_count)
+    {
+        tz::gl::Mesh mesh;
+        for(std::size_t i = 0; i < triangle_count; i++)
+        {
+            mesh.vertices.add(tz::gl::Vertex{{-0.5f, -0.5f, 0.0f}, {1.0f, 0.0f}, {}, {}, {}});
+            mesh.vertices.add(tz::gl::Vertex{{0.5f, -0.5f, 0.0f}, {0.0f, 0.0f}, {}, {}, {}});
+            mesh.vertices.add(tz::gl::Vertex{{0.5f, 0.5f, 0.0f}, {0.0f, 1.0f}, {}, {}, {}});
+            auto idx = static_cast<unsigned int>(i * 3);
+            mesh.indices.add(idx);
+            mesh.indices.add(idx + 1);
+            mesh.indices.add(idx + 2);
+        }
+        return mesh;
+    }
+
+    /**
+     * Half static, half dynamic inputs of varying size, and a draw list which touches every one of them in a scattered order.
+     */
+    struct DrawTableFixture
+    {
+        DrawTableFixture()
+        {
+            this->static_inputs.reserve(input_count / 2);
+            this->dynamic_inputs.reserve(input_count / 2);
+            for(std::size_t i = 0; i < input_count; i++)
+            {
+                if(i % 2 == 0)
+                {
+                    this->inputs.push_back(&this->static_inputs.emplace_back(make_mesh(1 + (i % 3))));
+                }
+                else
+                {
+                    this->inputs.push_back(&this->dynamic_inputs.emplace_back(make_mesh(1 + (i % 5))));
+                }
+                this->draws.add(tz::gl::RendererInputHandle{static_cast<tz::HandleValue>((i * 7919) % input_count)});
+            }
+            // Built once up-front, like the renderers do, so only gather itself is measured.
+            this->table.emplace(this->inputs);
+        }
+
+        std::vector<tz::gl::MeshInput> static_inputs;
+        std::vector<tz::gl::MeshDynamicInput> dynamic_inputs;
+        std::vector<const tz::gl::IRendererInput*> inputs;
+        tz::gl::RendererDrawList draws;
+        std::optional<tz::gl::RendererDrawTable> table;
+    };
+}
+
+void draw_table_benches(tz::bench::Suite& suite)
+{
+    auto fixture = std::make_shared<DrawTableFixture>();
+    suite.add("RendererDrawTable::gather (16384 handles)", [fixture](std::size_t iterations)
+    {
+        std::vector<tz::gl::DrawIndirectCommand> cmds(fixture->draws.length());
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            fixture->table->gather(fixture->draws, cmds);
+            tz::bench::do_not_optimise(cmds.data());
+        }
+    });
+    // What the renderers did before RendererDrawTable: rebuild an input->command map on every record.
+    suite.add("Draw list map rebuild (16384 handles)", [fixture](std::size_t iterations)
+    {
+        for(std::size_t i = 0; i < iterations; i++)
+        {
+            std::unordered_map<const tz::gl::IRendererInput*, tz::gl::DrawIndirectCommand> input_draws;
+            std::unordered_map<const tz::gl::IRendererInput*, tz::gl::DrawIndirectCommand> dynamic_input_draws;
+            std::int32_t static_vtx_count = 0, dynamic_vtx_count = 0;
+            std::uint32_t static_idx_count = 0, dynamic_idx_count = 0;
+            for(const tz::gl::IRendererInput* input : fixture->inputs)
+            {
+                bool is_static = input->data_access() == tz::gl::RendererInputDataAccess::StaticFixed;
+                std::int32_t& vtx_count = is_static ? static_vtx_count : dynamic_vtx_count;
+                std::uint32_t& idx_count = is_static ? static_idx_count : dynamic_idx_count;
+                (is_static ? input_draws : dynamic_input_draws)[input] = {.index_count = static_cast<std::uint32_t>(input->index_count()), .instance_count = 1, .first_index = idx_count, .vertex_offset = vtx_count, .first_instance = 0};
+                vtx_count += input->vertex_count();
+                idx_count += input->index_count();
+            }
+            std::vector<tz::gl::DrawIndirectCommand> cmds, cmds_dynamic;
+            for(tz::gl::RendererInputHandle handle : fixture->draws)
+            {
+                const tz::gl::IRendererInput* input = fixture->inputs[static_cast<std::size_t>(static_cast<tz::HandleValue>(handle))];
+                if(input->data_access() == tz::gl::RendererInputDataAccess::StaticFixed)
+                {
+                    cmds.push_back(input_draws[input]);
+                }
+                else
+                {
+                    cmds_dynamic.push_back(dynamic_input_draws[input]);
+                }
+            }
+            cmds.insert(cmds.end(), cmds_dynamic.begin(), cmds_dynamic.end());
+            tz::bench::do_not_optimise(cmds.data());
+        }
+    });
+}
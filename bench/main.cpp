@@ -0,0 +1,106 @@
+#include "bench/bench.hpp"
+#include "core/simd.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+void matrix_benches(tz::bench::Suite& suite);
+void vector_benches(tz::bench::Suite& suite);
+void quaternion_benches(tz::bench::Suite& suite);
+void container_benches(tz::bench::Suite& suite);
+void draw_table_benches(tz::bench::Suite& suite);
+
+namespace
+{
+    void print_usage()
+    {
+        std::printf("Usage:\n");
+        std::printf("  tzbench [--filter <substring>] [--warmup <n>] [--repetitions <n>] [--min-time-ms <ms>] [--json <path>]\n");
+        std::printf("  tzbench compare <baseline.json> <candidate.json> [--threshold <percent>]\n");
+        std::printf("compare exits with a non-zero status if any benchmark's median is slower than the baseline by more than the threshold (default 10%%).\n");
+    }
+
+    int run_compare(int argc, char** argv)
+    {
+        if(argc < 4)
+        {
+            print_usage();
+            return EXIT_FAILURE;
+        }
+        double threshold_percent = 10.0;
+        for(int i = 4; i < argc; i++)
+        {
+            if(std::strcmp(argv[i], "--threshold") == 0 && i + 1 < argc)
+            {
+                threshold_percent = std::atof(argv[++i]);
+            }
+            else
+            {
+                print_usage();
+                return EXIT_FAILURE;
+            }
+        }
+        std::vector<tz::bench::Result> baseline, candidate;
+        if(!tz::bench::read_json(argv[2], baseline) || !tz::bench::read_json(argv[3], candidate))
+        {
+            return EXIT_FAILURE;
+        }
+        return tz::bench::compare(baseline, candidate, threshold_percent) == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if(argc >= 2 && std::strcmp(argv[1], "compare") == 0)
+    {
+        return run_compare(argc, argv);
+    }
+
+    tz::bench::Options options;
+    const char* json_path = nullptr;
+    for(int i = 1; i < argc; i++)
+    {
+        bool has_value = i + 1 < argc;
+        if(std::strcmp(argv[i], "--filter") == 0 && has_value)
+        {
+            options.filter = argv[++i];
+        }
+        else if(std::strcmp(argv[i], "--warmup") == 0 && has_value)
+        {
+            options.warmup_repetitions = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else if(std::strcmp(argv[i], "--repetitions") == 0 && has_value)
+        {
+            options.repetitions = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else if(std::strcmp(argv[i], "--min-time-ms") == 0 && has_value)
+        {
+            options.min_repetition_ms = std::atof(argv[++i]);
+        }
+        else if(std::strcmp(argv[i], "--json") == 0 && has_value)
+        {
+            json_path = argv[++i];
+        }
+        else
+        {
+            print_usage();
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::printf("Mat4/Vec4 kernels: %s\n", tz::simd::get_instruction_set_name());
+    tz::bench::Suite suite;
+    matrix_benches(suite);
+    vector_benches(suite);
+    quaternion_benches(suite);
+    container_benches(suite);
+    draw_table_benches(suite);
+    std::vector<tz::bench::Result> results = suite.run(options);
+    if(json_path != nullptr && !tz::bench::write_json(results, json_path))
+    {
+        std::fprintf(stderr, "tzbench: Failed to write results to \"%s\"\n", json_path);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -2,6 +2,16 @@ function(configure_opengl target)
     target_compile_definitions(${target} PUBLIC -DTZ_VULKAN=0 -DTZ_OGL=1)
     
     target_link_libraries(${target} PUBLIC glad)
+
+    # Headless applications create their context via EGL. Without it, they fall back to a hidden window.
+    find_package(OpenGL COMPONENTS EGL)
+    if(OpenGL_EGL_FOUND)
+        target_compile_definitions(${target} PUBLIC -DTZ_OGL_EGL=1)
+        target_link_libraries(${target} PUBLIC OpenGL::EGL)
+    else()
+        message(STATUS "configure_opengl(${target}): EGL not found. Headless OpenGL applications will use a hidden window instead.")
+        target_compile_definitions(${target} PUBLIC -DTZ_OGL_EGL=0)
+    endif()
 endfunction()
 
 function(configure_vulkan target)
@@ -15,6 +25,7 @@ endfunction()
 
 function(configure_debug target)
     target_compile_definitions(${target} PUBLIC -DTZ_DEBUG=1)
+    target_compile_definitions(${target} PUBLIC -DTZ_PROFILE=1)
     if(CMAKE_CXX_COMPILER_ID STREQUAL "MSVC")
         target_compile_options(${target} PUBLIC /Zi)
     else()
@@ -24,5 +35,31 @@ endfunction()
 
 function(configure_release target)
     target_compile_definitions(${target} PUBLIC -DTZ_DEBUG=0)
+    # Profiling zones are compiled out of release builds unless explicitly asked for.
+    if(TOPAZ_PROFILE)
+        target_compile_definitions(${target} PUBLIC -DTZ_PROFILE=1)
+    else()
+        target_compile_definitions(${target} PUBLIC -DTZ_PROFILE=0)
+    endif()
     target_compile_options(${target} PRIVATE -O3)
-endfunction()
\ No newline at end of file
+endfunction()
+function(configure_simd target)
+    # Instruction set used by the Mat4/Vec4 kernels in tz::Matrix and tz::Vector. AUTO uses whatever the compiler is already targeting. Targets without SSE2 use SCALAR.
+    set(TOPAZ_SIMD "AUTO" CACHE STRING "Instruction set for Mat4/Vec4 math (AUTO, SCALAR, SSE2, AVX2)")
+    set_property(CACHE TOPAZ_SIMD PROPERTY STRINGS AUTO SCALAR SSE2 AVX2)
+    if(TOPAZ_SIMD STREQUAL "AUTO")
+        message(STATUS "configure_simd(${target}): Detecting instruction set from compiler target")
+    elseif(TOPAZ_SIMD MATCHES "^(SCALAR|SSE2|AVX2)$")
+        message(STATUS "configure_simd(${target}): ${TOPAZ_SIMD}")
+        target_compile_definitions(${target} PUBLIC -DTZ_SIMD=TZ_SIMD_${TOPAZ_SIMD})
+        if(TOPAZ_SIMD STREQUAL "AVX2")
+            if(CMAKE_CXX_COMPILER_ID STREQUAL "MSVC")
+                target_compile_options(${target} PUBLIC /arch:AVX2)
+            else()
+                target_compile_options(${target} PUBLIC -mavx2 -mfma)
+            endif()
+        endif()
+    else()
+        message(FATAL_ERROR "configure_simd(${target}): Unknown TOPAZ_SIMD \"${TOPAZ_SIMD}\". Expected AUTO, SCALAR, SSE2 or AVX2")
+    endif()
+endfunction()
@@ -0,0 +1,85 @@
+#if !TZ_VULKAN
+    static_assert(false, "Cannot build vk_frame_sync_bench with TZ_VULKAN disabled.");
+#endif
+
+#include "core/tz.hpp"
+#include "core/report.hpp"
+#include "gl/device.hpp"
+#include "gl/render_pass.hpp"
+#include "gl/renderer.hpp"
+#include "gl/input.hpp"
+#include "gl/shader.hpp"
+#include <algorithm>
+#include <chrono>
+
+// Renders the same headless scene with each vk::FrameAdmin sync mode and compares the CPU cost per frame.
+constexpr std::size_t warmup_frame_count = 64;
+constexpr std::size_t frame_count = 4096;
+
+struct FrameSyncResult
+{
+    float total_ms;
+    float worst_frame_ms;
+};
+
+FrameSyncResult run_frames(tz::gl::vk::FrameSyncMode sync_mode)
+{
+    tz::gl::DeviceBuilder device_builder;
+    device_builder.vk_set_frame_sync_mode(sync_mode);
+    tz::gl::Device device{device_builder};
+
+    tz::gl::RenderPassBuilder pass_builder;
+    pass_builder.add_pass(tz::gl::RenderPassAttachment::Colour);
+    tz::gl::RenderPass render_pass = device.create_render_pass(pass_builder);
+
+    tz::gl::ShaderBuilder shader_builder;
+    shader_builder.set_shader_file(tz::gl::ShaderType::VertexShader, ".\\demo\\gl\\triangle_demo.vertex.tzsl");
+    shader_builder.set_shader_file(tz::gl::ShaderType::FragmentShader, ".\\demo\\gl\\triangle_demo.fragment.tzsl");
+    tz::gl::Shader shader = device.create_shader(shader_builder);
+
+    tz::gl::Mesh mesh;
+    mesh.vertices =
+    {
+        tz::gl::Vertex{{-0.5f, -0.5f, 0.0f}, {1.0f, 0.0f}, {}, {}, {}},
+        tz::gl::Vertex{{0.5f, -0.5f, 0.0f}, {0.0f, 0.0f}, {}, {}, {}},
+        tz::gl::Vertex{{0.5f, 0.5f, 0.0f}, {0.0f, 1.0f}, {}, {}, {}}
+    };
+    mesh.indices = {0, 1, 2};
+    tz::gl::MeshInput mesh_input{mesh};
+
+    tz::gl::RendererBuilder renderer_builder;
+    renderer_builder.add_input(mesh_input);
+    renderer_builder.set_output(tz::window());
+    renderer_builder.set_render_pass(render_pass);
+    renderer_builder.set_shader(shader);
+    tz::gl::Renderer renderer = device.create_renderer(renderer_builder);
+
+    for(std::size_t i = 0; i < warmup_frame_count; i++)
+    {
+        renderer.render();
+    }
+
+    FrameSyncResult result{.total_ms = 0.0f, .worst_frame_ms = 0.0f};
+    for(std::size_t i = 0; i < frame_count; i++)
+    {
+        auto frame_begin = std::chrono::steady_clock::now();
+        renderer.render();
+        float frame_ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - frame_begin).count();
+        result.total_ms += frame_ms;
+        result.worst_frame_ms = std::max(result.worst_frame_ms, frame_ms);
+    }
+    return result;
+}
+
+int main()
+{
+    tz::initialise({"vk_frame_sync_bench", tz::Version{1, 0, 0}, tz::info()}, tz::ApplicationType::Headless);
+    {
+        FrameSyncResult fences = run_frames(tz::gl::vk::FrameSyncMode::Fences);
+        FrameSyncResult timeline = run_frames(tz::gl::vk::FrameSyncMode::TimelineSemaphore);
+        tz_report("Fences:             %zu frames in %.3fms (%.4fms/frame, worst %.4fms)", frame_count, fences.total_ms, fences.total_ms / frame_count, fences.worst_frame_ms);
+        tz_report("Timeline Semaphore: %zu frames in %.3fms (%.4fms/frame, worst %.4fms)", frame_count, timeline.total_ms, timeline.total_ms / frame_count, timeline.worst_frame_ms);
+    }
+    tz::terminate();
+    return 0;
+}
@@ -0,0 +1,96 @@
+#if !TZ_VULKAN
+    static_assert(false, "Cannot build vk_frames_in_flight_bench with TZ_VULKAN disabled.");
+#endif
+
+#include "core/tz.hpp"
+#include "core/report.hpp"
+#include "gl/device.hpp"
+#include "gl/render_pass.hpp"
+#include "gl/renderer.hpp"
+#include "gl/input.hpp"
+#include "gl/shader.hpp"
+#include <chrono>
+
+// Renders the same headless scene with increasing numbers of frames in flight, to show how much throughput is gained by letting the CPU run ahead of the GPU.
+// Present mode and swapchain image count only matter when there is a window, so they are not measured here.
+constexpr std::size_t warmup_frame_count = 64;
+constexpr std::size_t frame_count = 2048;
+constexpr std::size_t max_frames_in_flight = 4;
+// Enough triangles that the GPU has some real work to do each frame.
+constexpr std::size_t grid_size = 128;
+
+tz::gl::Mesh make_grid_mesh()
+{
+    tz::gl::Mesh mesh;
+    constexpr float cell = 2.0f / grid_size;
+    for(std::size_t y = 0; y < grid_size; y++)
+    {
+        for(std::size_t x = 0; x < grid_size; x++)
+        {
+            auto first = static_cast<unsigned int>(mesh.vertices.length());
+            mesh.vertices.add(tz::gl::Vertex{{-1.0f + cell * x, -1.0f + cell * y, 0.0f}, {0.0f, 0.0f}, {}, {}, {}});
+            mesh.vertices.add(tz::gl::Vertex{{-1.0f + cell * (x + 1), -1.0f + cell * y, 0.0f}, {1.0f, 0.0f}, {}, {}, {}});
+            mesh.vertices.add(tz::gl::Vertex{{-1.0f + cell * (x + 1), -1.0f + cell * (y + 1), 0.0f}, {1.0f, 1.0f}, {}, {}, {}});
+            mesh.indices.add(first);
+            mesh.indices.add(first + 1);
+            mesh.indices.add(first + 2);
+        }
+    }
+    return mesh;
+}
+
+float run_frames(std::size_t frames_in_flight, const tz::gl::Mesh& mesh)
+{
+    tz::gl::DeviceBuilder device_builder;
+    device_builder.set_frames_in_flight(frames_in_flight);
+    tz::gl::Device device{device_builder};
+
+    tz::gl::RenderPassBuilder pass_builder;
+    pass_builder.add_pass(tz::gl::RenderPassAttachment::Colour);
+    tz::gl::RenderPass render_pass = device.create_render_pass(pass_builder);
+
+    tz::gl::ShaderBuilder shader_builder;
+    shader_builder.set_shader_file(tz::gl::ShaderType::VertexShader, ".\\demo\\gl\\triangle_demo.vertex.tzsl");
+    shader_builder.set_shader_file(tz::gl::ShaderType::FragmentShader, ".\\demo\\gl\\triangle_demo.fragment.tzsl");
+    tz::gl::Shader shader = device.create_shader(shader_builder);
+
+    tz::gl::MeshInput mesh_input{mesh};
+
+    tz::gl::RendererBuilder renderer_builder;
+    renderer_builder.add_input(mesh_input);
+    renderer_builder.set_output(tz::window());
+    renderer_builder.set_render_pass(render_pass);
+    renderer_builder.set_shader(shader);
+    tz::gl::Renderer renderer = device.create_renderer(renderer_builder);
+
+    for(std::size_t i = 0; i < warmup_frame_count; i++)
+    {
+        renderer.render();
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < frame_count; i++)
+    {
+        renderer.render();
+    }
+    float total_ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    // If the GPU time per frame is close to the CPU time per frame, we're GPU bound.
+    tz::gl::RendererGPUTimings gpu_timings = renderer.get_gpu_timings();
+    tz_report("GPU (last %zu frames): Render pass %.4fms avg (%.4fms min, %.4fms max), draws %.4fms avg", gpu_timings.render_pass.sample_count, gpu_timings.render_pass.average_ms, gpu_timings.render_pass.min_ms, gpu_timings.render_pass.max_ms, gpu_timings.draws.average_ms);
+    return total_ms;
+}
+
+int main()
+{
+    tz::initialise({"vk_frames_in_flight_bench", tz::Version{1, 0, 0}, tz::info()}, tz::ApplicationType::Headless);
+    {
+        tz::gl::Mesh mesh = make_grid_mesh();
+        for(std::size_t frames_in_flight = 1; frames_in_flight <= max_frames_in_flight; frames_in_flight++)
+        {
+            float total_ms = run_frames(frames_in_flight, mesh);
+            tz_report("%zu frame%s in flight: %zu frames in %.3fms (%.4fms/frame, %.1f fps)", frames_in_flight, frames_in_flight == 1 ? " " : "s", frame_count, total_ms, total_ms / frame_count, frame_count * 1000.0f / total_ms);
+        }
+    }
+    tz::terminate();
+    return 0;
+}
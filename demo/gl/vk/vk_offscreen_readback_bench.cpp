@@ -0,0 +1,98 @@
+#if !TZ_VULKAN
+    static_assert(false, "Cannot build vk_offscreen_readback_bench with TZ_VULKAN disabled.");
+#endif
+
+#include "core/tz.hpp"
+#include "core/report.hpp"
+#include "gl/device.hpp"
+#include "gl/render_pass.hpp"
+#include "gl/renderer.hpp"
+#include "gl/input.hpp"
+#include "gl/shader.hpp"
+#include <chrono>
+#include <numeric>
+
+// Renders headless frames and reads every one of them back, as a batch offscreen renderer would. Frames are collected as they finish, so rendering never waits on the CPU reading a frame.
+constexpr std::size_t frame_count = 1024;
+constexpr std::size_t max_frames_in_flight = 4;
+
+struct ReadbackResult
+{
+    float total_ms;
+    std::size_t frames_read;
+    std::uint64_t checksum;
+};
+
+ReadbackResult run_frames(std::size_t frames_in_flight)
+{
+    tz::gl::DeviceBuilder device_builder;
+    device_builder.set_frames_in_flight(frames_in_flight);
+    tz::gl::Device device{device_builder};
+
+    tz::gl::RenderPassBuilder pass_builder;
+    pass_builder.add_pass(tz::gl::RenderPassAttachment::Colour);
+    tz::gl::RenderPass render_pass = device.create_render_pass(pass_builder);
+
+    tz::gl::ShaderBuilder shader_builder;
+    shader_builder.set_shader_file(tz::gl::ShaderType::VertexShader, ".\\demo\\gl\\triangle_demo.vertex.tzsl");
+    shader_builder.set_shader_file(tz::gl::ShaderType::FragmentShader, ".\\demo\\gl\\triangle_demo.fragment.tzsl");
+    tz::gl::Shader shader = device.create_shader(shader_builder);
+
+    tz::gl::Mesh mesh;
+    mesh.vertices =
+    {
+        tz::gl::Vertex{{-0.5f, -0.5f, 0.0f}, {1.0f, 0.0f}, {}, {}, {}},
+        tz::gl::Vertex{{0.5f, -0.5f, 0.0f}, {0.0f, 0.0f}, {}, {}, {}},
+        tz::gl::Vertex{{0.5f, 0.5f, 0.0f}, {0.0f, 1.0f}, {}, {}, {}}
+    };
+    mesh.indices = {0, 1, 2};
+    tz::gl::MeshInput mesh_input{mesh};
+
+    tz::gl::RendererBuilder renderer_builder;
+    renderer_builder.add_input(mesh_input);
+    renderer_builder.set_output(tz::window());
+    renderer_builder.set_render_pass(render_pass);
+    renderer_builder.set_shader(shader);
+    tz::gl::Renderer renderer = device.create_renderer(renderer_builder);
+
+    ReadbackResult result{.total_ms = 0.0f, .frames_read = 0, .checksum = 0};
+    auto read_frame = [&result](const tz::gl::RendererOffscreenFrame& frame)
+    {
+        result.checksum = std::accumulate(frame.pixels.begin(), frame.pixels.end(), result.checksum, [](std::uint64_t sum, std::byte b){return sum + static_cast<std::uint64_t>(b);});
+        result.frames_read++;
+    };
+
+    auto begin = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < frame_count; i++)
+    {
+        renderer.render();
+        // Collect whatever has finished. The slot we're about to render into next must be read before then, so wait for it once the ring is full.
+        bool ring_full = i + 1 >= frames_in_flight;
+        while(std::optional<tz::gl::RendererOffscreenFrame> frame = renderer.vk_take_offscreen_frame(ring_full))
+        {
+            read_frame(frame.value());
+            ring_full = false;
+        }
+    }
+    // Drain the frames still in flight.
+    while(std::optional<tz::gl::RendererOffscreenFrame> frame = renderer.vk_take_offscreen_frame(true))
+    {
+        read_frame(frame.value());
+    }
+    result.total_ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    return result;
+}
+
+int main()
+{
+    tz::initialise({"vk_offscreen_readback_bench", tz::Version{1, 0, 0}, tz::info()}, tz::ApplicationType::Headless);
+    {
+        for(std::size_t frames_in_flight = 1; frames_in_flight <= max_frames_in_flight; frames_in_flight++)
+        {
+            ReadbackResult result = run_frames(frames_in_flight);
+            tz_report("%zu frame%s in flight: Read back %zu/%zu frames in %.3fms (%.1f fps, checksum %llu)", frames_in_flight, frames_in_flight == 1 ? " " : "s", result.frames_read, frame_count, result.total_ms, result.frames_read * 1000.0f / result.total_ms, static_cast<unsigned long long>(result.checksum));
+        }
+    }
+    tz::terminate();
+    return 0;
+}
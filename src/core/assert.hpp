@@ -1,8 +1,10 @@
 #ifndef TOPAZ_CORE_ASSERT_HPP
 #define TOPAZ_CORE_ASSERT_HPP
 #include "debugbreak.h"
+#include "core/report.hpp"
 #include <cstdio>
 #include <cstdlib>
+#include <type_traits>
 #include <utility>
 
 namespace tz
@@ -11,6 +13,8 @@ namespace tz
     void error_internal(const char* fmt, Args&&... args)
     {
         #if TZ_DEBUG
+            // Make sure everything reported up to this point appears before the error.
+            tz::report_flush();
             std::fflush(stderr);
             std::fprintf(stderr, fmt, std::forward<Args>(args)...);
             std::fflush(stderr);
@@ -18,12 +22,28 @@ namespace tz
         #endif
     }
 
+    namespace detail
+    {
+        // Deliberately not constexpr. See assert_internal.
+        inline void assert_failed_during_constant_evaluation(){}
+    }
+
     template<typename... Args>
-    void assert_internal(bool eval, const char* fmt, Args&&... args)
+    constexpr void assert_internal(bool eval, const char* fmt, Args&&... args)
     {
+        if(std::is_constant_evaluated())
+        {
+            // Calling a non-constexpr function is not a constant expression, so failing a tz_assert at compile-time is a compile error.
+            if(!eval)
+            {
+                detail::assert_failed_during_constant_evaluation();
+            }
+            return;
+        }
         #if TZ_DEBUG
             if(!eval)
             {
+                tz::report_flush();
                 std::fflush(stderr);
                 std::fprintf(stderr, fmt, std::forward<Args>(args)...);
                 std::fflush(stderr);
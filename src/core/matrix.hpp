@@ -29,7 +29,7 @@ namespace tz
 		 * Initialise a matrix from a multi-dimensional array.
 		 * @param data An array of array of values to construct the row-major matrix.
 		 */
-		Matrix(std::array<std::array<T, R>, C> data);
+		constexpr Matrix(std::array<std::array<T, R>, C> data);
 		/**
 		 * Retrieve the identity matrix.
 		 * 
@@ -61,14 +61,14 @@ namespace tz
 		 * @param row_idx The index of the row to retrieve. For example, row_idx 0 will retrieve the top row.
 		 * @return Array of values representing the given row.
 		 */
-		const Row& operator[](std::size_t row_idx) const;
+		constexpr const Row& operator[](std::size_t row_idx) const;
 		/**
 		 * Retrieve the i'th row of the matrix.
 		 * Precondition: row_idx < R. Otherwise, this will assert and invoke UB.
 		 * @param row_idx The index of the row to retrieve. For example, row_idx 0 will retrieve the top row.
 		 * @return Array of values representing the given row.
 		 */
-		Row& operator[](std::size_t row_idx);
+		constexpr Row& operator[](std::size_t row_idx);
 		/**
 		 * Retrieve the element at the given row and column of the matrix.
 		 * Precondition: row < R && column < C. Otherwise, this will assert and invoke UB.
@@ -76,7 +76,7 @@ namespace tz
 		 * @param column The index of the column. For example, column 0 will retrieve an element in the left-most row.
 		 * @return The value at the given coordinate formed by [row, column]. For example, mymatrix(0, 0) will retrieve the very first element of the matrix.
 		 */
-		const T& operator()(std::size_t row, std::size_t column) const;
+		constexpr const T& operator()(std::size_t row, std::size_t column) const;
 		/**
 		 * Retrieve the element at the given row and column of the matrix.
 		 * Precondition: row < R && column < C. Otherwise, this will assert and invoke UB.
@@ -84,112 +84,125 @@ namespace tz
 		 * @param column The index of the column. For example, column 0 will retrieve an element in the left-most row.
 		 * @return The value at the given coordinate formed by [row, column]. For example, mymatrix(0, 0) will retrieve the very first element of the matrix.
 		 */
-		T& operator()(std::size_t row, std::size_t column);
+		constexpr T& operator()(std::size_t row, std::size_t column);
 		/**
 		 * Add the scalar value to each element of the current matrix.
 		 * @param scalar Value to add to each element.
 		 * @return Reference to the current matrix.
 		 */
-		Matrix<T, R, C>& operator+=(T scalar);
+		constexpr Matrix<T, R, C>& operator+=(T scalar);
 		/**
 		 * Add the given matrix to the current matrix. This is done by adding the current value in the same row and column.
 		 * @param matrix Matrix to add to the current matrix.
 		 * @return Reference to the current matrix.
 		 */
-		Matrix<T, R, C>& operator+=(const Matrix<T, R, C>& matrix);
+		constexpr Matrix<T, R, C>& operator+=(const Matrix<T, R, C>& matrix);
 		/**
 		 * Add the scalar value to each element of the current matrix.
 		 * @param scalar Value to add to each element.
 		 * @return A modified copy of the original matrix. The original matrix is unchanged.
 		 */
-		Matrix<T, R, C> operator+(T scalar) const;
+		constexpr Matrix<T, R, C> operator+(T scalar) const;
 		/**
 		 * Add the given matrix to the current matrix. This is done by adding the current value in the same row and column.
 		 * @param matrix Matrix to add to the current matrix.
 		 * @return A modified copy of the original matrix. The original matrix is unchanged.
 		 */
-		Matrix<T, R, C> operator+(const Matrix<T, R, C>& matrix) const;
+		constexpr Matrix<T, R, C> operator+(const Matrix<T, R, C>& matrix) const;
 		/**
 		 * Subtract the scalar value from each element of the current matrix.
 		 * @param scalar Value to subtract from each element.
 		 * @return Reference to the current matrix.
 		 */
-		Matrix<T, R, C>& operator-=(T scalar);
+		constexpr Matrix<T, R, C>& operator-=(T scalar);
 		/**
 		 * Subtract the given matrix from the current matrix. This is done by subtracting the current value in the same row and column.
 		 * @param matrix Matrix to subtract from the current matrix.
 		 * @return Reference to the current matrix.
 		 */
-		Matrix<T, R, C>& operator-=(const Matrix<T, R, C>& matrix);
+		constexpr Matrix<T, R, C>& operator-=(const Matrix<T, R, C>& matrix);
 		/**
 		 * Subtract the scalar value from each element of the current matrix.
 		 * @param scalar Value to subtract from each element.
 		 * @return A modified copy of the original matrix. The original matrix is unchanged.
 		 */
-		Matrix<T, R, C> operator-(T scalar) const;
+		constexpr Matrix<T, R, C> operator-(T scalar) const;
 		/**
 		 * Subtract the given matrix from the current matrix. This is done by subtracting the current value in the same row and column.
 		 * @param matrix Matrix to subtract from the current matrix.
 		 * @return A modified copy of the original matrix. The original matrix is unchanged.
 		 */
-		Matrix<T, R, C> operator-(const Matrix<T, R, C>& matrix) const;
+		constexpr Matrix<T, R, C> operator-(const Matrix<T, R, C>& matrix) const;
 		/**
 		 * Multiply the scalar value with each element of the current matrix.
 		 * @param scalar Value to multiply with each element.
 		 * @return Reference to the current matrix.
 		 */
-		Matrix<T, R, C>& operator*=(T scalar);
+		constexpr Matrix<T, R, C>& operator*=(T scalar);
 		/**
 		 * Multiply the given matrix with the current matrix. This is done naively and is unsuitable for very large values of R or C.
 		 * @param matrix Matrix to multiply with the current matrix.
 		 * @return Reference to the current matrix.
 		 */
-		Matrix<T, R, C>& operator*=(const Matrix<T, R, C>& matrix);
+		constexpr Matrix<T, R, C>& operator*=(const Matrix<T, R, C>& matrix);
 		/**
 		 * Multiply the scalar value with each element of the current matrix.
 		 * @param scalar Value to multiply with each element.
 		 * @return A modified copy of the original matrix. The original matrix is unchanged.
 		 */
-		Matrix<T, R, C> operator*(T scalar) const;
+		constexpr Matrix<T, R, C> operator*(T scalar) const;
 		/**
 		 * Multiply the given matrix with the current matrix. This is done naively and is unsuitable for very large values of R or C.
 		 * @param matrix Matrix to multiply with the current matrix.
 		 * @return A modified copy of the original matrix. The original matrix is unchanged.
 		 */
-		Matrix<T, R, C> operator*(const Matrix<T, R, C>& matrix) const;
+		constexpr Matrix<T, R, C> operator*(const Matrix<T, R, C>& matrix) const;
 		/**
 		 * Multiply the given vector (column-matrix) with the current matrix and return the resultant vector (row-matrix).
 		 * @param vec Column matrix to multiply with the current matrix.
 		 * @return A row-matrix representing the resultant multiplication.
 		 */
-		Vector<T, R> operator*(const Vector<T, C>& vec) const;
+		constexpr Vector<T, R> operator*(const Vector<T, C>& vec) const;
 		/**
 		 * Equate the given scalar with each value of the matrix.
 		 * `mymatrix == T{5}` shall return if-and-only-if each element of mymatrix is equal to 'T{5}'. If no such comparison exists, then the program is ill-formed.
 		 * @param scalar Value to equate with each value of the current matrix.
 		 * @return True if each value of the current matrix is equal to scalar. Otherwise, false.
 		 */
-		bool operator==(T scalar) const;
+		constexpr bool operator==(T scalar) const;
 		/**
 		 * Equate the given matrix with the current. Matrices are equal if-and-only-if each element at a given row and column of the current matrix is equal to the corresponding value of the given matrix.
 		 * @param matrix Matrix to equate with the current matrix.
 		 * @return True if each value in the given matrix are equal to that of the current matrix. Otherwise, false.
 		 */
-		bool operator==(const Matrix<T, R, C>& matrix) const;
+		constexpr bool operator==(const Matrix<T, R, C>& matrix) const;
 		/**
 		 * Retrieves a new matrix such that the resultant matrix could be multiplied by the original matrix to result in the identity matrix (See Matrix<T, R, C>::identity()).
 		 * 
-		 * If the current matrix is orthogonal, it is an optimisation to prefer the use of Matrix<T, R, C>::transpose() instead.
+		 * Mat4 uses a SIMD kernel (See tz::simd). Other square matrices use Gauss-Jordan elimination. If the matrix is a transform, prefer Matrix<T, R, C>::inverse_affine() or Matrix<T, R, C>::inverse_rigid(), which are much cheaper.
+		 * Precondition: The matrix is square and its determinant is non-zero. Otherwise, this will assert and the result is unspecified.
 		 * @return Inverse of the original matrix. The original matrix is unchanged.
 		 */
-		Matrix<T, R, C> inverse() const;
+		constexpr Matrix<T, R, C> inverse() const;
+		/**
+		 * Retrieves the inverse of an affine 4x4 matrix, such as a model matrix (translation, rotation and scale).
+		 * Precondition: The bottom row is (0, 0, 0, 1) and the upper-left 3x3 has a non-zero determinant. Otherwise, this will assert and the result is unspecified.
+		 * @return Inverse of the original matrix. The original matrix is unchanged.
+		 */
+		constexpr Matrix<T, R, C> inverse_affine() const requires(R == 4 && C == 4);
+		/**
+		 * Retrieves the inverse of a rigid 4x4 matrix, i.e one that only rotates and translates, such as a camera transform. This is cheaper still than Matrix<T, R, C>::inverse_affine().
+		 * Precondition: The matrix is affine and its upper-left 3x3 is orthonormal. Otherwise, this will assert (orthonormality is only checked in debug) and the result is unspecified.
+		 * @return Inverse of the original matrix. The original matrix is unchanged.
+		 */
+		constexpr Matrix<T, R, C> inverse_rigid() const requires(R == 4 && C == 4);
 		//template<std::size_t X = R, std::size_t Y = C, typename std::enable_if_t<std::conditional_t<X == Y>>>
 		/**
 		 * Create a copy of the current matrix, and transpose the copy. Transposing the matrix is to flip the matrix values over its diagonal.
 		 * Note: If `mymatrix` is orthogonal, then `mymatrix.transpose() == mymatrix.inverse()`.
 		 * @return Transpose of the original matrix. The original matrix is unchanged.
 		 */
-		Matrix<T, R, C> transpose() const;
+		constexpr Matrix<T, R, C> transpose() const;
 		#if TZ_DEBUG
 		/**
 		 * Pretty-print each value of the given matrix. If T is not printable, then the program is ill-formed.
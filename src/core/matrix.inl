@@ -1,4 +1,9 @@
 #include "core/assert.hpp"
+#include "core/simd.hpp"
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <utility>
 #if TOPAZ_DEBUG
 #include <cstdio>
 #endif
@@ -6,24 +11,24 @@
 namespace tz
 {
 	template<tz::Number T, std::size_t R, std::size_t C>
-	Matrix<T, R, C>::Matrix(std::array<std::array<T, R>, C> data): mat(data){}
+	constexpr Matrix<T, R, C>::Matrix(std::array<std::array<T, R>, C> data): mat(data){}
 
 	template<tz::Number T, std::size_t R, std::size_t C>
-	const typename Matrix<T, R, C>::Row& Matrix<T, R, C>::operator[](std::size_t row_idx) const
+	constexpr const typename Matrix<T, R, C>::Row& Matrix<T, R, C>::operator[](std::size_t row_idx) const
 	{
 		tz_assert(row_idx < R, "tz::Matrix<T, %zu, %zu>::operator[%zu]: Index out of range!", R, C, row_idx);
 		return this->mat[row_idx];
 	}
 
 	template<tz::Number T, std::size_t R, std::size_t C>
-	typename Matrix<T, R, C>::Row& Matrix<T, R, C>::operator[](std::size_t row_idx)
+	constexpr typename Matrix<T, R, C>::Row& Matrix<T, R, C>::operator[](std::size_t row_idx)
 	{
 		tz_assert(row_idx < R, "tz::Matrix<T, %zu, %zu>::operator[%zu]: Index out of range!", R, C, row_idx);
 		return this->mat[row_idx];
 	}
 
 	template<tz::Number T, std::size_t R, std::size_t C>
-	const T& Matrix<T, R, C>::operator()(std::size_t row, std::size_t column) const
+	constexpr const T& Matrix<T, R, C>::operator()(std::size_t row, std::size_t column) const
 	{
 		tz_assert(row < R, "tz::Matrix<T, %zu, %zu>::operator(%zu, %zu): Row index out of range!", R, C, row, column);
 		tz_assert(column < R, "tz::Matrix<T, %zu, %zu>::operator(%zu, %zu): Column index out of range!", R, C, row, column);
@@ -31,7 +36,7 @@ namespace tz
 	}
 
 	template<tz::Number T, std::size_t R, std::size_t C>
-	T& Matrix<T, R, C>::operator()(std::size_t row, std::size_t column)
+	constexpr T& Matrix<T, R, C>::operator()(std::size_t row, std::size_t column)
 	{
 		tz_assert(row < R, "tz::Matrix<T, %zu, %zu>::operator(%zu, %zu): Row index out of range!", R, C, row, column);
 		tz_assert(column < R, "tz::Matrix<T, %zu, %zu>::operator(%zu, %zu): Column index out of range!", R, C, row, column);
@@ -39,7 +44,7 @@ namespace tz
 	}
 
 	template<tz::Number T, std::size_t R, std::size_t C>
-	Matrix<T, R, C>& Matrix<T, R, C>::operator+=(T scalar)
+	constexpr Matrix<T, R, C>& Matrix<T, R, C>::operator+=(T scalar)
 	{
 		for(std::size_t i = 0; i < R; i++)
 		{
@@ -52,7 +57,7 @@ namespace tz
 	}
 
 	template<tz::Number T, std::size_t R, std::size_t C>
-	Matrix<T, R, C>& Matrix<T, R, C>::operator+=(const Matrix<T, R, C>& matrix)
+	constexpr Matrix<T, R, C>& Matrix<T, R, C>::operator+=(const Matrix<T, R, C>& matrix)
 	{
 		for(std::size_t i = 0; i < R; i++)
 		{
@@ -65,23 +70,23 @@ namespace tz
 	}
 
 	template<tz::Number T, std::size_t R, std::size_t C>
-	Matrix<T, R, C> Matrix<T, R, C>::operator+(T scalar) const
+	constexpr Matrix<T, R, C> Matrix<T, R, C>::operator+(T scalar) const
 	{
 		Matrix<T, R, C> copy = *this;
 		copy += scalar;
-		return std::move(copy);
+		return copy;
 	}
 
 	template<tz::Number T, std::size_t R, std::size_t C>
-	Matrix<T, R, C> Matrix<T, R, C>::operator+(const Matrix<T, R, C>& matrix) const
+	constexpr Matrix<T, R, C> Matrix<T, R, C>::operator+(const Matrix<T, R, C>& matrix) const
 	{
 		Matrix<T, R, C> copy = *this;
 		copy += matrix;
-		return std::move(copy);
+		return copy;
 	}
 
 	template<tz::Number T, std::size_t R, std::size_t C>
-	Matrix<T, R, C>& Matrix<T, R, C>::operator-=(T scalar)
+	constexpr Matrix<T, R, C>& Matrix<T, R, C>::operator-=(T scalar)
 	{
 		for(std::size_t i = 0; i < R; i++)
 		{
@@ -94,7 +99,7 @@ namespace tz
 	}
 
 	template<tz::Number T, std::size_t R, std::size_t C>
-	Matrix<T, R, C>& Matrix<T, R, C>::operator-=(const Matrix<T, R, C>& matrix)
+	constexpr Matrix<T, R, C>& Matrix<T, R, C>::operator-=(const Matrix<T, R, C>& matrix)
 	{
 		for(std::size_t i = 0; i < R; i++)
 		{
@@ -107,23 +112,23 @@ namespace tz
 	}
 
 	template<tz::Number T, std::size_t R, std::size_t C>
-	Matrix<T, R, C> Matrix<T, R, C>::operator-(T scalar) const
+	constexpr Matrix<T, R, C> Matrix<T, R, C>::operator-(T scalar) const
 	{
 		Matrix<T, R, C> copy = *this;
 		copy -= scalar;
-		return std::move(copy);
+		return copy;
 	}
 
 	template<tz::Number T, std::size_t R, std::size_t C>
-	Matrix<T, R, C> Matrix<T, R, C>::operator-(const Matrix<T, R, C>& matrix) const
+	constexpr Matrix<T, R, C> Matrix<T, R, C>::operator-(const Matrix<T, R, C>& matrix) const
 	{
 		Matrix<T, R, C> copy = *this;
 		copy -= matrix;
-		return std::move(copy);
+		return copy;
 	}
 
 	template<tz::Number T, std::size_t R, std::size_t C>
-	Matrix<T, R, C>& Matrix<T, R, C>::operator*=(T scalar)
+	constexpr Matrix<T, R, C>& Matrix<T, R, C>::operator*=(T scalar)
 	{
 		for(std::size_t i = 0; i < R; i++)
 		{
@@ -136,8 +141,18 @@ namespace tz
 	}
 
 	template<tz::Number T, std::size_t R, std::size_t C>
-	Matrix<T, R, C>& Matrix<T, R, C>::operator*=(const Matrix<T, R, C>& matrix)
+	constexpr Matrix<T, R, C>& Matrix<T, R, C>::operator*=(const Matrix<T, R, C>& matrix)
 	{
+		if constexpr(std::is_same_v<T, float> && R == 4 && C == 4)
+		{
+			// Mat4 is used for every transform, so it gets a SIMD kernel. The kernel handles matrix aliasing *this.
+			static_assert(sizeof(this->mat) == sizeof(float) * 16, "tz::Mat4 must be tightly packed for SIMD");
+			if(!std::is_constant_evaluated())
+			{
+				simd::mat4_multiply(this->mat.front().data(), matrix.mat.front().data(), this->mat.front().data());
+				return *this;
+			}
+		}
 		Matrix<T, R, C> m = *this;
 		for(std::size_t i = 0; i < R; i++)
 		{
@@ -155,7 +170,7 @@ namespace tz
 	}
 
 	template<tz::Number T, std::size_t R, std::size_t C>
-	Matrix<T, R, C> Matrix<T, R, C>::operator*(T scalar) const
+	constexpr Matrix<T, R, C> Matrix<T, R, C>::operator*(T scalar) const
 	{
 		Matrix<T, R, C> copy = *this;
 		copy *= scalar;
@@ -163,7 +178,7 @@ namespace tz
 	}
 
 	template<tz::Number T, std::size_t R, std::size_t C>
-	Matrix<T, R, C> Matrix<T, R, C>::operator*(const Matrix<T, R, C>& matrix) const
+	constexpr Matrix<T, R, C> Matrix<T, R, C>::operator*(const Matrix<T, R, C>& matrix) const
 	{
 		Matrix<T, R, C> copy = *this;
 		copy *= matrix;
@@ -171,18 +186,26 @@ namespace tz
 	}
 
 	template<tz::Number T, std::size_t R, std::size_t C>
-	Vector<T, R> Matrix<T, R, C>::operator*(const Vector<T, C>& vec) const
+	constexpr Vector<T, R> Matrix<T, R, C>::operator*(const Vector<T, C>& vec) const
 	{
 		Vector<T, R> ret;
+		if constexpr(std::is_same_v<T, float> && R == 4 && C == 4)
+		{
+			if(!std::is_constant_evaluated())
+			{
+				simd::mat4_columns_dot(this->mat.front().data(), vec.data(), ret.data());
+				return ret;
+			}
+		}
 		for(std::size_t i = 0; i < R; i++)
 		{
-			ret[i] = tz::Vec4{(*this)[i]}.dot(vec);
+			ret[i] = Vector<T, R>{(*this)[i]}.dot(vec);
 		}
 		return ret;
 	}
 
 	template<tz::Number T, std::size_t R, std::size_t C>
-	bool Matrix<T, R, C>::operator==(T scalar) const
+	constexpr bool Matrix<T, R, C>::operator==(T scalar) const
 	{
 		for(std::size_t i = 0; i < R; i++)
 		{
@@ -196,7 +219,7 @@ namespace tz
 	}
 
 	template<tz::Number T, std::size_t R, std::size_t C>
-	bool Matrix<T, R, C>::operator==(const Matrix<T, R, C>& matrix) const
+	constexpr bool Matrix<T, R, C>::operator==(const Matrix<T, R, C>& matrix) const
 	{
 		for(std::size_t i = 0; i < R; i++)
 		{
@@ -210,166 +233,150 @@ namespace tz
 	}
 
 	template<tz::Number T, std::size_t R, std::size_t C>
-	Matrix<T, R, C> Matrix<T, R, C>::inverse() const
+	constexpr Matrix<T, R, C> Matrix<T, R, C>::inverse() const
 	{
-		// Create copy of the current matrix to work with.
-		Matrix<T, R, C> mat = Matrix<T, R, C>::identity();
-		// TODO: Replace with Jacobi's Method.
-		
-		// Column-major
-		auto at = [](Matrix<T, R, C>& m, std::size_t idx)->T&
+		static_assert(R == C, "tz::Matrix<T, R, C>::inverse(): Only square matrices have an inverse.");
+		if constexpr(std::is_same_v<T, float> && R == 4 && C == 4)
 		{
-			// 5 ==> (1, 1)
-			// row_id = 5 / 4 == 1
-			// column_id = (1*4)
-			std::size_t row_id = idx / C;
-			std::size_t column_id = idx - (row_id*C);
-			return m(row_id, column_id);
-		};
-
-		auto cat = [](const Matrix<T, R, C>& m, std::size_t idx)->const T&
+			if(!std::is_constant_evaluated())
+			{
+				// The kernel leaves inv untouched if there is no inverse. Start from NaN so that release builds, where tz_assert does nothing, still get a defined (and obviously invalid) result.
+				Matrix<T, R, C> inv;
+				for(Row& column : inv.mat)
+				{
+					column.fill(std::numeric_limits<float>::quiet_NaN());
+				}
+				float determinant = simd::mat4_inverse(this->mat.front().data(), inv.mat.front().data());
+				tz_assert(determinant != 0.0f, "tz::Matrix<T, %zu, %zu>::inverse(): Cannot get inverse because determinant is zero.", R, C);
+				return inv;
+			}
+		}
+		// Gauss-Jordan elimination with partial pivoting. The size is known at compile-time, so everything stays on the stack.
+		Matrix<T, R, C> m = *this;
+		Matrix<T, R, C> inv = Matrix<T, R, C>::identity();
+		for(std::size_t column = 0; column < C; column++)
 		{
-			// 5 ==> (1, 1)
-			// row_id = 5 / 4 == 1
-			// column_id = (1*4)
-			std::size_t row_id = idx / C;
-			std::size_t column_id = idx - (row_id*C);
-			return m(row_id, column_id);
-		};
-
-		at(mat, 0) = cat(*this, 5) * cat(*this, 10) * cat(*this, 15) -
-				cat(*this, 5) * cat(*this, 11) * cat(*this, 14) -
-				cat(*this, 9) * cat(*this, 6)  * cat(*this, 15) +
-				cat(*this, 9) * cat(*this, 7)  * cat(*this, 14) + 
-				cat(*this, 13) * cat(*this, 6) * cat(*this, 11) - 
-				cat(*this, 13) * cat(*this, 7) * cat(*this, 10);
-
-		at(mat, 4) = -cat(*this, 4)  * cat(*this, 10) * cat(*this, 15) + 
-				cat(*this, 4)  * cat(*this, 11) * cat(*this, 14) + 
-				cat(*this, 8)  * cat(*this, 6)  * cat(*this, 15) - 
-				cat(*this, 8)  * cat(*this, 7)  * cat(*this, 14) - 
-				cat(*this, 12) * cat(*this, 6)  * cat(*this, 11) + 
-				cat(*this, 12) * cat(*this, 7)  * cat(*this, 10);
-
-		at(mat, 8) = cat(*this, 4)  * cat(*this, 9) * cat(*this, 15) - 
-				cat(*this, 4)  * cat(*this, 11) * cat(*this, 13) - 
-				cat(*this, 8)  * cat(*this, 5) * cat(*this, 15) + 
-				cat(*this, 8)  * cat(*this, 7) * cat(*this, 13) + 
-				cat(*this, 12) * cat(*this, 5) * cat(*this, 11) - 
-				cat(*this, 12) * cat(*this, 7) * cat(*this, 9);
-
-		at(mat, 12) = -cat(*this, 4)  * cat(*this, 9) * cat(*this, 14) + 
-				cat(*this, 4)  * cat(*this, 10) * cat(*this, 13) +
-				cat(*this, 8)  * cat(*this, 5) * cat(*this, 14) - 
-				cat(*this, 8)  * cat(*this, 6) * cat(*this, 13) - 
-				cat(*this, 12) * cat(*this, 5) * cat(*this, 10) + 
-				cat(*this, 12) * cat(*this, 6) * cat(*this, 9);
-
-		at(mat, 1) = -cat(*this, 1)  * cat(*this, 10) * cat(*this, 15) + 
-				cat(*this, 1)  * cat(*this, 11) * cat(*this, 14) + 
-				cat(*this, 9)  * cat(*this, 2) * cat(*this, 15) - 
-				cat(*this, 9)  * cat(*this, 3) * cat(*this, 14) - 
-				cat(*this, 13) * cat(*this, 2) * cat(*this, 11) + 
-				cat(*this, 13) * cat(*this, 3) * cat(*this, 10);
-
-		at(mat, 5) = cat(*this, 0)  * cat(*this, 10) * cat(*this, 15) - 
-				cat(*this, 0)  * cat(*this, 11) * cat(*this, 14) - 
-				cat(*this, 8)  * cat(*this, 2) * cat(*this, 15) + 
-				cat(*this, 8)  * cat(*this, 3) * cat(*this, 14) + 
-				cat(*this, 12) * cat(*this, 2) * cat(*this, 11) - 
-				cat(*this, 12) * cat(*this, 3) * cat(*this, 10);
-
-		at(mat, 9) = -cat(*this, 0)  * cat(*this, 9) * cat(*this, 15) + 
-				cat(*this, 0)  * cat(*this, 11) * cat(*this, 13) + 
-				cat(*this, 8)  * cat(*this, 1) * cat(*this, 15) - 
-				cat(*this, 8)  * cat(*this, 3) * cat(*this, 13) - 
-				cat(*this, 12) * cat(*this, 1) * cat(*this, 11) + 
-				cat(*this, 12) * cat(*this, 3) * cat(*this, 9);
-
-		at(mat, 13) = cat(*this, 0)  * cat(*this, 9) * cat(*this, 14) - 
-				cat(*this, 0)  * cat(*this, 10) * cat(*this, 13) - 
-				cat(*this, 8)  * cat(*this, 1) * cat(*this, 14) + 
-				cat(*this, 8)  * cat(*this, 2) * cat(*this, 13) + 
-				cat(*this, 12) * cat(*this, 1) * cat(*this, 10) - 
-				cat(*this, 12) * cat(*this, 2) * cat(*this, 9);
-
-		at(mat, 2) = cat(*this, 1)  * cat(*this, 6) * cat(*this, 15) - 
-				cat(*this, 1)  * cat(*this, 7) * cat(*this, 14) - 
-				cat(*this, 5)  * cat(*this, 2) * cat(*this, 15) + 
-				cat(*this, 5)  * cat(*this, 3) * cat(*this, 14) + 
-				cat(*this, 13) * cat(*this, 2) * cat(*this, 7) - 
-				cat(*this, 13) * cat(*this, 3) * cat(*this, 6);
-
-		at(mat, 6) = -cat(*this, 0)  * cat(*this, 6) * cat(*this, 15) + 
-				cat(*this, 0)  * cat(*this, 7) * cat(*this, 14) + 
-				cat(*this, 4)  * cat(*this, 2) * cat(*this, 15) - 
-				cat(*this, 4)  * cat(*this, 3) * cat(*this, 14) - 
-				cat(*this, 12) * cat(*this, 2) * cat(*this, 7) + 
-				cat(*this, 12) * cat(*this, 3) * cat(*this, 6);
-
-		at(mat, 10) = cat(*this, 0)  * cat(*this, 5) * cat(*this, 15) - 
-				cat(*this, 0)  * cat(*this, 7) * cat(*this, 13) - 
-				cat(*this, 4)  * cat(*this, 1) * cat(*this, 15) + 
-				cat(*this, 4)  * cat(*this, 3) * cat(*this, 13) + 
-				cat(*this, 12) * cat(*this, 1) * cat(*this, 7) - 
-				cat(*this, 12) * cat(*this, 3) * cat(*this, 5);
-
-		at(mat, 14) = -cat(*this, 0)  * cat(*this, 5) * cat(*this, 14) + 
-				cat(*this, 0)  * cat(*this, 6) * cat(*this, 13) + 
-				cat(*this, 4)  * cat(*this, 1) * cat(*this, 14) - 
-				cat(*this, 4)  * cat(*this, 2) * cat(*this, 13) - 
-				cat(*this, 12) * cat(*this, 1) * cat(*this, 6) + 
-				cat(*this, 12) * cat(*this, 2) * cat(*this, 5);
-
-		at(mat, 3) = -cat(*this, 1) * cat(*this, 6) * cat(*this, 11) + 
-				cat(*this, 1) * cat(*this, 7) * cat(*this, 10) + 
-				cat(*this, 5) * cat(*this, 2) * cat(*this, 11) - 
-				cat(*this, 5) * cat(*this, 3) * cat(*this, 10) - 
-				cat(*this, 9) * cat(*this, 2) * cat(*this, 7) + 
-				cat(*this, 9) * cat(*this, 3) * cat(*this, 6);
-
-		at(mat, 7) = cat(*this, 0) * cat(*this, 6) * cat(*this, 11) - 
-				cat(*this, 0) * cat(*this, 7) * cat(*this, 10) - 
-				cat(*this, 4) * cat(*this, 2) * cat(*this, 11) + 
-				cat(*this, 4) * cat(*this, 3) * cat(*this, 10) + 
-				cat(*this, 8) * cat(*this, 2) * cat(*this, 7) - 
-				cat(*this, 8) * cat(*this, 3) * cat(*this, 6);
-
-		at(mat, 11) = -cat(*this, 0) * cat(*this, 5) * cat(*this, 11) + 
-				cat(*this, 0) * cat(*this, 7) * cat(*this, 9) + 
-				cat(*this, 4) * cat(*this, 1) * cat(*this, 11) - 
-				cat(*this, 4) * cat(*this, 3) * cat(*this, 9) - 
-				cat(*this, 8) * cat(*this, 1) * cat(*this, 7) + 
-				cat(*this, 8) * cat(*this, 3) * cat(*this, 5);
+			std::size_t pivot = column;
+			for(std::size_t row = column + 1; row < R; row++)
+			{
+				if(detail::abs(m(row, column)) > detail::abs(m(pivot, column)))
+				{
+					pivot = row;
+				}
+			}
+			tz_assert(m(pivot, column) != T{0}, "tz::Matrix<T, %zu, %zu>::inverse(): Cannot get inverse because determinant is zero.", R, C);
+			if(pivot != column)
+			{
+				for(std::size_t j = 0; j < C; j++)
+				{
+					std::swap(m(pivot, j), m(column, j));
+					std::swap(inv(pivot, j), inv(column, j));
+				}
+			}
+			T reciprocal = T{1} / m(column, column);
+			for(std::size_t j = 0; j < C; j++)
+			{
+				m(column, j) *= reciprocal;
+				inv(column, j) *= reciprocal;
+			}
+			for(std::size_t row = 0; row < R; row++)
+			{
+				T factor = m(row, column);
+				if(row == column || factor == T{0})
+				{
+					continue;
+				}
+				for(std::size_t j = 0; j < C; j++)
+				{
+					m(row, j) -= factor * m(column, j);
+					inv(row, j) -= factor * inv(column, j);
+				}
+			}
+		}
+		return inv;
+	}
 
-		at(mat, 15) = cat(*this, 0) * cat(*this, 5) * cat(*this, 10) - 
-				cat(*this, 0) * cat(*this, 6) * cat(*this, 9) - 
-				cat(*this, 4) * cat(*this, 1) * cat(*this, 10) + 
-				cat(*this, 4) * cat(*this, 2) * cat(*this, 9) + 
-				cat(*this, 8) * cat(*this, 1) * cat(*this, 6) - 
-				cat(*this, 8) * cat(*this, 2) * cat(*this, 5);
+	template<tz::Number T, std::size_t R, std::size_t C>
+	constexpr Matrix<T, R, C> Matrix<T, R, C>::inverse_affine() const requires(R == 4 && C == 4)
+	{
+		const Matrix<T, R, C>& m = *this;
+		tz_assert(m(3, 0) == T{0} && m(3, 1) == T{0} && m(3, 2) == T{0} && m(3, 3) == T{1}, "tz::Matrix<T, %zu, %zu>::inverse_affine(): Bottom row is not (0, 0, 0, 1), so the matrix is not affine. Use inverse() instead.", R, C);
+		// Invert the upper-left 3x3 via its adjugate.
+		Matrix<T, R, C> inv;
+		inv(0, 0) = m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1);
+		inv(0, 1) = m(0, 2) * m(2, 1) - m(0, 1) * m(2, 2);
+		inv(0, 2) = m(0, 1) * m(1, 2) - m(0, 2) * m(1, 1);
+		inv(1, 0) = m(1, 2) * m(2, 0) - m(1, 0) * m(2, 2);
+		inv(1, 1) = m(0, 0) * m(2, 2) - m(0, 2) * m(2, 0);
+		inv(1, 2) = m(0, 2) * m(1, 0) - m(0, 0) * m(1, 2);
+		inv(2, 0) = m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0);
+		inv(2, 1) = m(0, 1) * m(2, 0) - m(0, 0) * m(2, 1);
+		inv(2, 2) = m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0);
+		T determinant = m(0, 0) * inv(0, 0) + m(0, 1) * inv(1, 0) + m(0, 2) * inv(2, 0);
+		tz_assert(determinant != T{0}, "tz::Matrix<T, %zu, %zu>::inverse_affine(): Cannot get inverse because determinant is zero.", R, C);
+		T reciprocal = T{1} / determinant;
+		for(std::size_t i = 0; i < 3; i++)
+		{
+			for(std::size_t j = 0; j < 3; j++)
+			{
+				inv(i, j) *= reciprocal;
+			}
+		}
+		// Undo the translation after undoing everything else.
+		for(std::size_t i = 0; i < 3; i++)
+		{
+			inv(i, 3) = -(inv(i, 0) * m(0, 3) + inv(i, 1) * m(1, 3) + inv(i, 2) * m(2, 3));
+			inv(3, i) = T{0};
+		}
+		inv(3, 3) = T{1};
+		return inv;
+	}
 
-		float determinant = cat(*this, 0) * cat(mat, 0) + cat(*this, 1) * cat(mat, 4) + cat(*this, 2) * cat(mat, 8) + cat(*this, 3) * cat(mat, 12);
-		tz_assert(determinant != 0, "tz::geo::Matrix<T, %zu, %zu>::inverse(): Cannot get inverse because determinant is zero.", R, C);
-		determinant = 1.0f / determinant;
-		for(std::size_t i = 0; i < 16; i++)
-			at(mat, i) = cat(mat, i) * determinant;
-		return mat;
+	template<tz::Number T, std::size_t R, std::size_t C>
+	constexpr Matrix<T, R, C> Matrix<T, R, C>::inverse_rigid() const requires(R == 4 && C == 4)
+	{
+		const Matrix<T, R, C>& m = *this;
+		tz_assert(m(3, 0) == T{0} && m(3, 1) == T{0} && m(3, 2) == T{0} && m(3, 3) == T{1}, "tz::Matrix<T, %zu, %zu>::inverse_rigid(): Bottom row is not (0, 0, 0, 1), so the matrix is not affine. Use inverse() instead.", R, C);
+		#if TZ_DEBUG
+			for(std::size_t i = 0; i < 3; i++)
+			{
+				for(std::size_t j = 0; j < 3; j++)
+				{
+					T column_dot = m(0, i) * m(0, j) + m(1, i) * m(1, j) + m(2, i) * m(2, j);
+					T expected = i == j ? T{1} : T{0};
+					tz_assert(detail::abs(column_dot - expected) <= T{1} / T{1000}, "tz::Matrix<T, %zu, %zu>::inverse_rigid(): Upper-left 3x3 is not orthonormal (it contains a scale or shear), so the matrix is not rigid. Use inverse_affine() instead.", R, C);
+				}
+			}
+		#endif
+		// The inverse of a rotation is its transpose.
+		Matrix<T, R, C> inv;
+		for(std::size_t i = 0; i < 3; i++)
+		{
+			for(std::size_t j = 0; j < 3; j++)
+			{
+				inv(i, j) = m(j, i);
+			}
+		}
+		for(std::size_t i = 0; i < 3; i++)
+		{
+			inv(i, 3) = -(inv(i, 0) * m(0, 3) + inv(i, 1) * m(1, 3) + inv(i, 2) * m(2, 3));
+			inv(3, i) = T{0};
+		}
+		inv(3, 3) = T{1};
+		return inv;
 	}
 
 	template<tz::Number T, std::size_t R, std::size_t C>
 	//template<std::size_t X, std::size_t Y, typename std::enable_if_t<X == Y>>
-	Matrix<T, R, C> Matrix<T, R, C>::transpose() const
+	constexpr Matrix<T, R, C> Matrix<T, R, C>::transpose() const
 	{
 		Matrix<T, R, C> m = *this;
 		for(std::size_t i = 0; i < R; i++)
 		{
-			for(std::size_t j = 0; j < C; j++)
+			// Only visit each pair once. Swapping every pair would swap it back again.
+			for(std::size_t j = i + 1; j < C; j++)
 			{
-				if(i != j)
-				{
-					std::swap(m(i, j), m(j, i));
-				}
+				std::swap(m(i, j), m(j, i));
 			}
 		}
 		return m;
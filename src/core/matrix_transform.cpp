@@ -1,17 +1,13 @@
 #include "core/matrix_transform.hpp"
+#include "core/profile.hpp"
+#include "core/simd.hpp"
+#include <algorithm>
 #include <cmath>
+#include <thread>
+#include <vector>
 
 namespace tz
 {
-	Mat4 translate(Vec3 position)
-	{
-		Mat4 m = Mat4::identity();
-		m(0, 3) = position[0];
-		m(1, 3) = position[1];
-		m(2, 3) = position[2];
-		return m;
-	}
-
 	// http://www.opengl-tutorial.org/assets/faq_quaternions/index.html#Q28
 	/*
 	Q28. How do I generate a rotation matrix in the X-axis?
@@ -86,52 +82,73 @@ namespace tz
 		return r;
 	}
 
-	Mat4 scale(Vec3 scale)
+	Mat4 model(Vec3 position, Vec3 rotation, Vec3 scale)
 	{
-		Mat4 m = Mat4::identity();
+		return tz::translate(position) * tz::rotate(rotation) * tz::scale(scale);
+	}
+
+	Mat4 model(Vec3 position, const Quaternion& rotation, Vec3 scale)
+	{
+		// translate * rotation * scale, without the multiplies: scale each column of the rotation, then drop in the translation.
+		Mat4 m = rotation.to_mat4();
 		for(std::size_t i = 0; i < 3; i++)
 		{
-			m(i, i) = scale[i];
+			for(std::size_t j = 0; j < 3; j++)
+			{
+				m(i, j) *= scale[j];
+			}
+			m(i, 3) = position[i];
 		}
 		return m;
 	}
 
-	Mat4 model(Vec3 position, Vec3 rotation, Vec3 scale)
+	void model_batch(std::span<const Vec3> positions, std::span<const Vec3> rotations, std::span<const Vec3> scales, std::span<Mat4> models, std::size_t max_threads)
 	{
-		return tz::translate(position) * tz::rotate(rotation) * tz::scale(scale);
+		tz_profile_scope("tz::model_batch");
+		tz_assert(positions.size() == models.size() && rotations.size() == models.size() && scales.size() == models.size(), "tz::model_batch(...): Expected %zu positions, rotations and scales, but got %zu, %zu and %zu.", models.size(), positions.size(), rotations.size(), scales.size());
+		static_assert(sizeof(Vec3) == sizeof(float) * 3 && sizeof(Mat4) == sizeof(float) * 16, "tz::model_batch requires tightly-packed Vec3s and Mat4s");
+		auto compute = [&](std::size_t begin, std::size_t end)
+		{
+			if(begin < end)
+			{
+				simd::mat4_model_batch(positions[begin].data(), rotations[begin].data(), scales[begin].data(), &models[begin](0, 0), end - begin);
+			}
+		};
+		// Starting a thread costs about as much as computing a few thousand matrices, so only split up big batches.
+		constexpr std::size_t min_models_per_thread = 16384;
+		std::size_t thread_count = std::clamp<std::size_t>(models.size() / min_models_per_thread, 1, std::max<std::size_t>(max_threads, 1));
+		if(thread_count == 1)
+		{
+			compute(0, models.size());
+			return;
+		}
+		// Keep each thread's share a multiple of 4, so that only the last one has a partial SIMD batch.
+		std::size_t models_per_thread = ((models.size() + thread_count - 1) / thread_count + 3) & ~std::size_t{3};
+		std::vector<std::thread> workers;
+		for(std::size_t i = 1; i < thread_count; i++)
+		{
+			workers.emplace_back(compute, std::min(i * models_per_thread, models.size()), std::min((i + 1) * models_per_thread, models.size()));
+		}
+		compute(0, std::min(models_per_thread, models.size()));
+		for(std::thread& worker : workers)
+		{
+			worker.join();
+		}
 	}
 
 	Mat4 view(Vec3 position, Vec3 rotation)
 	{
-		return (translate(position) * rotate(rotation)).inverse();
-	}
-
-	Mat4 perspective(float fov, float aspect_ratio, float near, float far)
-	{
-		const float thf = std::tan(fov / 2.0f);
-		Mat4 m = Mat4::identity();
-		m(0, 0) = 1.0f / (aspect_ratio * thf);
-		m(1, 1) = 1.0f / thf;
-
-		m(2, 2) = (far + near) / (near - far);
-		m(3, 2) = -1.0f;
-		
-		m(2, 3) = (2.0f * far * near) / (near - far);
-		m(3, 3) = 0.0f;
-		return m;
+		return (translate(position) * rotate(rotation)).inverse_rigid();
 	}
 
-	Mat4 orthographic(float left, float right, float top, float bottom, float near, float far)
+	Mat4 view(Vec3 position, const Quaternion& rotation)
 	{
-		Mat4 m = Mat4::identity();
-		m(0, 0) = 2.0f / (right - left);
-		m(1, 1) = 2.0f / (top - bottom);
-		m(2, 2) = -2.0f / (far - near);
-
-		Mat4::Row& bottom_row = m[2];
-		bottom_row[0] = -(right + left) / (right - left);
-		bottom_row[1] = -(top + bottom) / (top - bottom);
-		bottom_row[2] = -(far + near) / (far - near);
+		// The inverse of translate * rotation is the inverse rotation, followed by translating back by -position.
+		Mat4 m = rotation.conjugate().to_mat4();
+		for(std::size_t i = 0; i < 3; i++)
+		{
+			m(i, 3) = -(m(i, 0) * position[0] + m(i, 1) * position[1] + m(i, 2) * position[2]);
+		}
 		return m;
 	}
 }
\ No newline at end of file
@@ -5,7 +5,9 @@
 #ifndef TOPAZ_CORE_MATRIX_TRANSFORM_HPP
 #define TOPAZ_CORE_MATRIX_TRANSFORM_HPP
 #include "core/matrix.hpp"
+#include "core/quaternion.hpp"
 #include "core/vector.hpp"
+#include <span>
 
 namespace tz
 {
@@ -21,7 +23,7 @@ namespace tz
 	 * - Translates the result position[1] units in the positive y-direction.
 	 * - Translates the result position[2] units in the positive z-direction.
 	 */
-	Mat4 translate(Vec3 position);
+	constexpr Mat4 translate(Vec3 position);
 	/**
 	 * Generates a matrix which performs the following three transformations, in chronological order:
 	 * - Rotates the result rotation[0] radians about the x-axis.
@@ -35,31 +37,50 @@ namespace tz
 	 * - Multiplies each value by scale[1] in the y-direction.
 	 * - Multiplies each value by scale[2] in the z-direction.
 	 */
-	Mat4 scale(Vec3 scale);
+	constexpr Mat4 scale(Vec3 scale);
 
 	/**
 	 * Generates a model matrix using the given position, euler-rotation and scale vectors.
 	 * Note: This can be used to transform positions within model-space to world-space.
 	 */
 	Mat4 model(Vec3 position, Vec3 rotation, Vec3 scale);
+	/**
+	 * Generates a model matrix using the given position, rotation and scale. This is cheaper than the euler-angle overload, as the rotation is already computed.
+	 * Precondition: rotation is a unit quaternion.
+	 */
+	Mat4 model(Vec3 position, const Quaternion& rotation, Vec3 scale);
+	/**
+	 * Generates many model matrices at once, such that models[i] is equivalent to tz::model(positions[i], rotations[i], scales[i]).
+	 * This is much faster than calling tz::model in a loop: each matrix is composed directly rather than via intermediate multiplies, and with SSE2/AVX2 (See tz::simd) four are computed at once.
+	 * Precondition: positions, rotations and scales each have exactly one element per model. Otherwise, this will assert and invoke UB.
+	 * @param max_threads The most threads to split the work across, including the calling thread. Batches are only split if they are large enough for it to pay off.
+	 */
+	void model_batch(std::span<const Vec3> positions, std::span<const Vec3> rotations, std::span<const Vec3> scales, std::span<Mat4> models, std::size_t max_threads = 1);
 	/**
 	 * Generates a view matrix using the given view position and rotation.
 	 * Note: This can be used to transform positions within world-space to camera-space.
 	 */
 	Mat4 view(Vec3 position, Vec3 rotation);
+	/**
+	 * Generates a view matrix using the given view position and rotation. Unlike the euler-angle overload, this cannot gimbal lock.
+	 * Precondition: rotation is a unit quaternion.
+	 */
+	Mat4 view(Vec3 position, const Quaternion& rotation);
 	/**
 	 * Generates a perspective projection matrix using the given camera properties. The properties generate a regular pyramidal-frustum-shaped projection.
 	 * Note: This can be used to transform positions within camera-space to clip-space.
+	 * Note: This is constexpr, so projections with a fixed field of view can be computed at compile-time.
 	 */
-	Mat4 perspective(float fov, float aspect_ratio, float near, float far);
+	constexpr Mat4 perspective(float fov, float aspect_ratio, float near, float far);
 	/**
 	 * Generates an orthographic projection matrix using the given camera properties. The properties generate a cube-shaped projection.
 	 */
-	Mat4 orthographic(float left, float right, float top, float bottom, float near, float far);
+	constexpr Mat4 orthographic(float left, float right, float top, float bottom, float near, float far);
 
 	/**
 	 * @}
 	 */
 }
 
+#include "core/matrix_transform.inl"
 #endif // TOPAZ_CORE_MATRIX_TRANSFORM_HPP
\ No newline at end of file
@@ -0,0 +1,72 @@
+#include <cmath>
+#include <type_traits>
+
+namespace tz
+{
+	namespace detail
+	{
+		// std::tan isn't constexpr until C++26. This is only used during constant evaluation, so it is in double to keep the result as close as possible to std::tan.
+		constexpr double constexpr_tan(double x)
+		{
+			// Taylor series of sin and cos. Good to double precision for |x| < pi/2, which covers any sensible field of view.
+			double sin = 0.0, cos = 0.0;
+			double sin_term = x, cos_term = 1.0;
+			for(int n = 0; n < 15; n++)
+			{
+				sin += sin_term;
+				cos += cos_term;
+				sin_term *= -x * x / ((2 * n + 2) * (2 * n + 3));
+				cos_term *= -x * x / ((2 * n + 1) * (2 * n + 2));
+			}
+			return sin / cos;
+		}
+	}
+
+	constexpr Mat4 translate(Vec3 position)
+	{
+		Mat4 m = Mat4::identity();
+		m(0, 3) = position[0];
+		m(1, 3) = position[1];
+		m(2, 3) = position[2];
+		return m;
+	}
+
+	constexpr Mat4 scale(Vec3 scale)
+	{
+		Mat4 m = Mat4::identity();
+		for(std::size_t i = 0; i < 3; i++)
+		{
+			m(i, i) = scale[i];
+		}
+		return m;
+	}
+
+	constexpr Mat4 perspective(float fov, float aspect_ratio, float near, float far)
+	{
+		const float thf = std::is_constant_evaluated() ? static_cast<float>(detail::constexpr_tan(fov / 2.0f)) : std::tan(fov / 2.0f);
+		Mat4 m = Mat4::identity();
+		m(0, 0) = 1.0f / (aspect_ratio * thf);
+		m(1, 1) = 1.0f / thf;
+
+		m(2, 2) = (far + near) / (near - far);
+		m(3, 2) = -1.0f;
+		
+		m(2, 3) = (2.0f * far * near) / (near - far);
+		m(3, 3) = 0.0f;
+		return m;
+	}
+
+	constexpr Mat4 orthographic(float left, float right, float top, float bottom, float near, float far)
+	{
+		Mat4 m = Mat4::identity();
+		m(0, 0) = 2.0f / (right - left);
+		m(1, 1) = 2.0f / (top - bottom);
+		m(2, 2) = -2.0f / (far - near);
+
+		Mat4::Row& bottom_row = m[2];
+		bottom_row[0] = -(right + left) / (right - left);
+		bottom_row[1] = -(top + bottom) / (top - bottom);
+		bottom_row[2] = -(far + near) / (far - near);
+		return m;
+	}
+}
@@ -0,0 +1,294 @@
+#include "core/profile.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace tz
+{
+    namespace detail
+    {
+        /**
+         * Zones are appended by exactly one thread (the owner), but may be read by any thread at any time. The owner publishes each zone by bumping count with release semantics, so a reader which acquires count only ever sees fully-written zones.
+         */
+        struct ProfileChunk
+        {
+            static constexpr std::size_t capacity = 4096;
+            std::array<ProfileZone, capacity> zones;
+            std::atomic<std::size_t> count{0};
+            std::atomic<ProfileChunk*> next{nullptr};
+        };
+
+        enum class ProfileBufferState
+        {
+            /// Owned by a running thread.
+            Active,
+            /// The owning thread has exited, but its zones have not yet been written out.
+            Retired,
+            /// Empty, and waiting to be handed to the next thread which records a zone.
+            Free
+        };
+
+        struct ProfileThreadBuffer
+        {
+            ProfileThreadBuffer(std::uint32_t thread_id):
+            thread_id(thread_id),
+            state(ProfileBufferState::Active),
+            head(),
+            tail(&this->head),
+            extra_chunks()
+            {}
+
+            void push(ProfileZone zone)
+            {
+                std::size_t count = this->tail->count.load(std::memory_order_relaxed);
+                if(count == ProfileChunk::capacity)
+                {
+                    auto& chunk = this->extra_chunks.emplace_back(std::make_unique<ProfileChunk>());
+                    this->tail->next.store(chunk.get(), std::memory_order_release);
+                    this->tail = chunk.get();
+                    count = 0;
+                }
+                this->tail->zones[count] = zone;
+                this->tail->count.store(count + 1, std::memory_order_release);
+            }
+
+            bool empty() const
+            {
+                return this->head.count.load(std::memory_order_acquire) == 0;
+            }
+
+            /// Only safe while no thread is recording into the buffer.
+            void clear()
+            {
+                this->head.count.store(0, std::memory_order_relaxed);
+                this->head.next.store(nullptr, std::memory_order_relaxed);
+                this->tail = &this->head;
+                this->extra_chunks.clear();
+            }
+
+            std::uint32_t thread_id;
+            /// Guarded by the registry mutex.
+            ProfileBufferState state;
+            ProfileChunk head;
+            /// Only ever touched by the owning thread.
+            ProfileChunk* tail;
+            /// Only ever resized by the owning thread. Readers walk the next pointers instead.
+            std::vector<std::unique_ptr<ProfileChunk>> extra_chunks;
+        };
+
+        /**
+         * Owns every thread's buffer. Buffers outlive their threads, so zones recorded by a thread which has since exited still make it into the trace. Once those zones have been written out (or cleared), the buffer is recycled for the next new thread, so short-lived threads don't grow the registry forever.
+         */
+        struct ProfileRegistry
+        {
+            /// Must hold the mutex. Empties the buffer and queues it up for the next new thread.
+            void recycle(ProfileThreadBuffer& buffer)
+            {
+                buffer.clear();
+                buffer.state = ProfileBufferState::Free;
+                this->free_buffers.push_back(&buffer);
+            }
+
+            std::mutex mutex;
+            std::vector<std::unique_ptr<ProfileThreadBuffer>> buffers;
+            std::vector<ProfileThreadBuffer*> free_buffers;
+        };
+
+        ProfileRegistry& get_registry()
+        {
+            static ProfileRegistry registry;
+            return registry;
+        }
+
+        std::chrono::steady_clock::time_point get_epoch()
+        {
+            static const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+            return epoch;
+        }
+
+        /**
+         * Lives in thread-local storage, so that a thread's buffer is retired when the thread exits.
+         */
+        struct ProfileThreadBufferOwner
+        {
+            ~ProfileThreadBufferOwner()
+            {
+                if(this->buffer == nullptr)
+                {
+                    return;
+                }
+                ProfileRegistry& registry = get_registry();
+                std::lock_guard<std::mutex> lock{registry.mutex};
+                if(this->buffer->empty())
+                {
+                    // Nothing to write out, so it can be reused straight away.
+                    registry.recycle(*this->buffer);
+                }
+                else
+                {
+                    this->buffer->state = ProfileBufferState::Retired;
+                }
+            }
+
+            ProfileThreadBuffer* buffer = nullptr;
+        };
+
+        ProfileThreadBuffer& get_thread_buffer()
+        {
+            thread_local ProfileThreadBufferOwner owner;
+            if(owner.buffer == nullptr)
+            {
+                // First zone on this thread. This is the only time recording takes a lock.
+                ProfileRegistry& registry = get_registry();
+                std::lock_guard<std::mutex> lock{registry.mutex};
+                if(!registry.free_buffers.empty())
+                {
+                    // Reusing a buffer also reuses its thread id, but the thread which had it has exited and its zones are gone.
+                    owner.buffer = registry.free_buffers.back();
+                    registry.free_buffers.pop_back();
+                    owner.buffer->state = ProfileBufferState::Active;
+                }
+                else
+                {
+                    auto thread_id = static_cast<std::uint32_t>(registry.buffers.size());
+                    owner.buffer = registry.buffers.emplace_back(std::make_unique<ProfileThreadBuffer>(thread_id)).get();
+                }
+            }
+            return *owner.buffer;
+        }
+
+        template<typename Function>
+        void for_each_zone(const ProfileThreadBuffer& buffer, Function function)
+        {
+            for(const ProfileChunk* chunk = &buffer.head; chunk != nullptr; chunk = chunk->next.load(std::memory_order_acquire))
+            {
+                std::size_t count = chunk->count.load(std::memory_order_acquire);
+                for(std::size_t i = 0; i < count; i++)
+                {
+                    function(chunk->zones[i]);
+                }
+            }
+        }
+
+        void write_json_string(std::FILE* file, const char* str)
+        {
+            std::fputc('"', file);
+            for(const char* c = str; *c != '\0'; c++)
+            {
+                switch(*c)
+                {
+                    case '"':
+                        std::fputs("\\\"", file);
+                    break;
+                    case '\\':
+                        std::fputs("\\\\", file);
+                    break;
+                    default:
+                        if(static_cast<unsigned char>(*c) < 0x20)
+                        {
+                            std::fprintf(file, "\\u%04x", static_cast<unsigned int>(*c));
+                        }
+                        else
+                        {
+                            std::fputc(*c, file);
+                        }
+                    break;
+                }
+            }
+            std::fputc('"', file);
+        }
+    }
+
+    ProfileScope::ProfileScope(const char* name):
+    name(name),
+    begin_ns(profile_now())
+    {}
+
+    ProfileScope::~ProfileScope()
+    {
+        detail::get_thread_buffer().push({.name = this->name, .begin_ns = this->begin_ns, .end_ns = profile_now()});
+    }
+
+    std::uint64_t profile_now()
+    {
+        auto elapsed = std::chrono::steady_clock::now() - detail::get_epoch();
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+    std::size_t profile_zone_count()
+    {
+        detail::ProfileRegistry& registry = detail::get_registry();
+        std::lock_guard<std::mutex> lock{registry.mutex};
+        std::size_t count = 0;
+        for(const auto& buffer : registry.buffers)
+        {
+            detail::for_each_zone(*buffer, [&count](const ProfileZone&){count++;});
+        }
+        return count;
+    }
+
+    bool profile_write_chrome_trace(const char* path)
+    {
+        std::FILE* file = std::fopen(path, "w");
+        if(file == nullptr)
+        {
+            return false;
+        }
+        detail::ProfileRegistry& registry = detail::get_registry();
+        std::lock_guard<std::mutex> lock{registry.mutex};
+        std::fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", file);
+        bool first = true;
+        for(const auto& buffer : registry.buffers)
+        {
+            if(buffer->state == detail::ProfileBufferState::Free)
+            {
+                continue;
+            }
+            std::fprintf(file, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"Thread %u\"}}", first ? "" : ",", buffer->thread_id, buffer->thread_id);
+            first = false;
+            detail::for_each_zone(*buffer, [file, &buffer](const ProfileZone& zone)
+            {
+                // Trace event timestamps are in microseconds, but fractions are allowed.
+                std::fputs(",\n{\"name\":", file);
+                detail::write_json_string(file, zone.name);
+                std::fprintf(file, ",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", buffer->thread_id, static_cast<double>(zone.begin_ns) / 1000.0, static_cast<double>(zone.end_ns - zone.begin_ns) / 1000.0);
+            });
+        }
+        std::fputs("\n]}\n", file);
+        bool success = std::ferror(file) == 0;
+        success = std::fclose(file) == 0 && success;
+        if(success)
+        {
+            // Zones from threads which have exited are now safely written out, so their buffers can be reused.
+            for(const auto& buffer : registry.buffers)
+            {
+                if(buffer->state == detail::ProfileBufferState::Retired)
+                {
+                    registry.recycle(*buffer);
+                }
+            }
+        }
+        return success;
+    }
+
+    void profile_clear()
+    {
+        detail::ProfileRegistry& registry = detail::get_registry();
+        std::lock_guard<std::mutex> lock{registry.mutex};
+        for(auto& buffer : registry.buffers)
+        {
+            if(buffer->state == detail::ProfileBufferState::Retired)
+            {
+                registry.recycle(*buffer);
+            }
+            else
+            {
+                buffer->clear();
+            }
+        }
+    }
+}
@@ -0,0 +1,87 @@
+#ifndef TOPAZ_CORE_PROFILE_HPP
+#define TOPAZ_CORE_PROFILE_HPP
+#include <cstddef>
+#include <cstdint>
+
+namespace tz
+{
+    /**
+	 * \addtogroup tz_core Topaz Core Library (tz)
+	 * A collection of platform-agnostic core interfaces.
+	 * @{
+	 */
+
+    /**
+     * @brief A span of time spent by a single thread, as recorded by @ref tz_profile_scope.
+     */
+    struct ProfileZone
+    {
+        /// Must be a string literal, or otherwise outlive the profiler.
+        const char* name;
+        /// Nanoseconds since the profiler started.
+        std::uint64_t begin_ns;
+        /// Nanoseconds since the profiler started.
+        std::uint64_t end_ns;
+    };
+
+    /**
+     * @brief Records a @ref ProfileZone covering its own lifetime. Use @ref tz_profile_scope rather than this directly, so that it compiles out when profiling is disabled.
+     * @details Each thread records into its own buffer, so recording never takes a lock (other than once, the first time a thread records anything).
+     */
+    class ProfileScope
+    {
+    public:
+        ProfileScope(const char* name);
+        ProfileScope(const ProfileScope& copy) = delete;
+        ProfileScope(ProfileScope&& move) = delete;
+        ~ProfileScope();
+        ProfileScope& operator=(const ProfileScope& rhs) = delete;
+        ProfileScope& operator=(ProfileScope&& rhs) = delete;
+    private:
+        const char* name;
+        std::uint64_t begin_ns;
+    };
+
+    /**
+     * @brief Retrieve the number of nanoseconds since the profiler started. This is the clock used by @ref ProfileZone.
+     */
+    std::uint64_t profile_now();
+    /**
+     * @brief Retrieve the total number of zones recorded so far, across all threads.
+     */
+    std::size_t profile_zone_count();
+    /**
+     * @brief Write every zone recorded so far, across all threads, in the Chrome trace event format. The file can be opened in Perfetto or chrome://tracing.
+     * @note Threads may keep recording while this happens. Zones they finish during the write may or may not be included.
+     * @note Zones recorded by threads which have since exited are only written once. After that, their memory is reused by new threads.
+     * @param path Path of the file to write. Overwritten if it already exists.
+     * @return True if the file was written successfully.
+     */
+    bool profile_write_chrome_trace(const char* path);
+    /**
+     * @brief Forget every zone recorded so far.
+     * @pre No other thread may be recording zones.
+     */
+    void profile_clear();
+
+    /**
+     * @}
+     */
+}
+
+#define tz_profile_concat_internal(a, b) a##b
+#define tz_profile_concat(a, b) tz_profile_concat_internal(a, b)
+
+#ifdef tz_profile_scope
+#undef tz_profile_scope
+#endif
+/**
+ * @brief Record the time spent between here and the end of the enclosing scope as a zone with the given name. Compiles to nothing unless TZ_PROFILE is enabled (Debug builds, or Release builds configured with TOPAZ_PROFILE).
+ */
+#if TZ_PROFILE
+    #define tz_profile_scope(name) tz::ProfileScope tz_profile_concat(tz_profile_scope_, __LINE__){name}
+#else
+    #define tz_profile_scope(name) (void)0
+#endif
+
+#endif // TOPAZ_CORE_PROFILE_HPP
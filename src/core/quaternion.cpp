@@ -0,0 +1,66 @@
+#include "core/quaternion.hpp"
+#include <cmath>
+
+namespace tz
+{
+	static_assert(sizeof(Quaternion) == sizeof(float) * 4, "tz::Quaternion must be tightly packed");
+
+	Quaternion Quaternion::from_axis_angle(Vec3 axis, float angle)
+	{
+		float length = axis.length();
+		tz_assert(length != 0.0f, "Quaternion::from_axis_angle(...): Axis must not be the zero vector.");
+		float s = std::sin(angle * 0.5f) / length;
+		return {axis[0] * s, axis[1] * s, axis[2] * s, std::cos(angle * 0.5f)};
+	}
+
+	Quaternion Quaternion::from_euler(Vec3 rotation)
+	{
+		float sin_x = std::sin(rotation[0] * 0.5f), cos_x = std::cos(rotation[0] * 0.5f);
+		float sin_y = std::sin(rotation[1] * 0.5f), cos_y = std::cos(rotation[1] * 0.5f);
+		float sin_z = std::sin(rotation[2] * 0.5f), cos_z = std::cos(rotation[2] * 0.5f);
+		// z * y * x, to match tz::rotate. Multiplied out by hand.
+		return
+		{
+			cos_z * cos_y * sin_x - sin_z * sin_y * cos_x,
+			cos_z * sin_y * cos_x + sin_z * cos_y * sin_x,
+			sin_z * cos_y * cos_x - cos_z * sin_y * sin_x,
+			cos_z * cos_y * cos_x + sin_z * sin_y * sin_x
+		};
+	}
+
+	Vec3 Quaternion::rotate(const Vec3& vec) const
+	{
+		// v' = v + w * t + u x t, where u is the vector part and t = 2(u x v).
+		Vec3 u{std::array<float, 3>{this->quat[0], this->quat[1], this->quat[2]}};
+		Vec3 t = tz::cross(u, vec) * 2.0f;
+		return vec + t * this->quat[3] + tz::cross(u, t);
+	}
+
+	Mat4 Quaternion::to_mat4() const
+	{
+		const float x = this->quat[0], y = this->quat[1], z = this->quat[2], w = this->quat[3];
+		return Mat4
+		{{
+			std::array<float, 4>{1.0f - 2.0f * (y * y + z * z), 2.0f * (x * y + z * w), 2.0f * (x * z - y * w), 0.0f},
+			std::array<float, 4>{2.0f * (x * y - z * w), 1.0f - 2.0f * (x * x + z * z), 2.0f * (y * z + x * w), 0.0f},
+			std::array<float, 4>{2.0f * (x * z + y * w), 2.0f * (y * z - x * w), 1.0f - 2.0f * (x * x + y * y), 0.0f},
+			std::array<float, 4>{0.0f, 0.0f, 0.0f, 1.0f}
+		}};
+	}
+
+	Quaternion slerp(const Quaternion& a, const Quaternion& b, float t)
+	{
+		float cos_theta = a.dot(b);
+		// Take the short way round.
+		Quaternion end = cos_theta < 0.0f ? -b : b;
+		cos_theta = std::abs(cos_theta);
+		if(cos_theta > 0.9995f)
+		{
+			// sin(theta) is tiny, and the arc is nearly a straight line anyway.
+			return nlerp(a, end, t);
+		}
+		float theta = std::acos(cos_theta);
+		float sin_theta = std::sin(theta);
+		return a * (std::sin((1.0f - t) * theta) / sin_theta) + end * (std::sin(t * theta) / sin_theta);
+	}
+}
@@ -0,0 +1,155 @@
+#ifndef TOPAZ_CORE_QUATERNION_HPP
+#define TOPAZ_CORE_QUATERNION_HPP
+#include "core/matrix.hpp"
+#include "core/vector.hpp"
+#include <array>
+
+namespace tz
+{
+	/**
+	 * \addtogroup tz_core Topaz Core Library (tz)
+	 * A collection of platform-agnostic core interfaces.
+	 * @{
+	 */
+
+	/**
+	 * Represents a rotation as a quaternion of floats, stored as (x, y, z, w).
+	 * Quaternions are only 16 bytes, can be interpolated cheaply (See tz::nlerp and tz::slerp) and do not suffer from gimbal lock, so prefer them over euler-angles for anything that rotates freely.
+	 * Note: Only unit quaternions represent rotations. Quaternions made via the static functions are always unit quaternions, and multiplying two unit quaternions gives another, but floating point error builds up over many operations. Re-normalise occasionally.
+	 */
+	class Quaternion
+	{
+	public:
+		/**
+		 * Default-constructed quaternions have indeterminate values.
+		 * To initialise the values, assign them or simply assign to Quaternion::identity().
+		 */
+		Quaternion() = default;
+		/**
+		 * Construct a quaternion directly from its components. This does not normalise.
+		 */
+		constexpr Quaternion(float x, float y, float z, float w);
+		/**
+		 * Retrieve the quaternion which represents no rotation at all.
+		 */
+		static constexpr Quaternion identity()
+		{
+			return {0.0f, 0.0f, 0.0f, 1.0f};
+		}
+		/**
+		 * Retrieve the quaternion which rotates by the given angle about the given axis.
+		 * @param axis Axis to rotate about. Need not be normalised, but must not be the zero vector.
+		 * @param angle Angle to rotate by, in radians.
+		 */
+		static Quaternion from_axis_angle(Vec3 axis, float angle);
+		/**
+		 * Retrieve the quaternion which performs the same rotation as tz::rotate(rotation). That is, rotation[0] radians about the x-axis, then rotation[1] radians about the y-axis, then rotation[2] radians about the z-axis.
+		 */
+		static Quaternion from_euler(Vec3 rotation);
+		/**
+		 * Retrieve the element value at the given index, in the order (x, y, z, w).
+		 * Precondition: idx < 4. Otherwise, this will assert and invoke UB.
+		 * @return The value at the given index.
+		 */
+		const float& operator[](std::size_t idx) const;
+		/**
+		 * Retrieve the element value at the given index, in the order (x, y, z, w).
+		 * Precondition: idx < 4. Otherwise, this will assert and invoke UB.
+		 * @return The value at the given index.
+		 */
+		float& operator[](std::size_t idx);
+		/**
+		 * Combine the given rotation with the current rotation. The result rotates by rhs first, and then by the current rotation, in the same way as multiplying rotation matrices.
+		 * @param rhs Rotation to apply before the current rotation.
+		 * @return The modified original quaternion.
+		 */
+		Quaternion& operator*=(const Quaternion& rhs);
+		/**
+		 * Combine the given rotation with the current rotation. The result rotates by rhs first, and then by the current rotation, in the same way as multiplying rotation matrices.
+		 * @param rhs Rotation to apply before the current rotation.
+		 * @return A modified copy of the current quaternion. The initial quaternion is unchanged.
+		 */
+		Quaternion operator*(const Quaternion& rhs) const;
+		/**
+		 * Multiply each element of the quaternion by the given value. This is mostly useful for blending quaternions. The result does not represent a rotation until it is normalised.
+		 * @return A modified copy of the current quaternion. The initial quaternion is unchanged.
+		 */
+		Quaternion operator*(float scalar) const;
+		/**
+		 * Add each element of the given quaternion to the corresponding element of the current quaternion. This is mostly useful for blending quaternions. The result does not represent a rotation until it is normalised.
+		 * @return A modified copy of the current quaternion. The initial quaternion is unchanged.
+		 */
+		Quaternion operator+(const Quaternion& rhs) const;
+		/**
+		 * Negate each element of the quaternion. The result represents the same rotation.
+		 */
+		Quaternion operator-() const;
+		/**
+		 * Equate the current quaternion with the given quaternion.
+		 * Note: q and -q represent the same rotation, but are not equal.
+		 * @return True if each element of the given quaternion is equal to the corresponding element of the current quaternion.
+		 */
+		bool operator==(const Quaternion& rhs) const;
+		/**
+		 * Retrieve a pointer to the quaternion data. This points to the first element of an array of 4 floats, (x, y, z, w).
+		 */
+		const float* data() const;
+		/**
+		 * Retrieve a pointer to the quaternion data. This points to the first element of an array of 4 floats, (x, y, z, w).
+		 */
+		float* data();
+		/**
+		 * Retrieve the conjugate of the quaternion. For unit quaternions, this is the inverse rotation.
+		 */
+		Quaternion conjugate() const;
+		/**
+		 * Compute the 4-dimensional dot-product of the current quaternion against another given quaternion.
+		 */
+		float dot(const Quaternion& rhs) const;
+		/**
+		 * Retrieve the magnitude of the quaternion. Unit quaternions have a magnitude of 1.
+		 */
+		float length() const;
+		/**
+		 * Normalise the quaternion, so that it represents a rotation again.
+		 * Note: This modifies the current quaternion. To retrieve a modified copy and leave the original unchanged, see Quaternion::normalised().
+		 */
+		void normalise();
+		/**
+		 * Create a copy of the quaternion, normalise it and return the result.
+		 */
+		Quaternion normalised() const;
+		/**
+		 * Rotate the given vector by this quaternion. This is cheaper than building a matrix, if there is only one vector to rotate.
+		 * Precondition: The quaternion is a unit quaternion.
+		 */
+		Vec3 rotate(const Vec3& vec) const;
+		/**
+		 * Retrieve a rotation matrix which performs the same rotation as the quaternion.
+		 * Precondition: The quaternion is a unit quaternion.
+		 */
+		Mat4 to_mat4() const;
+	private:
+		std::array<float, 4> quat;
+	};
+
+	/**
+	 * Interpolate between two rotations by linearly interpolating and then normalising. This is very cheap, but does not rotate at a constant rate: it is slightly faster in the middle. Where that matters, see tz::slerp.
+	 * Both quaternions should be unit quaternions. The interpolation always takes the shortest path.
+	 * @param t Interpolation factor. t == 0 gives a, t == 1 gives b (or -b, which is the same rotation).
+	 */
+	Quaternion nlerp(const Quaternion& a, const Quaternion& b, float t);
+	/**
+	 * Interpolate between two rotations at a constant angular rate.
+	 * Both quaternions should be unit quaternions. The interpolation always takes the shortest path.
+	 * @param t Interpolation factor. t == 0 gives a, t == 1 gives b (or -b, which is the same rotation).
+	 */
+	Quaternion slerp(const Quaternion& a, const Quaternion& b, float t);
+
+	/**
+	 * @}
+	 */
+}
+
+#include "core/quaternion.inl"
+#endif // TOPAZ_CORE_QUATERNION_HPP
@@ -0,0 +1,96 @@
+#include "core/assert.hpp"
+#include "core/simd.hpp"
+
+namespace tz
+{
+	constexpr Quaternion::Quaternion(float x, float y, float z, float w): quat{x, y, z, w}{}
+
+	inline const float& Quaternion::operator[](std::size_t idx) const
+	{
+		tz_assert(idx < 4, "Quaternion::operator[%zu]: Index out of range!", idx);
+		return this->quat[idx];
+	}
+
+	inline float& Quaternion::operator[](std::size_t idx)
+	{
+		tz_assert(idx < 4, "Quaternion::operator[%zu]: Index out of range!", idx);
+		return this->quat[idx];
+	}
+
+	inline Quaternion& Quaternion::operator*=(const Quaternion& rhs)
+	{
+		simd::quat_multiply(this->quat.data(), rhs.quat.data(), this->quat.data());
+		return *this;
+	}
+
+	inline Quaternion Quaternion::operator*(const Quaternion& rhs) const
+	{
+		Quaternion copy = *this;
+		copy *= rhs;
+		return copy;
+	}
+
+	inline Quaternion Quaternion::operator*(float scalar) const
+	{
+		return {this->quat[0] * scalar, this->quat[1] * scalar, this->quat[2] * scalar, this->quat[3] * scalar};
+	}
+
+	inline Quaternion Quaternion::operator+(const Quaternion& rhs) const
+	{
+		return {this->quat[0] + rhs.quat[0], this->quat[1] + rhs.quat[1], this->quat[2] + rhs.quat[2], this->quat[3] + rhs.quat[3]};
+	}
+
+	inline Quaternion Quaternion::operator-() const
+	{
+		return {-this->quat[0], -this->quat[1], -this->quat[2], -this->quat[3]};
+	}
+
+	inline bool Quaternion::operator==(const Quaternion& rhs) const
+	{
+		return this->quat == rhs.quat;
+	}
+
+	inline const float* Quaternion::data() const
+	{
+		return this->quat.data();
+	}
+
+	inline float* Quaternion::data()
+	{
+		return this->quat.data();
+	}
+
+	inline Quaternion Quaternion::conjugate() const
+	{
+		return {-this->quat[0], -this->quat[1], -this->quat[2], this->quat[3]};
+	}
+
+	inline float Quaternion::dot(const Quaternion& rhs) const
+	{
+		return simd::vec4_dot(this->quat.data(), rhs.quat.data());
+	}
+
+	inline float Quaternion::length() const
+	{
+		return simd::vec4_length(this->quat.data());
+	}
+
+	inline void Quaternion::normalise()
+	{
+		simd::vec4_normalise(this->quat.data());
+	}
+
+	inline Quaternion Quaternion::normalised() const
+	{
+		Quaternion copy = *this;
+		copy.normalise();
+		return copy;
+	}
+
+	inline Quaternion nlerp(const Quaternion& a, const Quaternion& b, float t)
+	{
+		// q and -q are the same rotation, so blend towards whichever is nearer to take the short way round.
+		float b_weight = a.dot(b) < 0.0f ? -t : t;
+		return (a * (1.0f - t) + b * b_weight).normalised();
+	}
+}
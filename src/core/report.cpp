@@ -0,0 +1,266 @@
+#include "core/report.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace tz
+{
+    namespace detail
+    {
+        /// Written in place of a record's severity when the rest of the ring is just padding, because the next record did not fit before the end.
+        constexpr std::uint32_t report_padding_marker = 0xFFFFFFFF;
+
+        /**
+         * Single-producer single-consumer byte ring. The owning thread writes records, and whichever thread holds the drain lock reads them. Positions only ever increase, and are wrapped when indexing.
+         */
+        struct ReportRing
+        {
+            static constexpr std::size_t capacity = 64 * 1024;
+
+            std::unique_ptr<std::byte[]> data = std::make_unique<std::byte[]>(capacity);
+            alignas(64) std::atomic<std::size_t> write_position{0};
+            alignas(64) std::atomic<std::size_t> read_position{0};
+            /// Set once the owning thread has exited. The ring is freed once it has been drained.
+            std::atomic<bool> owner_exited{false};
+            /// Owning thread only. Where the reserved record will end, once committed.
+            std::size_t reserved_end = 0;
+        };
+
+        void write_record(const ReportRecord& record, const std::byte* payload)
+        {
+            std::FILE* out = stdout;
+            switch(record.severity)
+            {
+                case ReportSeverity::Warning:
+                    std::fputs("[Warning] ", out);
+                break;
+                case ReportSeverity::Error:
+                    std::fputs("[Error] ", out);
+                break;
+                default:
+                break;
+            }
+            std::fputc('"', out);
+            record.format(out, record.fmt, payload);
+            std::fprintf(out, "\" -- %s:%d\n", record.file, record.line);
+        }
+
+        class Reporter
+        {
+        public:
+            Reporter():
+            rings_mutex(),
+            rings(),
+            drain_mutex(),
+            wake_mutex(),
+            wake_condition(),
+            stop(false),
+            asynchronous(true),
+            thread()
+            {
+                this->thread = std::thread{[this](){this->run();}};
+                // Anything still in a ring when the program exits would otherwise be lost.
+                std::atexit([](){Reporter::get().shutdown();});
+            }
+
+            // Never destroyed, so that reports made during static destruction still have somewhere to go.
+            static Reporter& get()
+            {
+                static Reporter* reporter = new Reporter;
+                return *reporter;
+            }
+
+            ReportRing* create_ring()
+            {
+                std::lock_guard<std::mutex> lock{this->rings_mutex};
+                return this->rings.emplace_back(std::make_unique<ReportRing>()).get();
+            }
+
+            bool is_asynchronous() const
+            {
+                return this->asynchronous.load(std::memory_order_relaxed);
+            }
+
+            void wake()
+            {
+                this->wake_condition.notify_one();
+            }
+
+            void flush()
+            {
+                this->drain();
+            }
+
+            void write_now(const ReportRecord& record, const std::byte* payload)
+            {
+                std::lock_guard<std::mutex> lock{this->drain_mutex};
+                write_record(record, payload);
+                std::fflush(stdout);
+            }
+        private:
+            void run()
+            {
+                while(true)
+                {
+                    bool wrote_anything = this->drain();
+                    std::unique_lock<std::mutex> lock{this->wake_mutex};
+                    if(this->stop)
+                    {
+                        return;
+                    }
+                    if(!wrote_anything)
+                    {
+                        // Producers only wake us when a ring is filling up, so that reporting doesn't cost a syscall every time.
+                        this->wake_condition.wait_for(lock, std::chrono::milliseconds{10});
+                    }
+                }
+            }
+
+            bool drain()
+            {
+                std::lock_guard<std::mutex> drain_lock{this->drain_mutex};
+                std::lock_guard<std::mutex> rings_lock{this->rings_mutex};
+                bool wrote_anything = false;
+                for(auto iter = this->rings.begin(); iter != this->rings.end();)
+                {
+                    ReportRing& ring = **iter;
+                    // Must be checked before reading the write position, otherwise a final record could be missed.
+                    bool owner_exited = ring.owner_exited.load(std::memory_order_acquire);
+                    std::size_t read = ring.read_position.load(std::memory_order_relaxed);
+                    std::size_t write = ring.write_position.load(std::memory_order_acquire);
+                    while(read != write)
+                    {
+                        const std::byte* record_memory = ring.data.get() + (read % ReportRing::capacity);
+                        std::uint32_t header[2];
+                        std::memcpy(header, record_memory, sizeof(header));
+                        if(header[1] != report_padding_marker)
+                        {
+                            ReportRecord record;
+                            std::memcpy(&record, record_memory, sizeof(record));
+                            write_record(record, record_memory + sizeof(ReportRecord));
+                            wrote_anything = true;
+                        }
+                        read += header[0];
+                    }
+                    ring.read_position.store(read, std::memory_order_release);
+                    if(owner_exited)
+                    {
+                        iter = this->rings.erase(iter);
+                    }
+                    else
+                    {
+                        iter++;
+                    }
+                }
+                if(wrote_anything)
+                {
+                    std::fflush(stdout);
+                }
+                return wrote_anything;
+            }
+
+            void shutdown()
+            {
+                {
+                    std::lock_guard<std::mutex> lock{this->wake_mutex};
+                    this->stop = true;
+                }
+                this->wake();
+                this->thread.join();
+                // From now on, reports are written immediately by whoever makes them.
+                this->asynchronous.store(false, std::memory_order_relaxed);
+                this->drain();
+            }
+
+            std::mutex rings_mutex;
+            std::vector<std::unique_ptr<ReportRing>> rings;
+            /// Held by whoever is reading rings or writing output.
+            std::mutex drain_mutex;
+            std::mutex wake_mutex;
+            std::condition_variable wake_condition;
+            bool stop;
+            std::atomic<bool> asynchronous;
+            std::thread thread;
+        };
+
+        // Plain pointer so it stays valid (as null) after the thread's destructors have run.
+        thread_local ReportRing* thread_ring = nullptr;
+        thread_local bool thread_exiting = false;
+
+        struct ThreadRingRelease
+        {
+            ~ThreadRingRelease()
+            {
+                if(thread_ring != nullptr)
+                {
+                    thread_ring->owner_exited.store(true, std::memory_order_release);
+                }
+                thread_ring = nullptr;
+                thread_exiting = true;
+            }
+        };
+        thread_local ThreadRingRelease thread_ring_release;
+
+        std::byte* report_reserve(std::size_t size)
+        {
+            Reporter& reporter = Reporter::get();
+            // Half the capacity at most, so that a record plus the padding before it always fits in an empty ring.
+            if(thread_exiting || !reporter.is_asynchronous() || size > ReportRing::capacity / 2)
+            {
+                return nullptr;
+            }
+            if(thread_ring == nullptr)
+            {
+                thread_ring = reporter.create_ring();
+                // Make sure this thread's release actually gets constructed, so it runs on exit.
+                (void)thread_ring_release;
+            }
+            ReportRing& ring = *thread_ring;
+            std::size_t write = ring.write_position.load(std::memory_order_relaxed);
+            std::size_t contiguous = ReportRing::capacity - (write % ReportRing::capacity);
+            std::size_t padding = size > contiguous ? contiguous : 0;
+            while(ReportRing::capacity - (write - ring.read_position.load(std::memory_order_acquire)) < padding + size)
+            {
+                // Full. Get the background thread to make some room.
+                if(!reporter.is_asynchronous())
+                {
+                    return nullptr;
+                }
+                reporter.wake();
+                std::this_thread::yield();
+            }
+            if(padding > 0)
+            {
+                std::uint32_t header[2]{static_cast<std::uint32_t>(padding), report_padding_marker};
+                std::memcpy(ring.data.get() + (write % ReportRing::capacity), header, sizeof(header));
+                write += padding;
+            }
+            ring.reserved_end = write + size;
+            return ring.data.get() + (write % ReportRing::capacity);
+        }
+
+        void report_commit()
+        {
+            ReportRing& ring = *thread_ring;
+            ring.write_position.store(ring.reserved_end, std::memory_order_release);
+            if(ring.reserved_end - ring.read_position.load(std::memory_order_relaxed) > ReportRing::capacity / 2)
+            {
+                Reporter::get().wake();
+            }
+        }
+
+        void report_write(const ReportRecord& record, const std::byte* payload)
+        {
+            Reporter::get().write_now(record, payload);
+        }
+    }
+
+    void report_flush()
+    {
+        detail::Reporter::get().flush();
+    }
+}
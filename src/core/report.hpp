@@ -1,26 +1,124 @@
+#ifndef TOPAZ_CORE_REPORT_HPP
+#define TOPAZ_CORE_REPORT_HPP
+#include <cstddef>
+#include <cstdint>
 #include <cstdio>
-#include <utility>
 
 namespace tz
 {
-    template<typename... Args>
-    void report_internal(const char* fmt, Args&&... args)
+    /**
+     * \addtogroup tz_core Topaz Core Library (tz)
+     * A collection of platform-agnostic core interfaces.
+     * @{
+     */
+
+    /**
+     * @brief How important a report is. Reports below TZ_REPORT_MIN_SEVERITY are compiled out entirely.
+     */
+    enum class ReportSeverity : std::uint32_t
+    {
+        /// Reported via tz_debug_report.
+        Debug = 0,
+        /// Reported via tz_report.
+        Info = 1,
+        /// Reported via tz_warning_report.
+        Warning = 2,
+        /// Reported via tz_error_report.
+        Error = 3
+    };
+
+    /**
+     * @brief Block until every report made so far (by any thread) has been written out.
+     * @details Reports are formatted and written by a background thread, so by default they may appear some time after the call that made them. Anything about to bring the program down should flush first.
+     */
+    void report_flush();
+
+    /**
+     * @}
+     */
+
+    namespace detail
     {
-        std::fflush(stdout);
-        std::fprintf(stdout, fmt, std::forward<Args>(args)...);
+        using ReportFormatFunction = void(*)(std::FILE* out, const char* fmt, const std::byte* payload);
+
+        /**
+         * Sits at the start of every record in a thread's report ring. The packed arguments follow immediately after.
+         */
+        struct ReportRecord
+        {
+            /// Bytes up to the next record, including this header and the arguments.
+            std::uint32_t size;
+            ReportSeverity severity;
+            ReportFormatFunction format;
+            const char* fmt;
+            const char* file;
+            int line;
+        };
+
+        /**
+         * Reserve space for a record in the calling thread's ring, waiting for the background thread to make room if need be. Returns nullptr if the record could never fit, or if reports are no longer being written asynchronously (e.g during shutdown).
+         */
+        std::byte* report_reserve(std::size_t size);
+        /**
+         * Hand the most recently reserved record over to the background thread.
+         */
+        void report_commit();
+        /**
+         * Format and write a record immediately, on the calling thread.
+         */
+        void report_write(const ReportRecord& record, const std::byte* payload);
     }
+
+    template<typename... Args>
+    void report_internal(ReportSeverity severity, const char* file, int line, const char* fmt, Args&&... args);
 }
 
+/**
+ * TZ_REPORT_MIN_SEVERITY is the least severe @ref tz::ReportSeverity which is not compiled out. 0 = Debug, 1 = Info, 2 = Warning, 3 = Error. If not specified, debug builds report everything, and release builds drop debug reports.
+ */
+#ifndef TZ_REPORT_MIN_SEVERITY
+    #if TZ_DEBUG
+        #define TZ_REPORT_MIN_SEVERITY 0
+    #else
+        #define TZ_REPORT_MIN_SEVERITY 1
+    #endif
+#endif
+
 #ifdef tz_report
 #undef tz_report
 #endif
-#define tz_report(fmt, ...) {tz::report_internal("\"" fmt "\" -- %s:%d\n", ##__VA_ARGS__, __FILE__, __LINE__);} (void)0;
+#if TZ_REPORT_MIN_SEVERITY <= 1
+    #define tz_report(fmt, ...) {tz::report_internal(tz::ReportSeverity::Info, __FILE__, __LINE__, "" fmt, ##__VA_ARGS__);} (void)0;
+#else
+    #define tz_report(fmt, ...) (void)0
+#endif
 
 #ifdef tz_debug_report
 #undef tz_debug_report
 #endif
-#if TZ_DEBUG
-    #define tz_debug_report(fmt, ...) tz_report(fmt, ##__VA_ARGS__)
+#if TZ_DEBUG && TZ_REPORT_MIN_SEVERITY <= 0
+    #define tz_debug_report(fmt, ...) {tz::report_internal(tz::ReportSeverity::Debug, __FILE__, __LINE__, "" fmt, ##__VA_ARGS__);} (void)0;
 #else
     #define tz_debug_report(fmt, ...) (void)0
-#endif
\ No newline at end of file
+#endif
+
+#ifdef tz_warning_report
+#undef tz_warning_report
+#endif
+#if TZ_REPORT_MIN_SEVERITY <= 2
+    #define tz_warning_report(fmt, ...) {tz::report_internal(tz::ReportSeverity::Warning, __FILE__, __LINE__, "" fmt, ##__VA_ARGS__);} (void)0;
+#else
+    #define tz_warning_report(fmt, ...) (void)0
+#endif
+
+#ifdef tz_error_report
+#undef tz_error_report
+#endif
+#if TZ_REPORT_MIN_SEVERITY <= 3
+    #define tz_error_report(fmt, ...) {tz::report_internal(tz::ReportSeverity::Error, __FILE__, __LINE__, "" fmt, ##__VA_ARGS__);} (void)0;
+#else
+    #define tz_error_report(fmt, ...) (void)0
+#endif
+
+#include "core/report.inl"
+#endif // TOPAZ_CORE_REPORT_HPP
@@ -0,0 +1,102 @@
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace tz
+{
+    namespace detail
+    {
+        template<typename T>
+        constexpr bool is_report_string = std::is_same_v<T, const char*> || std::is_same_v<T, char*>;
+
+        template<typename T>
+        concept ReportArgument = std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>;
+
+        // Strings are copied into the record, as they might not outlive the call (e.g std::string::c_str()). Everything else is copied as-is.
+        template<ReportArgument T>
+        std::size_t report_packed_size(T arg)
+        {
+            if constexpr(is_report_string<T>)
+            {
+                return sizeof(std::uint32_t) + std::strlen(arg == nullptr ? "(null)" : arg) + 1;
+            }
+            else
+            {
+                return sizeof(T);
+            }
+        }
+
+        template<ReportArgument T>
+        std::byte* report_pack(std::byte* cursor, T arg)
+        {
+            if constexpr(is_report_string<T>)
+            {
+                const char* str = arg == nullptr ? "(null)" : arg;
+                auto length = static_cast<std::uint32_t>(std::strlen(str) + 1);
+                std::memcpy(cursor, &length, sizeof(length));
+                std::memcpy(cursor + sizeof(length), str, length);
+                return cursor + sizeof(length) + length;
+            }
+            else
+            {
+                std::memcpy(cursor, &arg, sizeof(T));
+                return cursor + sizeof(T);
+            }
+        }
+
+        template<ReportArgument T>
+        auto report_unpack(const std::byte*& cursor)
+        {
+            if constexpr(is_report_string<T>)
+            {
+                std::uint32_t length;
+                std::memcpy(&length, cursor, sizeof(length));
+                const char* str = reinterpret_cast<const char*>(cursor + sizeof(length));
+                cursor += sizeof(length) + length;
+                return str;
+            }
+            else
+            {
+                T arg;
+                std::memcpy(&arg, cursor, sizeof(T));
+                cursor += sizeof(T);
+                return arg;
+            }
+        }
+
+        template<ReportArgument... Args>
+        void report_format(std::FILE* out, const char* fmt, const std::byte* payload)
+        {
+            const std::byte* cursor = payload;
+            // Braced initialisation is evaluated left-to-right, so the arguments are unpacked in the order they were packed.
+            std::tuple<decltype(report_unpack<Args>(cursor))...> args{report_unpack<Args>(cursor)...};
+            std::apply([out, fmt](auto... unpacked){std::fprintf(out, fmt, unpacked...);}, args);
+        }
+    }
+
+    template<typename... Args>
+    void report_internal(ReportSeverity severity, const char* file, int line, const char* fmt, Args&&... args)
+    {
+        static_assert((detail::ReportArgument<std::decay_t<Args>> && ...), "tz_report: Arguments must be numbers, enums or pointers (strings are copied)");
+        std::size_t payload_size = (std::size_t{0} + ... + detail::report_packed_size<std::decay_t<Args>>(args));
+        detail::ReportRecord record{.size = 0, .severity = severity, .format = &detail::report_format<std::decay_t<Args>...>, .fmt = fmt, .file = file, .line = line};
+        // Keep the next record's header aligned.
+        std::size_t record_size = (sizeof(detail::ReportRecord) + payload_size + alignof(detail::ReportRecord) - 1) / alignof(detail::ReportRecord) * alignof(detail::ReportRecord);
+        record.size = static_cast<std::uint32_t>(record_size);
+
+        std::byte* memory = detail::report_reserve(record_size);
+        if(memory == nullptr)
+        {
+            std::vector<std::byte> payload(payload_size);
+            [[maybe_unused]] std::byte* cursor = payload.data();
+            ((cursor = detail::report_pack<std::decay_t<Args>>(cursor, args)), ...);
+            detail::report_write(record, payload.data());
+            return;
+        }
+        std::memcpy(memory, &record, sizeof(record));
+        [[maybe_unused]] std::byte* cursor = memory + sizeof(record);
+        ((cursor = detail::report_pack<std::decay_t<Args>>(cursor, args)), ...);
+        detail::report_commit();
+    }
+}
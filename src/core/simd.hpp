@@ -0,0 +1,76 @@
+#ifndef TOPAZ_CORE_SIMD_HPP
+#define TOPAZ_CORE_SIMD_HPP
+#include <cstddef>
+
+/**
+ * TZ_SIMD selects the instruction set used by the Mat4/Vec4 kernels. It is normally set by the TOPAZ_SIMD CMake option. If left unset, the best instruction set the compiler is already targeting is used.
+ * There are only x86-64 kernels so far. Other targets, such as aarch64, use the scalar kernels.
+ */
+#define TZ_SIMD_SCALAR 0
+#define TZ_SIMD_SSE2 1
+#define TZ_SIMD_AVX2 2
+
+#ifndef TZ_SIMD
+    #if defined(__AVX2__) && defined(__FMA__)
+        #define TZ_SIMD TZ_SIMD_AVX2
+    #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define TZ_SIMD TZ_SIMD_SSE2
+    #else
+        #define TZ_SIMD TZ_SIMD_SCALAR
+    #endif
+#endif
+
+#if TZ_SIMD == TZ_SIMD_AVX2
+    #if !defined(__AVX2__) || !defined(__FMA__)
+        #error "TZ_SIMD is AVX2, but the compiler is not targeting AVX2 and FMA (-mavx2 -mfma or /arch:AVX2)"
+    #endif
+    #include <immintrin.h>
+#elif TZ_SIMD == TZ_SIMD_SSE2
+    #include <emmintrin.h>
+#endif
+
+namespace tz::simd
+{
+    /**
+     * @brief Kernels for 4x4 float matrices, 4/3-element float vectors and quaternions. @ref tz::Matrix, @ref tz::Vector and @ref tz::Quaternion use these automatically for Mat4, Vec4 and Vec3, so there's normally no need to call them directly.
+     * @details Matrices are column-major (the same layout as tz::Matrix). No pointer needs to be aligned, and outputs may alias inputs.
+     */
+
+    /// Retrieve the name of the instruction set in use, e.g "SSE2".
+    constexpr const char* get_instruction_set_name();
+
+    /// out = lhs * rhs
+    inline void mat4_multiply(const float* lhs, const float* rhs, float* out);
+    /// out[i] = dot(column i of m, v). This matches tz::Matrix::operator*(Vector).
+    inline void mat4_columns_dot(const float* m, const float* v, float* out);
+    /// out = inverse(m). Returns the determinant of m. If it is zero, m has no inverse and out is left unchanged.
+    inline float mat4_inverse(const float* m, float* out);
+    inline float vec4_dot(const float* lhs, const float* rhs);
+    inline float vec4_length(const float* v);
+    /// Does nothing if v has zero length.
+    inline void vec4_normalise(float* v);
+    inline void vec3_cross(const float* lhs, const float* rhs, float* out);
+    /// out = lhs * rhs, where each is a quaternion stored as (x, y, z, w).
+    inline void quat_multiply(const float* lhs, const float* rhs, float* out);
+    /// out[i] = tz::model(positions[i], rotations[i], scales[i]) for each i < count. positions, rotations and scales are each count packed (x, y, z) triples, and out is count packed Mat4s. SSE2 and AVX2 compute four models at a time.
+    inline void mat4_model_batch(const float* positions, const float* rotations, const float* scales, float* out, std::size_t count);
+
+    /**
+     * @brief The same kernels, implemented exactly as the generic tz::Matrix/tz::Vector templates do it. Always available, regardless of TZ_SIMD.
+     */
+    namespace scalar
+    {
+        inline void mat4_multiply(const float* lhs, const float* rhs, float* out);
+        inline void mat4_columns_dot(const float* m, const float* v, float* out);
+        inline float mat4_inverse(const float* m, float* out);
+        inline float vec4_dot(const float* lhs, const float* rhs);
+        inline float vec4_length(const float* v);
+        inline void vec4_normalise(float* v);
+        inline void vec3_cross(const float* lhs, const float* rhs, float* out);
+        inline void quat_multiply(const float* lhs, const float* rhs, float* out);
+        inline void mat4_model_batch(const float* positions, const float* rotations, const float* scales, float* out, std::size_t count);
+    }
+}
+
+#include "core/simd.inl"
+#endif // TOPAZ_CORE_SIMD_HPP
@@ -0,0 +1,592 @@
+#include <cmath>
+
+namespace tz::simd
+{
+    constexpr const char* get_instruction_set_name()
+    {
+        #if TZ_SIMD == TZ_SIMD_AVX2
+            return "AVX2";
+        #elif TZ_SIMD == TZ_SIMD_SSE2
+            return "SSE2";
+        #else
+            return "Scalar";
+        #endif
+    }
+
+    namespace scalar
+    {
+        inline void mat4_multiply(const float* lhs, const float* rhs, float* out)
+        {
+            float result[16];
+            for(std::size_t column = 0; column < 4; column++)
+            {
+                for(std::size_t row = 0; row < 4; row++)
+                {
+                    float element = 0.0f;
+                    for(std::size_t k = 0; k < 4; k++)
+                    {
+                        element += lhs[k * 4 + row] * rhs[column * 4 + k];
+                    }
+                    result[column * 4 + row] = element;
+                }
+            }
+            for(std::size_t i = 0; i < 16; i++)
+            {
+                out[i] = result[i];
+            }
+        }
+
+        inline void mat4_columns_dot(const float* m, const float* v, float* out)
+        {
+            float result[4];
+            for(std::size_t i = 0; i < 4; i++)
+            {
+                result[i] = vec4_dot(m + i * 4, v);
+            }
+            for(std::size_t i = 0; i < 4; i++)
+            {
+                out[i] = result[i];
+            }
+        }
+
+        inline float mat4_inverse(const float* m, float* out)
+        {
+            // Cofactor expansion. The inverse of the transpose is the transpose of the inverse, so this doesn't care whether m is row or column-major.
+            float inv[16];
+            inv[0] = m[5] * m[10] * m[15] -
+                    m[5] * m[11] * m[14] -
+                    m[9] * m[6]  * m[15] +
+                    m[9] * m[7]  * m[14] +
+                    m[13] * m[6] * m[11] -
+                    m[13] * m[7] * m[10];
+
+            inv[4] = -m[4]  * m[10] * m[15] +
+                    m[4]  * m[11] * m[14] +
+                    m[8]  * m[6]  * m[15] -
+                    m[8]  * m[7]  * m[14] -
+                    m[12] * m[6]  * m[11] +
+                    m[12] * m[7]  * m[10];
+
+            inv[8] = m[4]  * m[9] * m[15] -
+                    m[4]  * m[11] * m[13] -
+                    m[8]  * m[5] * m[15] +
+                    m[8]  * m[7] * m[13] +
+                    m[12] * m[5] * m[11] -
+                    m[12] * m[7] * m[9];
+
+            inv[12] = -m[4]  * m[9] * m[14] +
+                    m[4]  * m[10] * m[13] +
+                    m[8]  * m[5] * m[14] -
+                    m[8]  * m[6] * m[13] -
+                    m[12] * m[5] * m[10] +
+                    m[12] * m[6] * m[9];
+
+            inv[1] = -m[1]  * m[10] * m[15] +
+                    m[1]  * m[11] * m[14] +
+                    m[9]  * m[2] * m[15] -
+                    m[9]  * m[3] * m[14] -
+                    m[13] * m[2] * m[11] +
+                    m[13] * m[3] * m[10];
+
+            inv[5] = m[0]  * m[10] * m[15] -
+                    m[0]  * m[11] * m[14] -
+                    m[8]  * m[2] * m[15] +
+                    m[8]  * m[3] * m[14] +
+                    m[12] * m[2] * m[11] -
+                    m[12] * m[3] * m[10];
+
+            inv[9] = -m[0]  * m[9] * m[15] +
+                    m[0]  * m[11] * m[13] +
+                    m[8]  * m[1] * m[15] -
+                    m[8]  * m[3] * m[13] -
+                    m[12] * m[1] * m[11] +
+                    m[12] * m[3] * m[9];
+
+            inv[13] = m[0]  * m[9] * m[14] -
+                    m[0]  * m[10] * m[13] -
+                    m[8]  * m[1] * m[14] +
+                    m[8]  * m[2] * m[13] +
+                    m[12] * m[1] * m[10] -
+                    m[12] * m[2] * m[9];
+
+            inv[2] = m[1]  * m[6] * m[15] -
+                    m[1]  * m[7] * m[14] -
+                    m[5]  * m[2] * m[15] +
+                    m[5]  * m[3] * m[14] +
+                    m[13] * m[2] * m[7] -
+                    m[13] * m[3] * m[6];
+
+            inv[6] = -m[0]  * m[6] * m[15] +
+                    m[0]  * m[7] * m[14] +
+                    m[4]  * m[2] * m[15] -
+                    m[4]  * m[3] * m[14] -
+                    m[12] * m[2] * m[7] +
+                    m[12] * m[3] * m[6];
+
+            inv[10] = m[0]  * m[5] * m[15] -
+                    m[0]  * m[7] * m[13] -
+                    m[4]  * m[1] * m[15] +
+                    m[4]  * m[3] * m[13] +
+                    m[12] * m[1] * m[7] -
+                    m[12] * m[3] * m[5];
+
+            inv[14] = -m[0]  * m[5] * m[14] +
+                    m[0]  * m[6] * m[13] +
+                    m[4]  * m[1] * m[14] -
+                    m[4]  * m[2] * m[13] -
+                    m[12] * m[1] * m[6] +
+                    m[12] * m[2] * m[5];
+
+            inv[3] = -m[1] * m[6] * m[11] +
+                    m[1] * m[7] * m[10] +
+                    m[5] * m[2] * m[11] -
+                    m[5] * m[3] * m[10] -
+                    m[9] * m[2] * m[7] +
+                    m[9] * m[3] * m[6];
+
+            inv[7] = m[0] * m[6] * m[11] -
+                    m[0] * m[7] * m[10] -
+                    m[4] * m[2] * m[11] +
+                    m[4] * m[3] * m[10] +
+                    m[8] * m[2] * m[7] -
+                    m[8] * m[3] * m[6];
+
+            inv[11] = -m[0] * m[5] * m[11] +
+                    m[0] * m[7] * m[9] +
+                    m[4] * m[1] * m[11] -
+                    m[4] * m[3] * m[9] -
+                    m[8] * m[1] * m[7] +
+                    m[8] * m[3] * m[5];
+
+            inv[15] = m[0] * m[5] * m[10] -
+                    m[0] * m[6] * m[9] -
+                    m[4] * m[1] * m[10] +
+                    m[4] * m[2] * m[9] +
+                    m[8] * m[1] * m[6] -
+                    m[8] * m[2] * m[5];
+
+            float determinant = m[0] * inv[0] + m[1] * inv[4] + m[2] * inv[8] + m[3] * inv[12];
+            if(determinant == 0.0f) [[unlikely]]
+            {
+                return determinant;
+            }
+            float reciprocal = 1.0f / determinant;
+            for(std::size_t i = 0; i < 16; i++)
+            {
+                out[i] = inv[i] * reciprocal;
+            }
+            return determinant;
+        }
+
+        inline float vec4_dot(const float* lhs, const float* rhs)
+        {
+            float sum = 0.0f;
+            for(std::size_t i = 0; i < 4; i++)
+            {
+                sum += lhs[i] * rhs[i];
+            }
+            return sum;
+        }
+
+        inline float vec4_length(const float* v)
+        {
+            return std::sqrt(vec4_dot(v, v));
+        }
+
+        inline void vec4_normalise(float* v)
+        {
+            float length = vec4_length(v);
+            if(length == 0.0f) [[unlikely]]
+            {
+                return;
+            }
+            for(std::size_t i = 0; i < 4; i++)
+            {
+                v[i] /= length;
+            }
+        }
+
+        inline void vec3_cross(const float* lhs, const float* rhs, float* out)
+        {
+            float result[3]
+            {
+                (lhs[1] * rhs[2]) - (lhs[2] * rhs[1]),
+                (lhs[2] * rhs[0]) - (lhs[0] * rhs[2]),
+                (lhs[0] * rhs[1]) - (lhs[1] * rhs[0])
+            };
+            out[0] = result[0];
+            out[1] = result[1];
+            out[2] = result[2];
+        }
+
+        inline void quat_multiply(const float* lhs, const float* rhs, float* out)
+        {
+            float result[4]
+            {
+                lhs[3] * rhs[0] + lhs[0] * rhs[3] + lhs[1] * rhs[2] - lhs[2] * rhs[1],
+                lhs[3] * rhs[1] - lhs[0] * rhs[2] + lhs[1] * rhs[3] + lhs[2] * rhs[0],
+                lhs[3] * rhs[2] + lhs[0] * rhs[1] - lhs[1] * rhs[0] + lhs[2] * rhs[3],
+                lhs[3] * rhs[3] - lhs[0] * rhs[0] - lhs[1] * rhs[1] - lhs[2] * rhs[2]
+            };
+            for(std::size_t i = 0; i < 4; i++)
+            {
+                out[i] = result[i];
+            }
+        }
+
+        inline void mat4_model_batch(const float* positions, const float* rotations, const float* scales, float* out, std::size_t count)
+        {
+            for(std::size_t i = 0; i < count; i++)
+            {
+                const float* p = positions + i * 3;
+                const float* r = rotations + i * 3;
+                const float* s = scales + i * 3;
+                float* m = out + i * 16;
+                float sin_x = std::sin(r[0]), cos_x = std::cos(r[0]);
+                float sin_y = std::sin(r[1]), cos_y = std::cos(r[1]);
+                float sin_z = std::sin(r[2]), cos_z = std::cos(r[2]);
+                // translate * rotate_z * rotate_y * rotate_x * scale, multiplied out by hand. Column j of the rotation is scaled by s[j].
+                m[0] = cos_z * cos_y * s[0];
+                m[1] = sin_z * cos_y * s[0];
+                m[2] = -sin_y * s[0];
+                m[3] = 0.0f;
+                m[4] = (cos_z * sin_y * sin_x - sin_z * cos_x) * s[1];
+                m[5] = (sin_z * sin_y * sin_x + cos_z * cos_x) * s[1];
+                m[6] = cos_y * sin_x * s[1];
+                m[7] = 0.0f;
+                m[8] = (cos_z * sin_y * cos_x + sin_z * sin_x) * s[2];
+                m[9] = (sin_z * sin_y * cos_x - cos_z * sin_x) * s[2];
+                m[10] = cos_y * cos_x * s[2];
+                m[11] = 0.0f;
+                m[12] = p[0];
+                m[13] = p[1];
+                m[14] = p[2];
+                m[15] = 1.0f;
+            }
+        }
+    }
+
+    #if TZ_SIMD == TZ_SIMD_SSE2 || TZ_SIMD == TZ_SIMD_AVX2
+        namespace detail
+        {
+            // Every lane holds the sum of all four lanes of v.
+            inline __m128 sum_lanes(__m128 v)
+            {
+                __m128 sums = _mm_add_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+                return _mm_add_ps(sums, _mm_shuffle_ps(sums, sums, _MM_SHUFFLE(1, 0, 3, 2)));
+            }
+
+            inline __m128 multiply_add(__m128 a, __m128 b, __m128 c)
+            {
+                #if TZ_SIMD == TZ_SIMD_AVX2
+                    return _mm_fmadd_ps(a, b, c);
+                #else
+                    return _mm_add_ps(_mm_mul_ps(a, b), c);
+                #endif
+            }
+
+            // (a[X], a[Y], b[Z], b[W])
+            template<int X, int Y, int Z, int W>
+            inline __m128 shuffle(__m128 a, __m128 b)
+            {
+                return _mm_shuffle_ps(a, b, _MM_SHUFFLE(W, Z, Y, X));
+            }
+
+            template<int X, int Y, int Z, int W>
+            inline __m128 swizzle(__m128 v)
+            {
+                return shuffle<X, Y, Z, W>(v, v);
+            }
+
+            // The mat2 helpers work on 2x2 matrices packed into a register as (m00, m01, m10, m11).
+            // lhs * rhs
+            inline __m128 mat2_multiply(__m128 lhs, __m128 rhs)
+            {
+                return _mm_add_ps(_mm_mul_ps(lhs, swizzle<0, 3, 0, 3>(rhs)), _mm_mul_ps(swizzle<1, 0, 3, 2>(lhs), swizzle<2, 1, 2, 1>(rhs)));
+            }
+
+            // adjugate(lhs) * rhs
+            inline __m128 mat2_adjugate_multiply(__m128 lhs, __m128 rhs)
+            {
+                return _mm_sub_ps(_mm_mul_ps(swizzle<3, 3, 0, 0>(lhs), rhs), _mm_mul_ps(swizzle<1, 1, 2, 2>(lhs), swizzle<2, 3, 0, 1>(rhs)));
+            }
+
+            // lhs * adjugate(rhs)
+            inline __m128 mat2_multiply_adjugate(__m128 lhs, __m128 rhs)
+            {
+                return _mm_sub_ps(_mm_mul_ps(lhs, swizzle<3, 0, 3, 0>(rhs)), _mm_mul_ps(swizzle<1, 0, 3, 2>(lhs), swizzle<2, 1, 2, 1>(rhs)));
+            }
+
+            // Cephes' single-precision sinf/cosf, four at a time. Accurate to a couple of ulps for |x| up to a few thousand radians.
+            inline void sincos(__m128 x, __m128& sin_out, __m128& cos_out)
+            {
+                const __m128 sign_mask = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000u)));
+                __m128 sin_sign = _mm_and_ps(x, sign_mask);
+                x = _mm_andnot_ps(sign_mask, x);
+                // Reduce into [-pi/4, pi/4] and note which octant x was in.
+                __m128i octant = _mm_cvttps_epi32(_mm_mul_ps(x, _mm_set1_ps(1.27323954473516f)));
+                octant = _mm_and_si128(_mm_add_epi32(octant, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+                __m128 y = _mm_cvtepi32_ps(octant);
+                sin_sign = _mm_xor_ps(sin_sign, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(octant, _mm_set1_epi32(4)), 29)));
+                __m128 cos_sign = _mm_castsi128_ps(_mm_slli_epi32(_mm_andnot_si128(_mm_sub_epi32(octant, _mm_set1_epi32(2)), _mm_set1_epi32(4)), 29));
+                __m128 use_sin_polynomial = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(octant, _mm_set1_epi32(2)), _mm_setzero_si128()));
+                x = multiply_add(y, _mm_set1_ps(-0.78515625f), x);
+                x = multiply_add(y, _mm_set1_ps(-2.4187564849853515625e-4f), x);
+                x = multiply_add(y, _mm_set1_ps(-3.77489497744594108e-8f), x);
+
+                __m128 z = _mm_mul_ps(x, x);
+                __m128 cos_polynomial = multiply_add(_mm_set1_ps(2.443315711809948e-5f), z, _mm_set1_ps(-1.388731625493765e-3f));
+                cos_polynomial = multiply_add(cos_polynomial, z, _mm_set1_ps(4.166664568298827e-2f));
+                cos_polynomial = _mm_mul_ps(_mm_mul_ps(cos_polynomial, z), z);
+                cos_polynomial = _mm_add_ps(_mm_sub_ps(cos_polynomial, _mm_mul_ps(z, _mm_set1_ps(0.5f))), _mm_set1_ps(1.0f));
+                __m128 sin_polynomial = multiply_add(_mm_set1_ps(-1.9515295891e-4f), z, _mm_set1_ps(8.3321608736e-3f));
+                sin_polynomial = multiply_add(sin_polynomial, z, _mm_set1_ps(-1.6666654611e-1f));
+                sin_polynomial = multiply_add(_mm_mul_ps(sin_polynomial, z), x, x);
+
+                __m128 sin = _mm_or_ps(_mm_and_ps(use_sin_polynomial, sin_polynomial), _mm_andnot_ps(use_sin_polynomial, cos_polynomial));
+                __m128 cos = _mm_or_ps(_mm_and_ps(use_sin_polynomial, cos_polynomial), _mm_andnot_ps(use_sin_polynomial, sin_polynomial));
+                sin_out = _mm_xor_ps(sin, sin_sign);
+                cos_out = _mm_xor_ps(cos, cos_sign);
+            }
+
+            // Load four packed (x, y, z) triples and split them into one register per component.
+            inline void load_xyz4(const float* xyz, __m128& x, __m128& y, __m128& z)
+            {
+                __m128 a = _mm_loadu_ps(xyz);
+                __m128 b = _mm_loadu_ps(xyz + 4);
+                __m128 c = _mm_loadu_ps(xyz + 8);
+                x = shuffle<0, 3, 0, 2>(a, shuffle<2, 2, 1, 1>(b, c));
+                y = shuffle<0, 2, 0, 2>(shuffle<1, 1, 0, 0>(a, b), shuffle<3, 3, 2, 2>(b, c));
+                z = shuffle<0, 2, 0, 2>(shuffle<2, 2, 1, 1>(a, b), shuffle<0, 0, 3, 3>(c, c));
+            }
+        }
+
+        inline void mat4_multiply(const float* lhs, const float* rhs, float* out)
+        {
+            __m128 c0 = _mm_loadu_ps(lhs);
+            __m128 c1 = _mm_loadu_ps(lhs + 4);
+            __m128 c2 = _mm_loadu_ps(lhs + 8);
+            __m128 c3 = _mm_loadu_ps(lhs + 12);
+            __m128 result[4];
+            for(std::size_t i = 0; i < 4; i++)
+            {
+                // Column i of the result is a combination of lhs' columns, weighted by column i of rhs.
+                __m128 r = _mm_loadu_ps(rhs + i * 4);
+                __m128 x = _mm_mul_ps(c0, _mm_shuffle_ps(r, r, _MM_SHUFFLE(0, 0, 0, 0)));
+                x = detail::multiply_add(c1, _mm_shuffle_ps(r, r, _MM_SHUFFLE(1, 1, 1, 1)), x);
+                x = detail::multiply_add(c2, _mm_shuffle_ps(r, r, _MM_SHUFFLE(2, 2, 2, 2)), x);
+                result[i] = detail::multiply_add(c3, _mm_shuffle_ps(r, r, _MM_SHUFFLE(3, 3, 3, 3)), x);
+            }
+            for(std::size_t i = 0; i < 4; i++)
+            {
+                _mm_storeu_ps(out + i * 4, result[i]);
+            }
+        }
+
+        inline void mat4_columns_dot(const float* m, const float* v, float* out)
+        {
+            __m128 c0 = _mm_loadu_ps(m);
+            __m128 c1 = _mm_loadu_ps(m + 4);
+            __m128 c2 = _mm_loadu_ps(m + 8);
+            __m128 c3 = _mm_loadu_ps(m + 12);
+            // Four dot products at once: transpose so that lane i of t_k is element k of column i.
+            _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+            __m128 vec = _mm_loadu_ps(v);
+            __m128 x = _mm_mul_ps(c0, _mm_shuffle_ps(vec, vec, _MM_SHUFFLE(0, 0, 0, 0)));
+            x = detail::multiply_add(c1, _mm_shuffle_ps(vec, vec, _MM_SHUFFLE(1, 1, 1, 1)), x);
+            x = detail::multiply_add(c2, _mm_shuffle_ps(vec, vec, _MM_SHUFFLE(2, 2, 2, 2)), x);
+            x = detail::multiply_add(c3, _mm_shuffle_ps(vec, vec, _MM_SHUFFLE(3, 3, 3, 3)), x);
+            _mm_storeu_ps(out, x);
+        }
+
+        inline float mat4_inverse(const float* m, float* out)
+        {
+            // Blockwise inversion: treat m as the 2x2 blocks |A B; C D| and invert through their adjugates and determinants.
+            // As with the scalar kernel, this works on either layout because inverting the transpose gives the transposed inverse.
+            __m128 c0 = _mm_loadu_ps(m);
+            __m128 c1 = _mm_loadu_ps(m + 4);
+            __m128 c2 = _mm_loadu_ps(m + 8);
+            __m128 c3 = _mm_loadu_ps(m + 12);
+            __m128 a = detail::shuffle<0, 1, 0, 1>(c0, c1);
+            __m128 b = detail::shuffle<2, 3, 2, 3>(c0, c1);
+            __m128 c = detail::shuffle<0, 1, 0, 1>(c2, c3);
+            __m128 d = detail::shuffle<2, 3, 2, 3>(c2, c3);
+
+            // (|A|, |B|, |C|, |D|)
+            __m128 block_determinants = _mm_sub_ps
+            (
+                _mm_mul_ps(detail::shuffle<0, 2, 0, 2>(c0, c2), detail::shuffle<1, 3, 1, 3>(c1, c3)),
+                _mm_mul_ps(detail::shuffle<1, 3, 1, 3>(c0, c2), detail::shuffle<0, 2, 0, 2>(c1, c3))
+            );
+            __m128 det_a = detail::swizzle<0, 0, 0, 0>(block_determinants);
+            __m128 det_b = detail::swizzle<1, 1, 1, 1>(block_determinants);
+            __m128 det_c = detail::swizzle<2, 2, 2, 2>(block_determinants);
+            __m128 det_d = detail::swizzle<3, 3, 3, 3>(block_determinants);
+
+            __m128 adj_d_c = detail::mat2_adjugate_multiply(d, c);
+            __m128 adj_a_b = detail::mat2_adjugate_multiply(a, b);
+            // The adjugates of the result's blocks |X Y; Z W|, before dividing by |M|.
+            __m128 x = _mm_sub_ps(_mm_mul_ps(det_d, a), detail::mat2_multiply(b, adj_d_c));
+            __m128 w = _mm_sub_ps(_mm_mul_ps(det_a, d), detail::mat2_multiply(c, adj_a_b));
+            __m128 y = _mm_sub_ps(_mm_mul_ps(det_b, c), detail::mat2_multiply_adjugate(d, adj_a_b));
+            __m128 z = _mm_sub_ps(_mm_mul_ps(det_c, b), detail::mat2_multiply_adjugate(a, adj_d_c));
+
+            // |M| = |A||D| + |B||C| - tr(adjugate(A)B adjugate(D)C)
+            __m128 trace = detail::sum_lanes(_mm_mul_ps(adj_a_b, detail::swizzle<0, 2, 1, 3>(adj_d_c)));
+            __m128 determinant = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(det_a, det_d), _mm_mul_ps(det_b, det_c)), trace);
+            if(_mm_cvtss_f32(determinant) == 0.0f) [[unlikely]]
+            {
+                return 0.0f;
+            }
+            // Taking the adjugates of X, Y, Z and W flips the sign of their off-diagonals.
+            __m128 reciprocal = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), determinant);
+            x = _mm_mul_ps(x, reciprocal);
+            y = _mm_mul_ps(y, reciprocal);
+            z = _mm_mul_ps(z, reciprocal);
+            w = _mm_mul_ps(w, reciprocal);
+            // ...and swaps their diagonals, which folds into the shuffles that put the blocks back together.
+            _mm_storeu_ps(out, detail::shuffle<3, 1, 3, 1>(x, y));
+            _mm_storeu_ps(out + 4, detail::shuffle<2, 0, 2, 0>(x, y));
+            _mm_storeu_ps(out + 8, detail::shuffle<3, 1, 3, 1>(z, w));
+            _mm_storeu_ps(out + 12, detail::shuffle<2, 0, 2, 0>(z, w));
+            return _mm_cvtss_f32(determinant);
+        }
+
+        inline float vec4_dot(const float* lhs, const float* rhs)
+        {
+            return _mm_cvtss_f32(detail::sum_lanes(_mm_mul_ps(_mm_loadu_ps(lhs), _mm_loadu_ps(rhs))));
+        }
+
+        inline float vec4_length(const float* v)
+        {
+            __m128 vec = _mm_loadu_ps(v);
+            return _mm_cvtss_f32(_mm_sqrt_ss(detail::sum_lanes(_mm_mul_ps(vec, vec))));
+        }
+
+        inline void vec4_normalise(float* v)
+        {
+            __m128 vec = _mm_loadu_ps(v);
+            __m128 length = _mm_sqrt_ps(detail::sum_lanes(_mm_mul_ps(vec, vec)));
+            if(_mm_cvtss_f32(length) == 0.0f) [[unlikely]]
+            {
+                return;
+            }
+            _mm_storeu_ps(v, _mm_div_ps(vec, length));
+        }
+
+        inline void vec3_cross(const float* lhs, const float* rhs, float* out)
+        {
+            // Loading three lanes and shuffling them around costs more than the six multiplies it saves.
+            scalar::vec3_cross(lhs, rhs, out);
+        }
+
+        inline void quat_multiply(const float* lhs, const float* rhs, float* out)
+        {
+            // lhs * rhs = lhs.w * rhs + lhs.x * (w, -z, y, -x) + lhs.y * (z, w, -x, -y) + lhs.z * (-y, x, w, -z), where (x, y, z, w) is rhs.
+            __m128 a = _mm_loadu_ps(lhs);
+            __m128 b = _mm_loadu_ps(rhs);
+            __m128 b_wzyx = _mm_mul_ps(detail::swizzle<3, 2, 1, 0>(b), _mm_setr_ps(1.0f, -1.0f, 1.0f, -1.0f));
+            __m128 b_zwxy = _mm_mul_ps(detail::swizzle<2, 3, 0, 1>(b), _mm_setr_ps(1.0f, 1.0f, -1.0f, -1.0f));
+            __m128 b_yxwz = _mm_mul_ps(detail::swizzle<1, 0, 3, 2>(b), _mm_setr_ps(-1.0f, 1.0f, 1.0f, -1.0f));
+            __m128 result = _mm_mul_ps(detail::swizzle<3, 3, 3, 3>(a), b);
+            result = detail::multiply_add(detail::swizzle<0, 0, 0, 0>(a), b_wzyx, result);
+            result = detail::multiply_add(detail::swizzle<1, 1, 1, 1>(a), b_zwxy, result);
+            result = detail::multiply_add(detail::swizzle<2, 2, 2, 2>(a), b_yxwz, result);
+            _mm_storeu_ps(out, result);
+        }
+
+        inline void mat4_model_batch(const float* positions, const float* rotations, const float* scales, float* out, std::size_t count)
+        {
+            // Four models at a time, one per lane. Same maths as the scalar kernel.
+            std::size_t i = 0;
+            for(; i + 4 <= count; i += 4)
+            {
+                __m128 px, py, pz, rx, ry, rz, sx, sy, sz;
+                detail::load_xyz4(positions + i * 3, px, py, pz);
+                detail::load_xyz4(rotations + i * 3, rx, ry, rz);
+                detail::load_xyz4(scales + i * 3, sx, sy, sz);
+                __m128 sin_x, cos_x, sin_y, cos_y, sin_z, cos_z;
+                detail::sincos(rx, sin_x, cos_x);
+                detail::sincos(ry, sin_y, cos_y);
+                detail::sincos(rz, sin_z, cos_z);
+                __m128 sin_y_sin_x = _mm_mul_ps(sin_y, sin_x);
+                __m128 sin_y_cos_x = _mm_mul_ps(sin_y, cos_x);
+
+                __m128 columns[4][4];
+                columns[0][0] = _mm_mul_ps(_mm_mul_ps(cos_z, cos_y), sx);
+                columns[0][1] = _mm_mul_ps(_mm_mul_ps(sin_z, cos_y), sx);
+                columns[0][2] = _mm_mul_ps(_mm_sub_ps(_mm_setzero_ps(), sin_y), sx);
+                columns[0][3] = _mm_setzero_ps();
+                columns[1][0] = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(cos_z, sin_y_sin_x), _mm_mul_ps(sin_z, cos_x)), sy);
+                columns[1][1] = _mm_mul_ps(detail::multiply_add(sin_z, sin_y_sin_x, _mm_mul_ps(cos_z, cos_x)), sy);
+                columns[1][2] = _mm_mul_ps(_mm_mul_ps(cos_y, sin_x), sy);
+                columns[1][3] = _mm_setzero_ps();
+                columns[2][0] = _mm_mul_ps(detail::multiply_add(cos_z, sin_y_cos_x, _mm_mul_ps(sin_z, sin_x)), sz);
+                columns[2][1] = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(sin_z, sin_y_cos_x), _mm_mul_ps(cos_z, sin_x)), sz);
+                columns[2][2] = _mm_mul_ps(_mm_mul_ps(cos_y, cos_x), sz);
+                columns[2][3] = _mm_setzero_ps();
+                columns[3][0] = px;
+                columns[3][1] = py;
+                columns[3][2] = pz;
+                columns[3][3] = _mm_set1_ps(1.0f);
+                // Each register holds one element of four matrices. Transposing gives one column of each matrix.
+                float* m = out + i * 16;
+                for(std::size_t column = 0; column < 4; column++)
+                {
+                    __m128* c = columns[column];
+                    _MM_TRANSPOSE4_PS(c[0], c[1], c[2], c[3]);
+                    _mm_storeu_ps(m + column * 4, c[0]);
+                    _mm_storeu_ps(m + 16 + column * 4, c[1]);
+                    _mm_storeu_ps(m + 32 + column * 4, c[2]);
+                    _mm_storeu_ps(m + 48 + column * 4, c[3]);
+                }
+            }
+            scalar::mat4_model_batch(positions + i * 3, rotations + i * 3, scales + i * 3, out + i * 16, count - i);
+        }
+    #else
+        inline void mat4_multiply(const float* lhs, const float* rhs, float* out)
+        {
+            scalar::mat4_multiply(lhs, rhs, out);
+        }
+
+        inline void mat4_columns_dot(const float* m, const float* v, float* out)
+        {
+            scalar::mat4_columns_dot(m, v, out);
+        }
+
+        inline float mat4_inverse(const float* m, float* out)
+        {
+            return scalar::mat4_inverse(m, out);
+        }
+
+        inline float vec4_dot(const float* lhs, const float* rhs)
+        {
+            return scalar::vec4_dot(lhs, rhs);
+        }
+
+        inline float vec4_length(const float* v)
+        {
+            return scalar::vec4_length(v);
+        }
+
+        inline void vec4_normalise(float* v)
+        {
+            scalar::vec4_normalise(v);
+        }
+
+        inline void vec3_cross(const float* lhs, const float* rhs, float* out)
+        {
+            scalar::vec3_cross(lhs, rhs, out);
+        }
+
+        inline void quat_multiply(const float* lhs, const float* rhs, float* out)
+        {
+            scalar::quat_multiply(lhs, rhs, out);
+        }
+
+        inline void mat4_model_batch(const float* positions, const float* rotations, const float* scales, float* out, std::size_t count)
+        {
+            scalar::mat4_model_batch(positions, rotations, scales, out, count);
+        }
+    #endif
+}
@@ -31,14 +31,8 @@ namespace tz
         }
         else
         {
-            #if TZ_VULKAN
-                wnd = new tz::Window{tz::Window::null()};
-            #elif TZ_OGL
-                // TODO: Headless implementation for OGL
-                tz_report("Headless applications are stubbed out for OpenGL");
-                std::exit(0);
-                wnd = new tz::Window{WindowInitArgs{.width = 800, .height = 600, .title = game_info.to_string().c_str()}, {{GLFW_VISIBLE, GL_FALSE}}};
-            #endif
+            // The render-api creates its own context without a window (see vk::initialise_headless/ogl::initialise_headless).
+            wnd = new tz::Window{tz::Window::null()};
         }
         
         tz_report("%s Application", app_type == ApplicationType::Headless ? "Headless" : "Windowed");
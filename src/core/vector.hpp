@@ -41,84 +41,84 @@ namespace tz
 		 * Precondition: idx < S. Otherwise, this will assert and invoke UB.
 		 * @return The value at the given index.
 		 */
-		const T& operator[](std::size_t idx) const;
+		constexpr const T& operator[](std::size_t idx) const;
 		/**
 		 * Retrieve the element value at the given index.
 		 * Precondition: idx < S. Otherwise, this will assert and invoke UB.
 		 * @return The value at the given index.
 		 */
-		T& operator[](std::size_t idx);
+		constexpr T& operator[](std::size_t idx);
 		/**
 		 * Add each element of the given vector to the corresponding element of the current vector.
 		 * @param rhs Vector whose elements need be added to the current vector.
 		 * @return The modified original vector.
 		 */
-		Vector<T, S>& operator+=(const Vector<T, S>& rhs);
+		constexpr Vector<T, S>& operator+=(const Vector<T, S>& rhs);
 		/**
 		 * Create a copy of the current vector, add each element of the given vector to the corresponding element of the copied vector and return the result.
 		 * @param rhs Vector whose elemens need be added to the current vector.
 		 * @return A modified copy of the current vector. The initial vector is unchanged.
 		 */
-		Vector<T, S> operator+(const Vector<T, S>& rhs) const;
+		constexpr Vector<T, S> operator+(const Vector<T, S>& rhs) const;
 		/**
 		 * Subtract each element of the given vector from the corresponding element of the current vector.
 		 * @param rhs Vector whose elements need be subtracted from the current vector.
 		 * @return The modified original vector.
 		 */
-		Vector<T, S>& operator-=(const Vector<T, S>& rhs);
+		constexpr Vector<T, S>& operator-=(const Vector<T, S>& rhs);
 		/**
 		 * Create a copy of the current vector, subtract each element of the given vector from the corresponding element of the copied vector and return the result.
 		 * @param rhs Vector whose elemens need be subtracted from the current vector.
 		 * @return A modified copy of the current vector. The initial vector is unchanged.
 		 */
-		Vector<T, S> operator-(const Vector<T, S>& rhs) const;
+		constexpr Vector<T, S> operator-(const Vector<T, S>& rhs) const;
 		/**
 		 * Multiply each element of the current vector by the given value.
 		 * @param scalar Value to multiply by each element of the current vector.
 		 * @return The modified original vector.
 		 */
-		Vector<T, S>& operator*=(T scalar);
+		constexpr Vector<T, S>& operator*=(T scalar);
 		/**
 		 * Create a copy of the current vector, multiply each element of the copied vector by the given value, and return the result.
 		 * @param scalar Value to multiply by each element of the current vector.
 		 * @return A modified copy of the current vector. The initial vector is unchanged.
 		 */
-		Vector<T, S> operator*(T scalar) const;
+		constexpr Vector<T, S> operator*(T scalar) const;
 		/**
 		 * Divide each element of the current vector by the given value.
 		 * @param scalar Value to divide by each element of the current vector.
 		 * @return The modified original vector.
 		 */
-		Vector<T, S>& operator/=(T scalar);
+		constexpr Vector<T, S>& operator/=(T scalar);
 		/**
 		 * Create a copy of the current vector, divide each element of the copied vector by the given value, and return the result.
 		 * @param scalar Value to divide by each element of the current vector.
 		 * @return A modified copy of the current vector. The initial vector is unchanged.
 		 */
-		Vector<T, S> operator/(T scalar) const;
+		constexpr Vector<T, S> operator/(T scalar) const;
 
 		/**
 		 * Equate the current vector with the given vector.
 		 * @param rhs Given vector to compare with the current vector.
 		 * @return True if each element of the given vector are equal to the corresponding element of the current vector.
 		 */
-		bool operator==(const Vector<T, S>& rhs) const;
+		constexpr bool operator==(const Vector<T, S>& rhs) const;
 		/**
 		 * Retrieve a pointer to the vector data. This points to the first element of an array of size S.
 		 * @return Pointer to the first element of the vector array data.
 		 */
-		const T* data() const;
+		constexpr const T* data() const;
 		/**
 		 * Retrieve a pointer to the vector data. This points to the first element of an array of size S.
 		 * @return Pointer to the first element of the vector array data.
 		 */
-		T* data();
+		constexpr T* data();
 		/**
 		 * Compute a dot-product (otherwise known as the scalar-product) of the current vector against another given vector.
 		 * @param rhs The other given vector.
 		 * @return Scalar value representing the dot-product.
 		 */
-		T dot(const Vector<T, S>& rhs) const;
+		constexpr T dot(const Vector<T, S>& rhs) const;
 		/**
 		 * Retrieve the magnitude of the current vector.
 		 * @return Magnitude of the vector.
@@ -146,7 +146,7 @@ namespace tz
 	using Vec4 = Vector<float, 4>;
 	
 	template<typename T = float>
-	Vector<T, 3> cross(const Vector<T, 3>& lhs, const Vector<T, 3>& rhs);
+	constexpr Vector<T, 3> cross(const Vector<T, 3>& lhs, const Vector<T, 3>& rhs);
 
 	/**
 	 * @}
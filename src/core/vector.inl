@@ -1,28 +1,40 @@
 #include "core/assert.hpp"
+#include "core/simd.hpp"
+#include <type_traits>
 #include <utility>
 #include <cmath>
 
 namespace tz
 {
+	namespace detail
+	{
+		// std::abs isn't constexpr until C++23.
+		template<tz::Number T>
+		constexpr T abs(T value)
+		{
+			return value < T{0} ? -value : value;
+		}
+	}
+
 	template<tz::Number T, std::size_t S>
 	constexpr Vector<T, S>::Vector(std::array<T, S> data): vec(data){}
 
 	template<tz::Number T, std::size_t S>
-	const T& Vector<T, S>::operator[](std::size_t idx) const
+	constexpr const T& Vector<T, S>::operator[](std::size_t idx) const
 	{
 		tz_assert(idx < S, "Vector<T, %zu>::operator[%zu]: Index out of range!", S, idx);
 		return this->vec[idx];
 	}
 
 	template<tz::Number T, std::size_t S>
-	T& Vector<T, S>::operator[](std::size_t idx)
+	constexpr T& Vector<T, S>::operator[](std::size_t idx)
 	{
 		tz_assert(idx < S, "Vector<T, %zu>::operator[%zu]: Index out of range!", S, idx);
 		return this->vec[idx];
 	}
 
 	template<tz::Number T, std::size_t S>
-	Vector<T, S>& Vector<T, S>::operator+=(const Vector<T, S>& rhs)
+	constexpr Vector<T, S>& Vector<T, S>::operator+=(const Vector<T, S>& rhs)
 	{
 		for(std::size_t i = 0; i < S; i++)
 			this->vec[i] += rhs.vec[i];
@@ -30,7 +42,7 @@ namespace tz
 	}
 
 	template<tz::Number T, std::size_t S>
-	Vector<T, S> Vector<T, S>::operator+(const Vector<T, S>& rhs) const
+	constexpr Vector<T, S> Vector<T, S>::operator+(const Vector<T, S>& rhs) const
 	{
 		Vector<T, S> copy = *this;
 		copy += rhs;
@@ -38,7 +50,7 @@ namespace tz
 	}
 
 	template<tz::Number T, std::size_t S>
-	Vector<T, S>& Vector<T, S>::operator-=(const Vector<T, S>& rhs)
+	constexpr Vector<T, S>& Vector<T, S>::operator-=(const Vector<T, S>& rhs)
 	{
 		for(std::size_t i = 0; i < S; i++)
 			this->vec[i] -= rhs.vec[i];
@@ -46,7 +58,7 @@ namespace tz
 	}
 
 	template<tz::Number T, std::size_t S>
-	Vector<T, S> Vector<T, S>::operator-(const Vector<T, S>& rhs) const
+	constexpr Vector<T, S> Vector<T, S>::operator-(const Vector<T, S>& rhs) const
 	{
 		Vector<T, S> copy = *this;
 		copy -= rhs;
@@ -54,7 +66,7 @@ namespace tz
 	}
 
 	template<tz::Number T, std::size_t S>
-	Vector<T, S>& Vector<T, S>::operator*=(T scalar)
+	constexpr Vector<T, S>& Vector<T, S>::operator*=(T scalar)
 	{
 		for(std::size_t i = 0; i < S; i++)
 			this->vec[i] *= scalar;
@@ -62,7 +74,7 @@ namespace tz
 	}
 
 	template<tz::Number T, std::size_t S>
-	Vector<T, S> Vector<T, S>::operator*(T scalar) const
+	constexpr Vector<T, S> Vector<T, S>::operator*(T scalar) const
 	{
 		Vector<T, S> copy = *this;
 		copy *= scalar;
@@ -70,7 +82,7 @@ namespace tz
 	}
 
 	template<tz::Number T, std::size_t S>
-	Vector<T, S>& Vector<T, S>::operator/=(T scalar)
+	constexpr Vector<T, S>& Vector<T, S>::operator/=(T scalar)
 	{
 		for(std::size_t i = 0; i < S; i++)
 			this->vec[i] /= scalar;
@@ -78,7 +90,7 @@ namespace tz
 	}
 
 	template<tz::Number T, std::size_t S>
-	Vector<T, S> Vector<T, S>::operator/(T scalar) const
+	constexpr Vector<T, S> Vector<T, S>::operator/(T scalar) const
 	{
 		Vector<T, S> copy = *this;
 		copy /= scalar;
@@ -86,31 +98,38 @@ namespace tz
 	}
 
 	template<tz::Number T, std::size_t S>
-	bool Vector<T, S>::operator==(const Vector<T, S>& rhs) const
+	constexpr bool Vector<T, S>::operator==(const Vector<T, S>& rhs) const
 	{
 		for(std::size_t i = 0; i < S; i++)
 		{
-			if(std::abs((*this)[i] - rhs[i]) >= std::numeric_limits<T>::epsilon())
+			if(detail::abs((*this)[i] - rhs[i]) >= std::numeric_limits<T>::epsilon())
 				return false;
 		}
 		return true;
 	}
 
 	template<tz::Number T, std::size_t S>
-	const T* Vector<T, S>::data() const
+	constexpr const T* Vector<T, S>::data() const
 	{
 		return this->vec.data();
 	}
 
 	template<tz::Number T, std::size_t S>
-	T* Vector<T, S>::data()
+	constexpr T* Vector<T, S>::data()
 	{
 		return this->vec.data();
 	}
 
 	template<tz::Number T, std::size_t S>
-	T Vector<T, S>::dot(const Vector<T, S>& rhs) const
+	constexpr T Vector<T, S>::dot(const Vector<T, S>& rhs) const
 	{
+		if constexpr(std::is_same_v<T, float> && S == 4)
+		{
+			if(!std::is_constant_evaluated())
+			{
+				return simd::vec4_dot(this->data(), rhs.data());
+			}
+		}
 		T sum = T();
 		for(std::size_t i = 0; i < S; i++)
 		{
@@ -122,6 +141,10 @@ namespace tz
 	template<tz::Number T, std::size_t S>
 	T Vector<T, S>::length() const
 	{
+		if constexpr(std::is_same_v<T, float> && S == 4)
+		{
+			return simd::vec4_length(this->data());
+		}
 		T sum_squares = T();
 		for(std::size_t i = 0; i < S; i++)
 		{
@@ -133,6 +156,11 @@ namespace tz
 	template<tz::Number T, std::size_t S>
 	void Vector<T, S>::normalise()
 	{
+		if constexpr(std::is_same_v<T, float> && S == 4)
+		{
+			simd::vec4_normalise(this->data());
+			return;
+		}
 		T l = this->length();
 		if(l == T{}) [[unlikely]]
 		{
@@ -153,16 +181,24 @@ namespace tz
 	}
 
 	template<tz::Number T>
-	Vector<T, 3> cross(const Vector<T, 3>& lhs, const Vector<T, 3>& rhs)
+	constexpr Vector<T, 3> cross(const Vector<T, 3>& lhs, const Vector<T, 3>& rhs)
 	{
 		Vector<T, 3> ret;
+		if constexpr(std::is_same_v<T, float>)
+		{
+			if(!std::is_constant_evaluated())
+			{
+				simd::vec3_cross(lhs.data(), rhs.data(), ret.data());
+				return ret;
+			}
+		}
 		//cx = aybz − azby
 		ret[0] = (lhs[1] * rhs[2]) - (lhs[2] * rhs[1]);
 		//cy = azbx − axbz
 		ret[1] = (lhs[2] * rhs[0]) - (lhs[0] * rhs[2]);
 		//cz = axby − aybx
 		ret[2] = (lhs[0] * rhs[1]) - (lhs[1] * rhs[0]);
-		return std::move(ret);
+		return ret;
 	}
 
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "core/window_functionality.hpp"
 #include "core/assert.hpp"
+#include "core/profile.hpp"
 
 #if TZ_OGL
 #include "glad/glad.h"
@@ -33,10 +34,14 @@ namespace tz
 
     void WindowFunctionality::update()
     {
+        tz_profile_scope("Window::update");
         glfwPollEvents();
         #if TZ_OGL
-            // OpenGL only
-            glfwSwapBuffers(this->wnd);
+            // OpenGL only. Headless applications have no window, and render into an offscreen framebuffer instead.
+            if(this->wnd != nullptr)
+            {
+                glfwSwapBuffers(this->wnd);
+            }
         #endif
     }
 
@@ -0,0 +1,114 @@
+#include "core/worker_pool.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace tz
+{
+    struct WorkerPool::State
+    {
+        void run_jobs()
+        {
+            for(std::size_t i = this->next_job.fetch_add(1, std::memory_order_relaxed); i < this->job_count; i = this->next_job.fetch_add(1, std::memory_order_relaxed))
+            {
+                (*this->job)(i);
+            }
+        }
+
+        std::mutex mutex;
+        std::condition_variable work_ready;
+        std::condition_variable work_done;
+        /// Bumped by every call to run, so that a waking worker can tell new work apart from a spurious wake-up.
+        std::uint64_t generation = 0;
+        bool stopping = false;
+        const std::function<void(std::size_t)>* job = nullptr;
+        std::size_t job_count = 0;
+        std::atomic<std::size_t> next_job{0};
+        /// Workers which have not yet finished with the current generation. run waits for this to reach zero, so no worker can still be looking at the previous job when the next one is set.
+        std::size_t busy_workers = 0;
+    };
+
+    WorkerPool::WorkerPool(std::size_t thread_count):
+    state(std::make_unique<State>()),
+    threads()
+    {
+        this->threads.reserve(thread_count);
+        for(std::size_t i = 0; i < thread_count; i++)
+        {
+            this->threads.emplace_back([state = this->state.get()]()
+            {
+                std::uint64_t seen_generation = 0;
+                while(true)
+                {
+                    {
+                        std::unique_lock<std::mutex> lock{state->mutex};
+                        state->work_ready.wait(lock, [state, seen_generation](){return state->stopping || state->generation != seen_generation;});
+                        if(state->stopping)
+                        {
+                            return;
+                        }
+                        seen_generation = state->generation;
+                    }
+                    state->run_jobs();
+                    {
+                        std::lock_guard<std::mutex> lock{state->mutex};
+                        state->busy_workers--;
+                    }
+                    state->work_done.notify_one();
+                }
+            });
+        }
+    }
+
+    WorkerPool::WorkerPool(WorkerPool&& move) = default;
+
+    WorkerPool::~WorkerPool()
+    {
+        if(this->state == nullptr)
+        {
+            // Moved-from.
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock{this->state->mutex};
+            this->state->stopping = true;
+        }
+        this->state->work_ready.notify_all();
+        for(std::thread& thread : this->threads)
+        {
+            thread.join();
+        }
+    }
+
+    std::size_t WorkerPool::get_thread_count() const
+    {
+        return this->threads.size();
+    }
+
+    void WorkerPool::run(std::size_t job_count, const std::function<void(std::size_t)>& job)
+    {
+        if(this->threads.empty() || job_count <= 1)
+        {
+            // Waking the workers would cost more than it saves.
+            for(std::size_t i = 0; i < job_count; i++)
+            {
+                job(i);
+            }
+            return;
+        }
+        State& state = *this->state;
+        {
+            std::lock_guard<std::mutex> lock{state.mutex};
+            state.job = &job;
+            state.job_count = job_count;
+            state.next_job.store(0, std::memory_order_relaxed);
+            state.busy_workers = this->threads.size();
+            state.generation++;
+        }
+        state.work_ready.notify_all();
+        state.run_jobs();
+        std::unique_lock<std::mutex> lock{state.mutex};
+        state.work_done.wait(lock, [&state](){return state.busy_workers == 0;});
+    }
+}
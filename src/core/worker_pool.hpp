@@ -0,0 +1,56 @@
+#ifndef TOPAZ_CORE_WORKER_POOL_HPP
+#define TOPAZ_CORE_WORKER_POOL_HPP
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace tz
+{
+    /**
+	 * \addtogroup tz_core Topaz Core Library (tz)
+	 * A collection of platform-agnostic core interfaces.
+	 * @{
+	 */
+
+    /**
+     * @brief A fixed set of threads which run batches of jobs alongside the calling thread.
+     * @details Starting a thread costs tens of microseconds, so anything which goes wide repeatedly should keep a pool around rather than spawning threads each time. Idle workers sleep, and cost nothing.
+     */
+    class WorkerPool
+    {
+    public:
+        /**
+         * @brief Start the given number of worker threads.
+         * @param thread_count Number of threads to start. The thread which calls @ref WorkerPool::run also runs jobs, so up to thread_count + 1 jobs run at once. Zero is allowed, in which case every job runs on the calling thread.
+         */
+        WorkerPool(std::size_t thread_count);
+        WorkerPool(const WorkerPool& copy) = delete;
+        WorkerPool(WorkerPool&& move);
+        /// Waits for every worker thread to exit.
+        ~WorkerPool();
+        WorkerPool& operator=(const WorkerPool& rhs) = delete;
+        WorkerPool& operator=(WorkerPool&& rhs) = delete;
+        /**
+         * @brief Retrieve the number of worker threads, not including the thread which calls @ref WorkerPool::run.
+         */
+        std::size_t get_thread_count() const;
+        /**
+         * @brief Invoke `job(i)` once for each i < job_count, spread across the worker threads and the calling thread. Blocks until every job has finished.
+         * @details Any thread may run any job, but no two threads ever run the same job.
+         * @pre `run` is not already in progress on this pool.
+         */
+        void run(std::size_t job_count, const std::function<void(std::size_t)>& job);
+    private:
+        struct State;
+        std::unique_ptr<State> state;
+        std::vector<std::thread> threads;
+    };
+
+    /**
+     * @}
+     */
+}
+
+#endif // TOPAZ_CORE_WORKER_POOL_HPP
@@ -31,6 +31,35 @@ namespace tz::gl
          * @return GraphicsPrimitiveType Primitive type used by this Device. 
          */
         virtual GraphicsPrimitiveType get_primitive_type() const = 0;
+        /**
+         * @brief Set the maximum number of frames which renderers may have in flight at once. Fewer frames in flight reduces latency, more frames in flight lets the CPU run further ahead of the GPU.
+         * @param frames_in_flight Maximum number of frames in flight. Must be at least 1.
+         */
+        virtual void set_frames_in_flight(std::size_t frames_in_flight) = 0;
+        /**
+         * @brief Retrieve the maximum number of frames which renderers may have in flight at once.
+         * @note Unless you have set the number manually, the default is 2.
+         */
+        virtual std::size_t get_frames_in_flight() const = 0;
+        /**
+         * @brief Request a minimum number of images which the window's swapchain should contain. The hardware may require more, and may not allow this many.
+         * @param image_count Minimum number of swapchain images, or 0 to use as few as the hardware allows.
+         */
+        virtual void set_swapchain_image_count(std::size_t image_count) = 0;
+        /**
+         * @brief Retrieve the requested minimum number of swapchain images.
+         * @note Unless you have set the number manually, the default is 0, which uses as few as the hardware allows.
+         */
+        virtual std::size_t get_swapchain_image_count() const = 0;
+        /**
+         * @brief Set how finished frames should be presented to the window.
+         */
+        virtual void set_present_mode(PresentModePreference present_mode) = 0;
+        /**
+         * @brief Retrieve how finished frames should be presented to the window.
+         * @note Unless you have set the present mode manually, the default is `PresentModePreference::DontCare`.
+         */
+        virtual PresentModePreference get_present_mode() const = 0;
     };
 
     /**
@@ -1,8 +1,10 @@
 #ifndef TOPAZ_GL_API_RENDERER_HPP
 #define TOPAZ_GL_API_RENDERER_HPP
+#include "core/assert.hpp"
 #include "core/containers/basic_list.hpp"
 #include "core/interfaces/cloneable.hpp"
 #include "core/vector.hpp"
+#include "gl/impl/frontend/common/dirty_ranges.hpp"
 #include "gl/impl/frontend/common/renderer.hpp"
 #include "gl/render_pass.hpp"
 #include "gl/resource.hpp"
@@ -147,6 +149,30 @@ namespace tz::gl
          * @return std::span<std::byte> displaying the byte-representation of vertex data.
          */
         virtual std::span<std::byte> get_vertex_bytes_dynamic() = 0;
+        /**
+         * @brief Inform the renderer that a range of the vertex data has been changed.
+         * @note Renderers only flush/copy the ranges which have been marked dirty. If an input never marks any range as dirty, the renderer assumes that all of its vertex data may change at any time.
+         * 
+         * @param offset Offset of the first changed byte, from the beginning of the vertex data.
+         * @param length Number of changed bytes.
+         */
+        void mark_dirty(std::size_t offset, std::size_t length)
+        {
+            tz_assert(offset + length <= this->vertex_count_bytes(), "IRendererDynamicInput::mark_dirty(%zu, %zu): Range out of bounds (vertex data is %zu bytes)", offset, length, this->vertex_count_bytes());
+            this->dirty_ranges.add(offset, length);
+        }
+        /**
+         * @brief Retrieve write access to a range of the vertex data. The whole range is marked dirty once the writer is destroyed.
+         * 
+         * @param offset Offset of the first byte to write, from the beginning of the vertex data.
+         * @param length Number of bytes which may be written.
+         * @return Writer which marks the range dirty when it goes out of scope.
+         */
+        DynamicDataWriter write(std::size_t offset, std::size_t length)
+        {
+            tz_assert(offset + length <= this->vertex_count_bytes(), "IRendererDynamicInput::write(%zu, %zu): Range out of bounds (vertex data is %zu bytes)", offset, length, this->vertex_count_bytes());
+            return {this->get_vertex_bytes_dynamic().subspan(offset, length), offset, this->dirty_ranges};
+        }
         
         #if TZ_VULKAN
             friend class RendererBufferManagerVulkan;
@@ -158,6 +184,8 @@ namespace tz::gl
         virtual void set_vertex_data(std::byte* vertex_data) = 0;
         // Only intended to be used by the Renderer.
         virtual void set_index_data(unsigned int* index_data) = 0;
+        // Only intended to be used by the Renderer, which flushes/copies these ranges and then clears them.
+        DirtyRangeList dirty_ranges;
     };
 
     /**
@@ -189,6 +217,7 @@ namespace tz::gl
      * @brief Structure describing the nature of a renderer.
      * @note There is no default element format. You must specify one before creating a renderer, otherwise the behaviour is undefined.
      * @note The default culling strategy is no culling. You are likely to improve performance by utilising a culling strategy.
+     * @note The default dynamic data mode is @ref RendererDynamicDataMode::DirectMapped.
      */
     class IRendererBuilder
     {
@@ -227,6 +256,19 @@ namespace tz::gl
          * @return Culling strategy that the renderer will use.
          */
         virtual RendererCullingStrategy get_culling_strategy() const = 0;
+        /**
+         * @brief Set how the renderer stores data for dynamic inputs and dynamic buffer resources.
+         * @note Only the Vulkan frontend currently honours @ref RendererDynamicDataMode::FrameRing. Other frontends will always behave as if @ref RendererDynamicDataMode::DirectMapped were used.
+         * 
+         * @param dynamic_data_mode Should dynamic data be written directly into GPU memory, or versioned per frame in flight?
+         */
+        virtual void set_dynamic_data_mode(RendererDynamicDataMode dynamic_data_mode) = 0;
+        /**
+         * @brief Retrieve the current dynamic data mode.
+         * 
+         * @return Dynamic data mode that the renderer will use.
+         */
+        virtual RendererDynamicDataMode get_dynamic_data_mode() const = 0;
         /**
          * @brief Renderers must reference an existing RenderPass. Renderers will render each stage of the render pass in the expected order.
          * 
@@ -328,6 +370,13 @@ namespace tz::gl
          * @param draws List of the input handles to draw in-order. It is valid for the same input to be drawn multiple times. This will also be used for each subsequent render invocation until a new draw list is supplied.
          */
         virtual void render(RendererDrawList draws) = 0;
+        /**
+         * @brief Retrieve how long the GPU has recently spent running this renderer. Use this to tell whether a slowdown is CPU or GPU bound.
+         * @note Timings are read back without waiting on the GPU, so they lag a few frames behind. If the device does not support timestamp queries, no samples are ever recorded.
+         * 
+         * @return Rolling average, minimum and maximum over the last few frames.
+         */
+        virtual RendererGPUTimings get_gpu_timings() const = 0;
     };
     /**
      * @}
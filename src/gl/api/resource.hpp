@@ -2,6 +2,8 @@
 #define TOPAZ_GL_API_RESOURCE_HPP
 #include "core/interfaces/cloneable.hpp"
 #include "core/handle.hpp"
+#include "core/assert.hpp"
+#include "gl/impl/frontend/common/dirty_ranges.hpp"
 #include "gl/impl/frontend/common/resource.hpp"
 #include "gl/impl/frontend/common/renderer.hpp"
 #include <span>
@@ -87,6 +89,30 @@ namespace tz::gl
          * @return std::span<std::byte> displaying the byte-representation of the resource data.
          */
         virtual std::span<std::byte> get_resource_bytes_dynamic() = 0;
+        /**
+         * @brief Inform the renderer that a range of the resource data has been changed.
+         * @note Renderers only flush/copy the ranges which have been marked dirty. If a resource never marks any range as dirty, the renderer assumes that all of its data may change at any time.
+         * 
+         * @param offset Offset of the first changed byte, from the beginning of the resource data.
+         * @param length Number of changed bytes.
+         */
+        void mark_dirty(std::size_t offset, std::size_t length)
+        {
+            tz_assert(offset + length <= this->get_resource_bytes().size_bytes(), "IDynamicResource::mark_dirty(%zu, %zu): Range out of bounds (resource is %zu bytes)", offset, length, this->get_resource_bytes().size_bytes());
+            this->dirty_ranges.add(offset, length);
+        }
+        /**
+         * @brief Retrieve write access to a range of the resource data. The whole range is marked dirty once the writer is destroyed.
+         * 
+         * @param offset Offset of the first byte to write, from the beginning of the resource data.
+         * @param length Number of bytes which may be written.
+         * @return Writer which marks the range dirty when it goes out of scope.
+         */
+        DynamicDataWriter write(std::size_t offset, std::size_t length)
+        {
+            tz_assert(offset + length <= this->get_resource_bytes().size_bytes(), "IDynamicResource::write(%zu, %zu): Range out of bounds (resource is %zu bytes)", offset, length, this->get_resource_bytes().size_bytes());
+            return {this->get_resource_bytes_dynamic().subspan(offset, length), offset, this->dirty_ranges};
+        }
 
         #if TZ_VULKAN
             friend class RendererBufferManagerVulkan;
@@ -95,6 +121,8 @@ namespace tz::gl
         #endif
     private:
         virtual void set_resource_data(std::byte* resource_data) = 0;
+        // Only intended to be used by the Renderer, which flushes/copies these ranges and then clears them.
+        DirtyRangeList dirty_ranges;
     };
 
     /**
@@ -5,6 +5,8 @@
 #include <cstring>
 
 constexpr GLenum persistent_mapped_buffer_flags = GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+constexpr GLenum persistent_mapped_explicit_flush_storage_flags = GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT;
+constexpr GLenum persistent_mapped_explicit_flush_map_flags = persistent_mapped_explicit_flush_storage_flags | GL_MAP_FLUSH_EXPLICIT_BIT;
 
 namespace tz::gl::ogl
 {
@@ -21,6 +23,9 @@ namespace tz::gl::ogl
             case BufferUsage::PersistentMapped:
                 glNamedBufferStorage(this->buf, bytes, nullptr, GL_DYNAMIC_STORAGE_BIT | persistent_mapped_buffer_flags);
             break;
+            case BufferUsage::PersistentMappedExplicitFlush:
+                glNamedBufferStorage(this->buf, bytes, nullptr, GL_DYNAMIC_STORAGE_BIT | persistent_mapped_explicit_flush_storage_flags);
+            break;
             default:
                 glNamedBufferData(this->buf, bytes, nullptr, flags);
             break;
@@ -55,14 +60,14 @@ namespace tz::gl::ogl
         return this->type;
     }
 
-    void Buffer::write(const void* addr, std::size_t bytes)
+    void Buffer::write(const void* addr, std::size_t bytes, std::size_t offset)
     {
         if(this->mapped_ptr != nullptr)
         {
-            std::memcpy(this->mapped_ptr, addr, bytes);
+            std::memcpy(static_cast<char*>(this->mapped_ptr) + offset, addr, bytes);
             return;
         }
-        glNamedBufferSubData(this->buf, 0, static_cast<GLsizeiptr>(bytes), addr);
+        glNamedBufferSubData(this->buf, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(bytes), addr);
     }
 
     void* Buffer::map_memory()
@@ -79,6 +84,9 @@ namespace tz::gl::ogl
             case BufferUsage::PersistentMapped:
                 flags = persistent_mapped_buffer_flags;
             break;
+            case BufferUsage::PersistentMappedExplicitFlush:
+                flags = persistent_mapped_explicit_flush_map_flags;
+            break;
             default:
                 flags = GL_MAP_READ_BIT | GL_MAP_WRITE_BIT;
             break;
@@ -93,6 +101,13 @@ namespace tz::gl::ogl
         this->mapped_ptr = nullptr;
     }
 
+    void Buffer::flush(std::size_t offset, std::size_t length)
+    {
+        tz_assert(this->usage == BufferUsage::PersistentMappedExplicitFlush, "Attempted to flush a buffer which was not created with BufferUsage::PersistentMappedExplicitFlush");
+        tz_assert(this->mapped_ptr != nullptr, "Attempted to flush a buffer which is not mapped");
+        glFlushMappedNamedBufferRange(this->buf, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(length));
+    }
+
     void Buffer::bind() const
     {
         /*
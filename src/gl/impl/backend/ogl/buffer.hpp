@@ -30,7 +30,9 @@ namespace tz::gl::ogl
     enum class BufferUsage
     {
         ReadWrite,
-        PersistentMapped
+        PersistentMapped,
+        /// Persistently mapped, but not coherent. Host writes are only guaranteed to be visible to the GPU once they have been flushed via @ref Buffer::flush.
+        PersistentMappedExplicitFlush
     };
 
     class Buffer
@@ -45,9 +47,14 @@ namespace tz::gl::ogl
     
         BufferType get_type() const;
 
-        void write(const void* addr, std::size_t bytes);
+        void write(const void* addr, std::size_t bytes, std::size_t offset = 0);
         void* map_memory();
         void unmap_memory();
+        /**
+         * @brief Make host writes to the given range of mapped memory visible to the GPU.
+         * @pre The buffer must have been created with @ref BufferUsage::PersistentMappedExplicitFlush and must currently be mapped.
+         */
+        void flush(std::size_t offset, std::size_t length);
         void bind() const;
 
         GLuint native() const;
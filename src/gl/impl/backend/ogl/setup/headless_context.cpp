@@ -0,0 +1,212 @@
+#if TZ_OGL
+#include "core/assert.hpp"
+#include "core/report.hpp"
+#include "gl/impl/backend/ogl/setup/headless_context.hpp"
+#include "gl/impl/backend/ogl/tz_opengl.hpp"
+#if TZ_OGL_EGL
+#include "EGL/eglext.h"
+#endif
+#include <array>
+#include <cstring>
+
+namespace tz::gl::ogl
+{
+    #if TZ_OGL_EGL
+        namespace detail
+        {
+            bool has_extension(const char* extensions, const char* name)
+            {
+                if(extensions == nullptr)
+                {
+                    return false;
+                }
+                // Extension strings are space-separated, so make sure we don't match a prefix of some other extension.
+                std::size_t name_length = std::strlen(name);
+                for(const char* match = std::strstr(extensions, name); match != nullptr; match = std::strstr(match + name_length, name))
+                {
+                    bool starts_word = match == extensions || match[-1] == ' ';
+                    bool ends_word = match[name_length] == ' ' || match[name_length] == '\0';
+                    if(starts_word && ends_word)
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            EGLDisplay get_display()
+            {
+                // Mesa's surfaceless platform doesn't need a display server at all, so prefer it if it's available.
+                const char* client_extensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+                if(has_extension(client_extensions, "EGL_MESA_platform_surfaceless") && has_extension(client_extensions, "EGL_EXT_platform_base"))
+                {
+                    auto get_platform_display = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+                    if(get_platform_display != nullptr)
+                    {
+                        EGLDisplay display = get_platform_display(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+                        if(display != EGL_NO_DISPLAY)
+                        {
+                            return display;
+                        }
+                    }
+                }
+                return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+            }
+        }
+    #endif // TZ_OGL_EGL
+
+    HeadlessContext::HeadlessContext():
+    version(ogl::get_opengl_version()),
+    #if TZ_OGL_EGL
+        display(detail::get_display()),
+        context(EGL_NO_CONTEXT),
+        surface(EGL_NO_SURFACE)
+    #else
+        hidden_window(nullptr)
+    #endif
+    {
+        #if TZ_OGL_EGL
+            tz_assert(this->display != EGL_NO_DISPLAY, "HeadlessContext: Failed to retrieve an EGL display");
+            EGLint egl_major, egl_minor;
+            [[maybe_unused]] EGLBoolean initialised = eglInitialize(this->display, &egl_major, &egl_minor);
+            tz_assert(initialised == EGL_TRUE, "HeadlessContext: eglInitialize failed (0x%x)", eglGetError());
+            [[maybe_unused]] EGLBoolean bound = eglBindAPI(EGL_OPENGL_API);
+            tz_assert(bound == EGL_TRUE, "HeadlessContext: EGL implementation does not support desktop OpenGL");
+
+            const char* extensions = eglQueryString(this->display, EGL_EXTENSIONS);
+            tz_assert(detail::has_extension(extensions, "EGL_KHR_create_context"), "HeadlessContext: EGL_KHR_create_context is required to create a core profile context, but is not supported");
+            bool surfaceless = detail::has_extension(extensions, "EGL_KHR_surfaceless_context");
+
+            // Rendering always happens into a framebuffer object, so the config only matters for the pbuffer fallback.
+            std::array<EGLint, 5> config_attribs
+            {
+                EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+                EGL_SURFACE_TYPE, surfaceless ? EGL_DONT_CARE : EGL_PBUFFER_BIT,
+                EGL_NONE
+            };
+            EGLConfig config;
+            EGLint config_count = 0;
+            eglChooseConfig(this->display, config_attribs.data(), &config, 1, &config_count);
+            tz_assert(config_count > 0, "HeadlessContext: No suitable EGL config");
+
+            // The renderer needs direct state access, so 4.5 is the oldest version we can work with.
+            constexpr tz::Version minimum_version{4, 5, 0};
+            #if TZ_DEBUG
+                constexpr EGLint context_flags = EGL_CONTEXT_OPENGL_DEBUG_BIT_KHR;
+            #else
+                constexpr EGLint context_flags = 0;
+            #endif
+            for(tz::Version attempt = this->version; this->context == EGL_NO_CONTEXT && attempt.minor >= minimum_version.minor; attempt.minor--)
+            {
+                std::array<EGLint, 9> context_attribs
+                {
+                    EGL_CONTEXT_MAJOR_VERSION_KHR, static_cast<EGLint>(attempt.major),
+                    EGL_CONTEXT_MINOR_VERSION_KHR, static_cast<EGLint>(attempt.minor),
+                    EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR,
+                    EGL_CONTEXT_FLAGS_KHR, context_flags,
+                    EGL_NONE
+                };
+                this->context = eglCreateContext(this->display, config, EGL_NO_CONTEXT, context_attribs.data());
+                this->version = attempt;
+            }
+            tz_assert(this->context != EGL_NO_CONTEXT, "HeadlessContext: Failed to create an OpenGL %u.%u core context (0x%x)", minimum_version.major, minimum_version.minor, eglGetError());
+
+            if(!surfaceless)
+            {
+                constexpr std::array<EGLint, 5> pbuffer_attribs{EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
+                this->surface = eglCreatePbufferSurface(this->display, config, pbuffer_attribs.data());
+                tz_assert(this->surface != EGL_NO_SURFACE, "HeadlessContext: Failed to create a pbuffer surface (0x%x)", eglGetError());
+            }
+            [[maybe_unused]] EGLBoolean made_current = eglMakeCurrent(this->display, this->surface, this->surface, this->context);
+            tz_assert(made_current == EGL_TRUE, "HeadlessContext: eglMakeCurrent failed (0x%x)", eglGetError());
+            tz_report("HeadlessContext: EGL v%d.%d, OpenGL v%u.%u (%s)", egl_major, egl_minor, this->version.major, this->version.minor, surfaceless ? "Surfaceless" : "Pbuffer");
+        #else
+            glfwInit();
+            glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+            glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_API);
+            glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, this->version.major);
+            glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, this->version.minor);
+            glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+            #if TZ_DEBUG
+                glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GLFW_TRUE);
+            #endif
+            this->hidden_window = glfwCreateWindow(1, 1, "Topaz Headless", nullptr, nullptr);
+            tz_assert(this->hidden_window != nullptr, "HeadlessContext: Failed to create a hidden window. Without EGL, headless OpenGL applications still need a display");
+            glfwMakeContextCurrent(this->hidden_window);
+            tz_report("HeadlessContext: EGL unavailable, using a hidden window");
+        #endif
+    }
+
+    HeadlessContext::~HeadlessContext()
+    {
+        #if TZ_OGL_EGL
+            eglMakeCurrent(this->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+            if(this->surface != EGL_NO_SURFACE)
+            {
+                eglDestroySurface(this->display, this->surface);
+            }
+            eglDestroyContext(this->display, this->context);
+            eglTerminate(this->display);
+        #else
+            glfwDestroyWindow(this->hidden_window);
+            glfwTerminate();
+        #endif
+    }
+
+    tz::Version HeadlessContext::get_version() const
+    {
+        return this->version;
+    }
+
+    void* HeadlessContext::get_proc_address(const char* name)
+    {
+        #if TZ_OGL_EGL
+            return reinterpret_cast<void*>(eglGetProcAddress(name));
+        #else
+            return reinterpret_cast<void*>(glfwGetProcAddress(name));
+        #endif
+    }
+
+    HeadlessFramebuffer::HeadlessFramebuffer(GLsizei width, GLsizei height):
+    width(width),
+    height(height),
+    framebuffer(0),
+    colour_renderbuffer(0),
+    depth_renderbuffer(0)
+    {
+        glCreateRenderbuffers(1, &this->colour_renderbuffer);
+        glNamedRenderbufferStorage(this->colour_renderbuffer, GL_RGBA8, this->width, this->height);
+        glCreateRenderbuffers(1, &this->depth_renderbuffer);
+        glNamedRenderbufferStorage(this->depth_renderbuffer, GL_DEPTH_COMPONENT24, this->width, this->height);
+
+        glCreateFramebuffers(1, &this->framebuffer);
+        glNamedFramebufferRenderbuffer(this->framebuffer, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, this->colour_renderbuffer);
+        glNamedFramebufferRenderbuffer(this->framebuffer, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, this->depth_renderbuffer);
+        [[maybe_unused]] GLenum status = glCheckNamedFramebufferStatus(this->framebuffer, GL_FRAMEBUFFER);
+        tz_assert(status == GL_FRAMEBUFFER_COMPLETE, "HeadlessFramebuffer: Framebuffer is incomplete (0x%x)", status);
+    }
+
+    HeadlessFramebuffer::~HeadlessFramebuffer()
+    {
+        glDeleteFramebuffers(1, &this->framebuffer);
+        glDeleteRenderbuffers(1, &this->depth_renderbuffer);
+        glDeleteRenderbuffers(1, &this->colour_renderbuffer);
+    }
+
+    GLsizei HeadlessFramebuffer::get_width() const
+    {
+        return this->width;
+    }
+
+    GLsizei HeadlessFramebuffer::get_height() const
+    {
+        return this->height;
+    }
+
+    GLuint HeadlessFramebuffer::native() const
+    {
+        return this->framebuffer;
+    }
+}
+
+#endif // TZ_OGL
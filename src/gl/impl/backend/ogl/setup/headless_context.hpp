@@ -0,0 +1,75 @@
+#ifndef TOPAZ_GL_OGL_SETUP_HEADLESS_CONTEXT_HPP
+#define TOPAZ_GL_OGL_SETUP_HEADLESS_CONTEXT_HPP
+#if TZ_OGL
+#include "core/version.hpp"
+#include "glad/glad.h"
+#if TZ_OGL_EGL
+#define EGL_NO_X11
+#include "EGL/egl.h"
+#else
+#include "GLFW/glfw3.h"
+#endif
+
+namespace tz::gl::ogl
+{
+    /**
+     * @brief An OpenGL context which is not associated with any window, made current on construction.
+     * @details Uses EGL, preferring a surfaceless context (e.g Mesa's surfaceless platform, which needs no display at all) and falling back to a tiny pbuffer surface. If topaz was built without EGL, a hidden window is used instead -- which still needs a display.
+     */
+    class HeadlessContext
+    {
+    public:
+        HeadlessContext();
+        HeadlessContext(const HeadlessContext& copy) = delete;
+        HeadlessContext(HeadlessContext&& move) = delete;
+        ~HeadlessContext();
+        HeadlessContext& operator=(const HeadlessContext& rhs) = delete;
+        HeadlessContext& operator=(HeadlessContext&& rhs) = delete;
+
+        /**
+         * @brief Retrieve the version of the context that was actually created. This may be older than @ref ogl::get_opengl_version() if the driver does not support it.
+         */
+        tz::Version get_version() const;
+        /**
+         * @brief Retrieve the address of an OpenGL function. Use this instead of glfwGetProcAddress to load functions for this context.
+         */
+        static void* get_proc_address(const char* name);
+    private:
+        tz::Version version;
+        #if TZ_OGL_EGL
+            EGLDisplay display;
+            EGLContext context;
+            /// EGL_NO_SURFACE if the context is surfaceless.
+            EGLSurface surface;
+        #else
+            GLFWwindow* hidden_window;
+        #endif
+    };
+
+    /**
+     * @brief Stands in for the default framebuffer when there is no window. Has a colour and depth attachment.
+     */
+    class HeadlessFramebuffer
+    {
+    public:
+        HeadlessFramebuffer(GLsizei width, GLsizei height);
+        HeadlessFramebuffer(const HeadlessFramebuffer& copy) = delete;
+        HeadlessFramebuffer(HeadlessFramebuffer&& move) = delete;
+        ~HeadlessFramebuffer();
+        HeadlessFramebuffer& operator=(const HeadlessFramebuffer& rhs) = delete;
+        HeadlessFramebuffer& operator=(HeadlessFramebuffer&& rhs) = delete;
+
+        GLsizei get_width() const;
+        GLsizei get_height() const;
+        GLuint native() const;
+    private:
+        GLsizei width;
+        GLsizei height;
+        GLuint framebuffer;
+        GLuint colour_renderbuffer;
+        GLuint depth_renderbuffer;
+    };
+}
+
+#endif // TZ_OGL
+#endif // TOPAZ_GL_OGL_SETUP_HEADLESS_CONTEXT_HPP
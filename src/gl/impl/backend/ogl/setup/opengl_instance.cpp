@@ -1,7 +1,6 @@
 #if TZ_OGL
 #include "core/assert.hpp"
 #include "gl/impl/backend/ogl/setup/opengl_instance.hpp"
-#include "GLFW/glfw3.h"
 #include <iostream>
 
 namespace tz::gl::ogl
@@ -52,9 +51,9 @@ namespace tz::gl::ogl
         }
     }
 
-    OpenGLInstance::OpenGLInstance([[maybe_unused]] tz::GameInfo game_info)
+    OpenGLInstance::OpenGLInstance([[maybe_unused]] tz::GameInfo game_info, GLADloadproc loader)
     {
-        [[maybe_unused]] int glad_load_result = gladLoadGLLoader(reinterpret_cast<GLADloadproc>(glfwGetProcAddress));
+        [[maybe_unused]] int glad_load_result = gladLoadGLLoader(loader);
         tz_assert(glad_load_result != 0, "gladLoadGLLoader returned error");
 
         glEnable(GL_DEBUG_OUTPUT);
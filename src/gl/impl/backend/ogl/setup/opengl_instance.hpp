@@ -11,7 +11,11 @@ namespace tz::gl::ogl
     public:
         static void opengl_debug_callback(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* message, const void* user_data);
 
-        OpenGLInstance(tz::GameInfo game_info);
+        /**
+         * @brief Load OpenGL functions for the current context.
+         * @param loader Retrieves function addresses for the current context, e.g glfwGetProcAddress.
+         */
+        OpenGLInstance(tz::GameInfo game_info, GLADloadproc loader);
         ~OpenGLInstance();
     };
 }
@@ -2,24 +2,29 @@
 #include "gl/impl/backend/ogl/tz_opengl.hpp"
 #include "core/assert.hpp"
 #include "core/report.hpp"
+#include "GLFW/glfw3.h"
 
 namespace tz::gl::ogl
 {
     OpenGLInstance* inst = nullptr;
+    HeadlessContext* headless_context = nullptr;
+    HeadlessFramebuffer* headless_framebuffer = nullptr;
 
     void initialise_headless(tz::GameInfo game_info)
     {
-        //tz_error("Headless is not supported for OpenGL. Sorry.");
         tz_assert(inst == nullptr, "Already initialised");
-        inst = new OpenGLInstance{game_info};
-        tz::Version v = ogl::get_opengl_version();
+        headless_context = new HeadlessContext;
+        inst = new OpenGLInstance{game_info, HeadlessContext::get_proc_address};
+        // Same size as the headless Vulkan backend renders at, so the two can be compared directly.
+        headless_framebuffer = new HeadlessFramebuffer{800, 600};
+        tz::Version v = headless_context->get_version();
         tz_report("OpenGL v%u.%u, Initialised (Headless)", v.major, v.minor);
     }
 
     void initialise(tz::GameInfo game_info)
     {
         tz_assert(inst == nullptr, "Already initialised");
-        inst = new OpenGLInstance{game_info};
+        inst = new OpenGLInstance{game_info, reinterpret_cast<GLADloadproc>(glfwGetProcAddress)};
         tz::Version v = ogl::get_opengl_version();
         tz_report("OpenGL v%u.%u Initialised (Window)", v.major, v.minor);
     }
@@ -27,8 +32,13 @@ namespace tz::gl::ogl
     void terminate()
     {
         tz_assert(inst != nullptr, "Not initialised");
+        // The framebuffer must go before the context it was created in.
+        delete headless_framebuffer;
+        headless_framebuffer = nullptr;
         delete inst;
         inst = nullptr;
+        delete headless_context;
+        headless_context = nullptr;
         tz_report("OpenGL Terminated");
     }
 
@@ -42,6 +52,17 @@ namespace tz::gl::ogl
     {
         return inst != nullptr;
     }
+
+    bool is_headless()
+    {
+        return headless_context != nullptr;
+    }
+
+    HeadlessFramebuffer& get_headless_framebuffer()
+    {
+        tz_assert(headless_framebuffer != nullptr, "Not headless");
+        return *headless_framebuffer;
+    }
 }
 
 #endif // TZ_OGL
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define TOPAZ_GL_OGL_TZ_OPENGL_HPP
 #if TZ_OGL
 #include "gl/impl/backend/ogl/setup/opengl_instance.hpp"
+#include "gl/impl/backend/ogl/setup/headless_context.hpp"
 
 namespace tz::gl::ogl
 {
@@ -10,6 +11,12 @@ namespace tz::gl::ogl
     void terminate();
     OpenGLInstance& get();
     bool is_initialised();
+    bool is_headless();
+    /**
+     * @brief Retrieve the framebuffer which stands in for the window's default framebuffer.
+     * @pre Headless only.
+     */
+    HeadlessFramebuffer& get_headless_framebuffer();
 
     constexpr static tz::Version get_opengl_version()
     {
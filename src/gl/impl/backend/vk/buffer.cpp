@@ -52,7 +52,18 @@ namespace tz::gl::vk
                 tz_error("Unrecognised BufferPurpose");
             break;
         }
-        create.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        // Transfer destinations may be written by a dedicated transfer queue and then read by the graphics queue. Sharing them saves a queue family ownership transfer on both sides.
+        std::vector<std::uint32_t> family_indices = device.get_queue_family_indices();
+        if(purpose == BufferPurpose::TransferDestination && family_indices.size() > 1)
+        {
+            create.sharingMode = VK_SHARING_MODE_CONCURRENT;
+            create.queueFamilyIndexCount = family_indices.size();
+            create.pQueueFamilyIndices = family_indices.data();
+        }
+        else
+        {
+            create.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        }
 
         VmaAllocationCreateInfo alloc_info{};
         switch(residency)
@@ -63,6 +74,11 @@ namespace tz::gl::vk
             case hardware::MemoryResidency::CPU:
                 alloc_info.usage = VMA_MEMORY_USAGE_CPU_ONLY;
             break;
+            case hardware::MemoryResidency::CPUReadback:
+                // Prefers cached memory, which is much faster for the host to read from. It may not be coherent, so reads should be preceded by Buffer::invalidate.
+                alloc_info.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
+                alloc_info.usage = VMA_MEMORY_USAGE_GPU_TO_CPU;
+            break;
             case hardware::MemoryResidency::GPU:
                 alloc_info.usage = VMA_MEMORY_USAGE_GPU_ONLY;
             break;
@@ -73,7 +89,7 @@ namespace tz::gl::vk
 
         VmaAllocationInfo alloc_result;
         auto res = vmaCreateBuffer(this->device->native_allocator(), &create, &alloc_info, &this->buffer, &this->alloc, &alloc_result);
-        if(residency == hardware::MemoryResidency::CPUPersistent)
+        if(residency == hardware::MemoryResidency::CPUPersistent || residency == hardware::MemoryResidency::CPUReadback)
         {
             this->persistent_mapped_ptr = alloc_result.pMappedData;
         }
@@ -135,6 +151,18 @@ namespace tz::gl::vk
         vmaUnmapMemory(this->device->native_allocator(), this->alloc);
     }
 
+    void Buffer::flush(std::size_t offset, std::size_t length)
+    {
+        this->ensure_notnull();
+        vmaFlushAllocation(this->device->native_allocator(), this->alloc, offset, length);
+    }
+
+    void Buffer::invalidate(std::size_t offset, std::size_t length)
+    {
+        this->ensure_notnull();
+        vmaInvalidateAllocation(this->device->native_allocator(), this->alloc, offset, length);
+    }
+
     Buffer& Buffer::operator=(Buffer&& rhs)
     {
         std::swap(this->buffer, rhs.buffer);
@@ -37,6 +37,14 @@ namespace tz::gl::vk
         void write(const void* addr, std::size_t bytes);
         void* map_memory();
         void unmap_memory();
+        /**
+         * @brief Make host writes to the given range of mapped memory visible to the device. Does nothing if the memory is host-coherent.
+         */
+        void flush(std::size_t offset, std::size_t length);
+        /**
+         * @brief Make device writes to the given range of mapped memory visible to the host. Does nothing if the memory is host-coherent.
+         */
+        void invalidate(std::size_t offset, std::size_t length);
 
         VkBuffer native() const;
         bool is_null() const;
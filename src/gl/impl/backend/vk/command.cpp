@@ -1,6 +1,8 @@
 #if TZ_VULKAN
 
 #include "gl/impl/backend/vk/command.hpp"
+#include "gl/impl/backend/vk/render_pass.hpp"
+#include "gl/impl/backend/vk/framebuffer.hpp"
 
 namespace tz::gl::vk
 {
@@ -24,24 +26,24 @@ namespace tz::gl::vk
         return *this;
     }
 
-    void CommandBufferRecording::buffer_copy_buffer(const Buffer& source, Buffer& destination, std::size_t copy_bytes_length)
+    void CommandBufferRecording::buffer_copy_buffer(const Buffer& source, Buffer& destination, std::size_t copy_bytes_length, std::size_t source_offset, std::size_t destination_offset)
     {
         tz_assert(!source.is_null(), "Attempted to record a buffer->buffer copy where the source is a null buffer.");
         tz_assert(!destination.is_null(), "Attempted to record a buffer->buffer copy where the destination is a null buffer.");
 
         VkBufferCopy cpy{};
-        cpy.dstOffset = 0;
-        cpy.srcOffset = 0;
+        cpy.dstOffset = destination_offset;
+        cpy.srcOffset = source_offset;
         cpy.size = copy_bytes_length;
 
         vkCmdCopyBuffer(this->command_buffer->native(), source.native(), destination.native(), 1, &cpy);
     }
 
-    void CommandBufferRecording::buffer_copy_image(const Buffer& source, Image& destination)
+    void CommandBufferRecording::buffer_copy_image(const Buffer& source, Image& destination, std::size_t source_offset)
     {
         tz_assert(!source.is_null(), "Attempted to record a buffer->image copy where the source is a null buffer.");
         VkBufferImageCopy cpy{};
-        cpy.bufferOffset = 0;
+        cpy.bufferOffset = source_offset;
         cpy.bufferRowLength = 0;
         cpy.bufferImageHeight = 0;
 
@@ -60,6 +62,41 @@ namespace tz::gl::vk
         vkCmdCopyBufferToImage(this->command_buffer->native(), source.native(), destination.native(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &cpy);
     }
 
+    void CommandBufferRecording::image_copy_buffer(const Image& source, Buffer& destination, std::size_t destination_offset)
+    {
+        tz_assert(!destination.is_null(), "Attempted to record an image->buffer copy where the destination is a null buffer.");
+        VkBufferImageCopy cpy{};
+        cpy.bufferOffset = destination_offset;
+        cpy.bufferRowLength = 0;
+        cpy.bufferImageHeight = 0;
+
+        cpy.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        cpy.imageSubresource.mipLevel = 0;
+        cpy.imageSubresource.baseArrayLayer = 0;
+        cpy.imageSubresource.layerCount = 1;
+
+        cpy.imageOffset = {0, 0, 0};
+        cpy.imageExtent = {
+            source.get_width(),
+            source.get_height(),
+            1
+        };
+
+        vkCmdCopyImageToBuffer(this->command_buffer->native(), source.native(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, destination.native(), 1, &cpy);
+
+        // The host is going to read the result.
+        VkBufferMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.buffer = destination.native();
+        barrier.offset = destination_offset;
+        barrier.size = VK_WHOLE_SIZE;
+        vkCmdPipelineBarrier(this->command_buffer->native(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr, 1, &barrier, 0, nullptr);
+    }
+
     void CommandBufferRecording::transition_image_layout(Image& image, Image::Layout new_layout)
     {
         VkImageMemoryBarrier barrier{};
@@ -102,8 +139,17 @@ namespace tz::gl::vk
                 destination_stage = VK_PIPELINE_STAGE_TRANSFER_BIT;
             break;
             case Image::Layout::ShaderResource:
-                barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-                destination_stage = VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT;
+                if(this->command_buffer->supports_graphics())
+                {
+                    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+                    destination_stage = VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT;
+                }
+                else
+                {
+                    // e.g a dedicated transfer queue, which cannot name graphics stages. Whoever reads the image must wait on a semaphore signalled by this submission instead.
+                    barrier.dstAccessMask = 0;
+                    destination_stage = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+                }
             break;
             default:
                 tz_error("Image Destination Layout is NYI");
@@ -113,18 +159,18 @@ namespace tz::gl::vk
         vkCmdPipelineBarrier(this->command_buffer->native(), source_stage, destination_stage, 0, 0, nullptr, 0, nullptr, 1, &barrier);
     }
 
-    void CommandBufferRecording::bind(const Buffer& buf)
+    void CommandBufferRecording::bind(const Buffer& buf, std::size_t offset)
     {
         tz_assert(!buf.is_null(), "Attempted to record a bind for a null buffer.");
         auto buf_native = buf.native();
-        VkDeviceSize offsets[] = {0};
+        VkDeviceSize offsets[] = {offset};
         switch(buf.get_type())
         {
             case BufferType::Vertex:
                 vkCmdBindVertexBuffers(this->command_buffer->native(), 0, 1, &buf_native, offsets);
             break;
             case BufferType::Index:
-                vkCmdBindIndexBuffer(this->command_buffer->native(), buf_native, 0, VK_INDEX_TYPE_UINT32);
+                vkCmdBindIndexBuffer(this->command_buffer->native(), buf_native, offset, VK_INDEX_TYPE_UINT32);
             break;
             default:
                 tz_error("Attempting to bind buffer, but its BufferType is unsupported");
@@ -148,27 +194,58 @@ namespace tz::gl::vk
         vkCmdDrawIndexed(this->command_buffer->native(), index_count, inst_count, first_index, vertex_offset, first_instance);
     }
 
-    void CommandBufferRecording::draw_indirect(const vk::Buffer& draw_indirect_buffer, std::uint32_t draw_count)
+    void CommandBufferRecording::draw_indirect(const vk::Buffer& draw_indirect_buffer, std::uint32_t draw_count, std::size_t offset)
     {
         tz_assert(!draw_indirect_buffer.is_null(), "Attempted to record a draw-indirect, but the draw-indirect-buffer was a null buffer.");
-        vkCmdDrawIndexedIndirect(this->command_buffer->native(), draw_indirect_buffer.native(), 0, draw_count, sizeof(VkDrawIndexedIndirectCommand));
+        vkCmdDrawIndexedIndirect(this->command_buffer->native(), draw_indirect_buffer.native(), offset, draw_count, sizeof(VkDrawIndexedIndirectCommand));
+    }
+
+    void CommandBufferRecording::set_viewport(const VkViewport& viewport)
+    {
+        vkCmdSetViewport(this->command_buffer->native(), 0, 1, &viewport);
+    }
+
+    void CommandBufferRecording::set_scissor(const VkRect2D& scissor)
+    {
+        vkCmdSetScissor(this->command_buffer->native(), 0, 1, &scissor);
+    }
+
+    void CommandBufferRecording::execute(const CommandBuffer& secondary)
+    {
+        tz_assert(secondary.get_level() == CommandBufferLevel::Secondary, "Attempted to execute a command buffer which is not a secondary command buffer.");
+        VkCommandBuffer secondary_native = secondary.native();
+        vkCmdExecuteCommands(this->command_buffer->native(), 1, &secondary_native);
+    }
+
+    void CommandBufferRecording::reset_queries(const TimestampQueryPool& pool, std::uint32_t first_query, std::uint32_t query_count)
+    {
+        tz_assert(first_query + query_count <= pool.get_query_count(), "CommandBufferRecording::reset_queries(...): Queries [%u, %u) are out of range (%u queries)", first_query, first_query + query_count, pool.get_query_count());
+        vkCmdResetQueryPool(this->command_buffer->native(), pool.native(), first_query, query_count);
     }
 
-    CommandBufferRecording::CommandBufferRecording(const CommandBuffer& buffer, std::function<void()> on_recording_end):
+    void CommandBufferRecording::write_timestamp(const TimestampQueryPool& pool, std::uint32_t query, TimestampStage stage)
+    {
+        tz_assert(query < pool.get_query_count(), "CommandBufferRecording::write_timestamp(...): Query %u is out of range (%u queries)", query, pool.get_query_count());
+        vkCmdWriteTimestamp(this->command_buffer->native(), static_cast<VkPipelineStageFlagBits>(stage), pool.native(), query);
+    }
+
+    CommandBufferRecording::CommandBufferRecording(const CommandBuffer& buffer, std::function<void()> on_recording_end, const VkCommandBufferInheritanceInfo* inheritance):
     command_buffer(&buffer),
     on_recording_end(on_recording_end)
     {
         VkCommandBufferBeginInfo begin{};
         begin.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-        begin.pInheritanceInfo = nullptr;
-        begin.flags = 0;
+        begin.pInheritanceInfo = inheritance;
+        begin.flags = inheritance != nullptr ? VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT : 0;
 
         auto res = vkBeginCommandBuffer(this->command_buffer->native(), &begin);
         tz_assert(res == VK_SUCCESS, "Failed to begin command buffer recording");
     }
 
-    CommandBuffer::CommandBuffer([[maybe_unused]] const CommandPool& parent):
+    CommandBuffer::CommandBuffer(const CommandPool& parent, CommandBufferLevel level):
     command_buffer(VK_NULL_HANDLE),
+    level(level),
+    graphics_capable(parent.get_queue_types().contains(hardware::QueueFamilyType::Graphics)),
     currently_recording(false)
     {
         // Note: this->command_buffer is handled by CommandPool.
@@ -180,6 +257,28 @@ namespace tz::gl::vk
         return {*this, [this](){this->notify_recording_end();}};
     }
 
+    CommandBufferRecording CommandBuffer::record_secondary(const RenderPass& render_pass, const Framebuffer& framebuffer)
+    {
+        tz_assert(this->level == CommandBufferLevel::Secondary, "Attempted to record a primary command buffer as if it were a secondary command buffer.");
+        this->notify_recording_begin();
+        VkCommandBufferInheritanceInfo inheritance{};
+        inheritance.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+        inheritance.renderPass = render_pass.native();
+        inheritance.subpass = 0;
+        inheritance.framebuffer = framebuffer.native();
+        return {*this, [this](){this->notify_recording_end();}, &inheritance};
+    }
+
+    CommandBufferLevel CommandBuffer::get_level() const
+    {
+        return this->level;
+    }
+
+    bool CommandBuffer::supports_graphics() const
+    {
+        return this->graphics_capable;
+    }
+
     VkCommandBuffer CommandBuffer::native() const
     {
         return this->command_buffer;
@@ -205,7 +304,9 @@ namespace tz::gl::vk
 
     CommandPool::CommandPool(const LogicalDevice& device, const hardware::DeviceQueueFamily& queue_family):
     command_pool(VK_NULL_HANDLE),
-    device(&device)
+    device(&device),
+    queue_types(queue_family.types_supported),
+    buffers()
     {
         VkCommandPoolCreateInfo create{};
         create.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
@@ -218,7 +319,9 @@ namespace tz::gl::vk
 
     CommandPool::CommandPool(const LogicalDevice& device, const hardware::DeviceQueueFamily& queue_family, [[maybe_unused]] RecycleableBufferTag recycleable):
     command_pool(VK_NULL_HANDLE),
-    device(&device)
+    device(&device),
+    queue_types(queue_family.types_supported),
+    buffers()
     {
         VkCommandPoolCreateInfo create{};
         create.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
@@ -233,6 +336,7 @@ namespace tz::gl::vk
     CommandPool::CommandPool(CommandPool&& move):
     command_pool(VK_NULL_HANDLE),
     device(nullptr),
+    queue_types(),
     buffers()
     {
         *this = std::move(move);
@@ -251,6 +355,7 @@ namespace tz::gl::vk
     {
         std::swap(this->command_pool, rhs.command_pool);
         std::swap(this->device, rhs.device);
+        std::swap(this->queue_types, rhs.queue_types);
         std::swap(this->buffers, rhs.buffers);
         return *this;
     }
@@ -260,6 +365,11 @@ namespace tz::gl::vk
         return this->command_pool;
     }
 
+    const hardware::QueueFamilyTypeField& CommandPool::get_queue_types() const
+    {
+        return this->queue_types;
+    }
+
     bool CommandPool::empty() const
     {
         return this->buffers.empty();
@@ -7,12 +7,23 @@
 #include "gl/impl/backend/vk/descriptor.hpp"
 #include "gl/impl/backend/vk/pipeline/layout.hpp"
 #include "gl/impl/backend/vk/image.hpp"
+#include "gl/impl/backend/vk/query_pool.hpp"
 #include <functional>
 
 namespace tz::gl::vk
 {
     class CommandPool;
     class CommandBuffer;
+    class RenderPass;
+    class Framebuffer;
+
+    enum class CommandBufferLevel
+    {
+        /// Can be submitted to a queue directly.
+        Primary,
+        /// Cannot be submitted, but can be executed by a primary command buffer. Secondary command buffers may be recorded on other threads so long as they belong to a different CommandPool.
+        Secondary
+    };
 
     class CommandBufferRecording
     {
@@ -23,18 +34,48 @@ namespace tz::gl::vk
         CommandBufferRecording& operator=(const CommandBufferRecording& rhs) = delete;
         CommandBufferRecording& operator=(CommandBufferRecording&& rhs);
 
-        void buffer_copy_buffer(const Buffer& source, Buffer& destination, std::size_t copy_bytes_length);
-        void buffer_copy_image(const Buffer& source, Image& destination);
+        void buffer_copy_buffer(const Buffer& source, Buffer& destination, std::size_t copy_bytes_length, std::size_t source_offset = 0, std::size_t destination_offset = 0);
+        void buffer_copy_image(const Buffer& source, Image& destination, std::size_t source_offset = 0);
+        /**
+         * @brief Copy the whole of an image into a buffer, tightly packed. Once the command buffer has finished, the copied data is visible to the host (after @ref Buffer::invalidate).
+         * @pre `source` must be in the `TransferSource` layout, and any prior writes to it must be visible to transfer reads.
+         */
+        void image_copy_buffer(const Image& source, Buffer& destination, std::size_t destination_offset = 0);
         void transition_image_layout(Image& image, Image::Layout new_layout);
-        void bind(const Buffer& buf);
+        void bind(const Buffer& buf, std::size_t offset = 0);
         void bind(const DescriptorSet& descriptor_set, const pipeline::Layout& layout);
         void draw(std::uint32_t vertex_count, std::uint32_t instance_count = 1, std::uint32_t first_index = 0, std::uint32_t first_instance = 0);
         void draw_indexed(std::uint32_t index_count, std::uint32_t instance_count = 1, std::uint32_t first_index = 0, std::uint32_t vertex_offset = 0, std::uint32_t first_instance = 0);
-        void draw_indirect(const vk::Buffer& draw_indirect_buffer, std::uint32_t draw_count);
+        void draw_indirect(const vk::Buffer& draw_indirect_buffer, std::uint32_t draw_count, std::size_t offset = 0);
+        /**
+         * @brief Set the viewport for subsequent draws.
+         * @pre The bound pipeline must have been created with @ref pipeline::DynamicStateType::ViewportDimensions.
+         */
+        void set_viewport(const VkViewport& viewport);
+        /**
+         * @brief Set the scissor rectangle for subsequent draws.
+         * @pre The bound pipeline must have been created with @ref pipeline::DynamicStateType::ScissorDimensions.
+         */
+        void set_scissor(const VkRect2D& scissor);
+        /**
+         * @brief Execute the commands within a secondary command buffer.
+         * @pre `secondary` must have finished recording, and must have been recorded for the render pass currently running within this command buffer.
+         */
+        void execute(const CommandBuffer& secondary);
+        /**
+         * @brief Reset a range of queries so that they can be written again. Their previous results are lost.
+         * @pre Must not be recorded within a render pass.
+         */
+        void reset_queries(const TimestampQueryPool& pool, std::uint32_t first_query, std::uint32_t query_count);
+        /**
+         * @brief Write the current GPU time into the given query once the given stage is reached.
+         * @pre The query must have been reset since it was last written.
+         */
+        void write_timestamp(const TimestampQueryPool& pool, std::uint32_t query, TimestampStage stage);
 
         friend class CommandBuffer;
     private:
-        CommandBufferRecording(const CommandBuffer& buffer, std::function<void()> on_recording_end);
+        CommandBufferRecording(const CommandBuffer& buffer, std::function<void()> on_recording_end, const VkCommandBufferInheritanceInfo* inheritance = nullptr);
         const CommandBuffer* command_buffer;
         std::function<void()> on_recording_end;
     };
@@ -46,8 +87,18 @@ namespace tz::gl::vk
         struct OneTimeUseTag{};
         static constexpr OneTimeUseTag OneTimeUse{};
 
-        CommandBuffer(const CommandPool& parent);
+        CommandBuffer(const CommandPool& parent, CommandBufferLevel level = CommandBufferLevel::Primary);
         CommandBufferRecording record();
+        /**
+         * @brief Begin recording a secondary command buffer whose commands will be executed entirely within the first subpass of the given render pass.
+         * @pre This must be a secondary command buffer.
+         */
+        CommandBufferRecording record_secondary(const RenderPass& render_pass, const Framebuffer& framebuffer);
+        CommandBufferLevel get_level() const;
+        /**
+         * @brief Query whether the command buffer can be submitted to a queue which supports graphics. If not, commands recorded within it cannot reference graphics pipeline stages.
+         */
+        bool supports_graphics() const;
         VkCommandBuffer native() const;
 
         void reset();
@@ -55,6 +106,8 @@ namespace tz::gl::vk
         void notify_recording_begin();
         void notify_recording_end();
         VkCommandBuffer command_buffer;
+        CommandBufferLevel level;
+        bool graphics_capable;
         bool currently_recording;
     };
 
@@ -74,6 +127,7 @@ namespace tz::gl::vk
         CommandPool& operator=(CommandPool&& rhs);
 
         VkCommandPool native() const;
+        const hardware::QueueFamilyTypeField& get_queue_types() const;
         template<typename... Args>
         std::size_t with(std::size_t count, Args&&... args);
         bool empty() const;
@@ -86,6 +140,7 @@ namespace tz::gl::vk
         
         VkCommandPool command_pool;
         const LogicalDevice* device;
+        hardware::QueueFamilyTypeField queue_types;
         std::vector<CommandBuffer> buffers;
     };
 }
@@ -11,15 +11,20 @@ namespace tz::gl::vk
         {
             this->buffers.emplace_back(*this, std::forward<Args>(args)...);
         }
+        if(count == 0)
+        {
+            return index;
+        }
         auto buffer_natives = this->get_buffer_natives();
         VkCommandBufferAllocateInfo info{};
         info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
         info.commandPool = this->command_pool;
-        info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        info.level = this->buffers.back().get_level() == CommandBufferLevel::Secondary ? VK_COMMAND_BUFFER_LEVEL_SECONDARY : VK_COMMAND_BUFFER_LEVEL_PRIMARY;
         info.commandBufferCount = count;
 
-        auto res = vkAllocateCommandBuffers(this->device->native(), &info, buffer_natives.data());
-        for(std::size_t i = 0; i < this->buffers.size(); i++)
+        // Only the new buffers are allocated, so don't overwrite the natives of any existing ones.
+        auto res = vkAllocateCommandBuffers(this->device->native(), &info, buffer_natives.data() + index);
+        for(std::size_t i = index; i < this->buffers.size(); i++)
         {
             this->buffers[i].command_buffer = buffer_natives[i];
         }
@@ -0,0 +1,58 @@
+#if TZ_VULKAN
+#include "core/assert.hpp"
+#include "gl/impl/backend/vk/deletion_queue.hpp"
+#include <utility>
+
+namespace tz::gl::vk
+{
+    DeferredAction::DeferredAction(std::function<void()> action):
+    action(std::move(action))
+    {}
+
+    DeferredAction::DeferredAction(DeferredAction&& move):
+    action(std::exchange(move.action, nullptr))
+    {}
+
+    DeferredAction::~DeferredAction()
+    {
+        if(this->action)
+        {
+            this->action();
+        }
+    }
+
+    DeferredAction& DeferredAction::operator=(DeferredAction&& rhs)
+    {
+        std::swap(this->action, rhs.action);
+        return *this;
+    }
+
+    void DeletionQueue::defer(Resource resource, std::uint64_t last_used_frame)
+    {
+        tz_assert(this->entries.empty() || this->entries.back().last_used_frame <= last_used_frame, "DeletionQueue::defer: Frame %llu is older than the last deferred frame (%llu). Frame values must not decrease.", static_cast<unsigned long long>(last_used_frame), static_cast<unsigned long long>(this->entries.back().last_used_frame));
+        this->entries.push_back({.resource = std::move(resource), .last_used_frame = last_used_frame});
+    }
+
+    std::size_t DeletionQueue::collect(std::uint64_t retired_frame)
+    {
+        std::size_t destroyed = 0;
+        while(!this->entries.empty() && this->entries.front().last_used_frame <= retired_frame)
+        {
+            this->entries.pop_front();
+            destroyed++;
+        }
+        return destroyed;
+    }
+
+    std::size_t DeletionQueue::size() const
+    {
+        return this->entries.size();
+    }
+
+    bool DeletionQueue::empty() const
+    {
+        return this->entries.empty();
+    }
+}
+
+#endif // TZ_VULKAN
@@ -0,0 +1,75 @@
+#ifndef TOPAZ_GL_VK_DELETION_QUEUE_HPP
+#define TOPAZ_GL_VK_DELETION_QUEUE_HPP
+#if TZ_VULKAN
+#include "gl/impl/backend/vk/buffer.hpp"
+#include "gl/impl/backend/vk/command.hpp"
+#include "gl/impl/backend/vk/framebuffer.hpp"
+#include "gl/impl/backend/vk/image.hpp"
+#include "gl/impl/backend/vk/image_view.hpp"
+#include "gl/impl/backend/vk/pipeline/graphics_pipeline.hpp"
+#include "gl/impl/backend/vk/query_pool.hpp"
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <variant>
+
+namespace tz::gl::vk
+{
+    /**
+     * @brief Invokes a function when destroyed. This lets @ref DeletionQueue defer work which isn't destroying a Vulkan object, such as returning memory to an allocator.
+     */
+    class DeferredAction
+    {
+    public:
+        DeferredAction(std::function<void()> action);
+        DeferredAction(const DeferredAction& copy) = delete;
+        DeferredAction(DeferredAction&& move);
+        ~DeferredAction();
+
+        DeferredAction& operator=(const DeferredAction& rhs) = delete;
+        DeferredAction& operator=(DeferredAction&& rhs);
+    private:
+        std::function<void()> action;
+    };
+
+    /**
+     * @brief Holds onto resources which may still be in use by frames in flight, destroying them once those frames have been retired.
+     * @details Frames are identified by the values handed out by @ref FrameAdmin (see @ref FrameAdmin::get_frame_value). This allows resources to be replaced at runtime without blocking until the device is idle.
+     */
+    class DeletionQueue
+    {
+    public:
+        using Resource = std::variant<Buffer, Image, ImageView, Framebuffer, GraphicsPipeline, CommandPool, TimestampQueryPool, DeferredAction>;
+
+        DeletionQueue() = default;
+        /**
+         * @brief Take ownership of a resource, which will be destroyed once the given frame has been retired.
+         * @param resource Resource to destroy later.
+         * @param last_used_frame Value of the last frame which may use the resource. Usually the most recently submitted frame.
+         */
+        void defer(Resource resource, std::uint64_t last_used_frame);
+        /**
+         * @brief Destroy every resource whose last frame has been retired.
+         * @param retired_frame Value of the most recent frame the GPU has finished (see @ref FrameAdmin::get_retired_frame_value).
+         * @return Number of resources destroyed.
+         */
+        std::size_t collect(std::uint64_t retired_frame);
+        /**
+         * @brief Retrieve the number of resources waiting to be destroyed.
+         */
+        std::size_t size() const;
+        bool empty() const;
+    private:
+        struct Entry
+        {
+            Resource resource;
+            std::uint64_t last_used_frame;
+        };
+
+        /// Frame values only ever increase, so entries are sorted by `last_used_frame`.
+        std::deque<Entry> entries;
+    };
+}
+
+#endif // TZ_VULKAN
+#endif // TOPAZ_GL_VK_DELETION_QUEUE_HPP
@@ -47,6 +47,11 @@ namespace tz::gl::vk
         vkWaitForFences(this->device->native(), 1, &this->fence, VK_TRUE, std::numeric_limits<std::uint64_t>::max());
     }
 
+    bool Fence::is_signalled() const
+    {
+        return vkGetFenceStatus(this->device->native(), this->fence) == VK_SUCCESS;
+    }
+
     void Fence::signal() const
     { 
         vkResetFences(this->device->native(), 1, &this->fence);
@@ -18,6 +18,10 @@ namespace tz::gl::vk
 
         VkFence native() const;
         void wait_for() const;
+        /**
+         * @brief Query whether the fence is currently signalled, without waiting.
+         */
+        bool is_signalled() const;
         void signal() const;
         void wait_then_signal() const;
     private:
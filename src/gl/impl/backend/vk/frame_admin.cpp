@@ -1,27 +1,44 @@
 #if TZ_VULKAN
+#include "core/profile.hpp"
 #include "gl/impl/backend/vk/frame_admin.hpp"
 #include "gl/impl/backend/vk/present.hpp"
+#include <algorithm>
 
 namespace tz::gl::vk
 {
-    FrameAdmin::FrameAdmin(const LogicalDevice& device, std::size_t frame_depth):
+    FrameAdmin::FrameAdmin(const LogicalDevice& device, std::size_t frame_depth, FrameSyncMode sync_mode):
     device(&device),
     frame_depth(frame_depth),
-    image_index_at_frame(),
+    sync_mode(sync_mode),
     frame_counter(0),
     cur_image_index(0),
     image_available_semaphores(),
     render_finish_semaphores(),
     in_flight_fences(),
-    images_in_flight(),
-    regenerate_function(nullptr)
+    frame_timeline(std::nullopt),
+    frame_value(0),
+    slot_frame_values(frame_depth, 0),
+    image_frame_values(),
+    regenerate_function(nullptr),
+    pre_submit_function(nullptr),
+    extra_waits()
     {
-        this->image_index_at_frame.resize(this->frame_depth, std::numeric_limits<std::size_t>::max());
         for(std::size_t i = 0; i < this->frame_depth; i++)
         {
             this->image_available_semaphores.emplace_back(device);
             this->render_finish_semaphores.emplace_back(device);
-            this->in_flight_fences.emplace_back(device);
+        }
+        switch(this->sync_mode)
+        {
+            case FrameSyncMode::Fences:
+                for(std::size_t i = 0; i < this->frame_depth; i++)
+                {
+                    this->in_flight_fences.emplace_back(device);
+                }
+            break;
+            case FrameSyncMode::TimelineSemaphore:
+                this->frame_timeline.emplace(device, 0);
+            break;
         }
     }
 
@@ -32,12 +49,13 @@ namespace tz::gl::vk
 
     void FrameAdmin::render_frame(hardware::Queue queue, const Swapchain& swapchain, const CommandPool& command_pool, WaitStages wait_stages)
     {
-        if(this->images_in_flight.empty())
+        tz_profile_scope("FrameAdmin::render_frame");
+        if(this->image_frame_values.size() < swapchain.get_image_views().size())
         {
-            this->images_in_flight.resize(swapchain.get_image_views().size(), nullptr);
+            this->image_frame_values.resize(swapchain.get_image_views().size(), 0);
         }
         std::size_t& i = this->frame_counter;
-        this->in_flight_fences[i].wait_for();
+        this->wait_for_frame(this->slot_frame_values[i]);
 
         auto acquisition = swapchain.acquire_next_image_index(this->image_available_semaphores[i]);
         if(!acquisition.index.has_value())
@@ -60,17 +78,18 @@ namespace tz::gl::vk
             }
         }
         this->cur_image_index = acquisition.index.value();
-        // If previous frames at this counter still have work going, we need to wait on it.
-        if(this->images_in_flight[cur_image_index] != nullptr)
+        // If a previous frame rendering to this image still has work going, we need to wait on it.
+        this->wait_for_frame(this->image_frame_values[cur_image_index]);
+
+        if(this->pre_submit_function != nullptr)
         {
-            this->images_in_flight[cur_image_index]->wait_for();
+            this->pre_submit_function(this->cur_image_index);
         }
 
-        this->images_in_flight[cur_image_index] = &this->in_flight_fences[i];
-        this->image_index_at_frame[cur_image_index] = i;
         vk::Submit submit{CommandBuffers{command_pool[cur_image_index]}, SemaphoreRefs{this->image_available_semaphores[i]}, wait_stages, SemaphoreRefs{this->render_finish_semaphores[i]}};
-        this->in_flight_fences[i].signal();
-        submit(queue, this->in_flight_fences[i]);
+        this->add_extra_waits(submit);
+        this->submit_frame(submit, queue);
+        this->image_frame_values[cur_image_index] = this->frame_value;
 
         vk::Present present{swapchain, cur_image_index, vk::SemaphoreRefs{this->render_finish_semaphores[i]}};
         present(queue);
@@ -79,27 +98,35 @@ namespace tz::gl::vk
 
     void FrameAdmin::render_frame_headless(hardware::Queue queue, const CommandPool& command_pool, WaitStages wait_stages)
     {
-        if(this->images_in_flight.empty())
+        tz_profile_scope("FrameAdmin::render_frame_headless");
+        if(this->image_frame_values.size() < this->frame_depth)
         {
-            this->images_in_flight.resize(this->frame_depth, nullptr);
+            this->image_frame_values.resize(this->frame_depth, 0);
         }
         this->cur_image_index = frame_counter;
         std::size_t& i = frame_counter;
 
         // If previous frames at this counter still have work going, we need to wait on it.
-        if(this->images_in_flight[cur_image_index] != nullptr)
+        this->wait_for_frame(this->slot_frame_values[i]);
+
+        if(this->pre_submit_function != nullptr)
         {
-            this->images_in_flight[cur_image_index]->wait_for();
+            this->pre_submit_function(this->cur_image_index);
         }
 
-        this->images_in_flight[cur_image_index] = &this->in_flight_fences[i];
         vk::Submit submit{CommandBuffers{command_pool[cur_image_index]}, SemaphoreRefs{}, wait_stages, SemaphoreRefs{}};
-        this->in_flight_fences[i].signal();
-        submit(queue, this->in_flight_fences[i]);
+        this->add_extra_waits(submit);
+        this->submit_frame(submit, queue);
+        this->image_frame_values[cur_image_index] = this->frame_value;
 
         i = (i + 1) % this->frame_depth;
     }
 
+    void FrameAdmin::wait_on_next_submit(const Semaphore& semaphore, WaitStage wait_stage)
+    {
+        this->extra_waits.emplace_back(&semaphore, wait_stage);
+    }
+
     std::size_t FrameAdmin::get_image_index() const
     {
         return this->cur_image_index;
@@ -107,15 +134,102 @@ namespace tz::gl::vk
 
     void FrameAdmin::wait_for(std::size_t cmd_buf_id) const
     {
-        std::size_t image_index = this->image_index_at_frame[cmd_buf_id];
-        if(image_index == std::numeric_limits<std::size_t>::max())
+        if(cmd_buf_id >= this->image_frame_values.size())
         {
             // Never rendered for this image index, therefore the command buffer must be free.
             return;
         }
-        this->in_flight_fences[image_index].wait_for();
+        this->wait_for_frame(this->image_frame_values[cmd_buf_id]);
+    }
+
+    FrameSyncMode FrameAdmin::get_sync_mode() const
+    {
+        return this->sync_mode;
+    }
+
+    std::uint64_t FrameAdmin::get_frame_value() const
+    {
+        return this->frame_value;
+    }
+
+    std::uint64_t FrameAdmin::get_retired_frame_value() const
+    {
+        switch(this->sync_mode)
+        {
+            case FrameSyncMode::TimelineSemaphore:
+                return this->frame_timeline->get_value();
+            break;
+            case FrameSyncMode::Fences:
+            {
+                // Everything before the oldest frame still in flight has been retired.
+                std::uint64_t retired = this->frame_value;
+                for(std::size_t i = 0; i < this->frame_depth; i++)
+                {
+                    std::uint64_t slot_frame = this->slot_frame_values[i];
+                    if(slot_frame != 0 && !this->in_flight_fences[i].is_signalled())
+                    {
+                        retired = std::min(retired, slot_frame - 1);
+                    }
+                }
+                return retired;
+            }
+            break;
+        }
+        return 0;
+    }
+
+    void FrameAdmin::wait_for_frame(std::uint64_t frame_value) const
+    {
+        if(frame_value == 0)
+        {
+            return;
+        }
+        tz_assert(frame_value <= this->frame_value, "FrameAdmin: Attempted to wait for frame %llu, but only %llu frames have been submitted.", static_cast<unsigned long long>(frame_value), static_cast<unsigned long long>(this->frame_value));
+        switch(this->sync_mode)
+        {
+            case FrameSyncMode::TimelineSemaphore:
+                this->frame_timeline->wait_for(frame_value);
+            break;
+            case FrameSyncMode::Fences:
+            {
+                // Frames use their slots in order. If the slot has been used by a later frame since, its fence was already waited on before it was reused.
+                std::size_t slot = (frame_value - 1) % this->frame_depth;
+                if(this->slot_frame_values[slot] == frame_value)
+                {
+                    this->in_flight_fences[slot].wait_for();
+                }
+            }
+            break;
+        }
+    }
+
+    void FrameAdmin::add_extra_waits(Submit& submit)
+    {
+        for(const auto& [semaphore, wait_stage] : this->extra_waits)
+        {
+            submit.add_wait(*semaphore, wait_stage);
+        }
+        this->extra_waits.clear();
     }
 
+    void FrameAdmin::submit_frame(Submit& submit, const hardware::Queue& queue)
+    {
+        std::size_t slot = this->frame_counter;
+        this->frame_value++;
+        this->slot_frame_values[slot] = this->frame_value;
+        switch(this->sync_mode)
+        {
+            case FrameSyncMode::Fences:
+                this->in_flight_fences[slot].signal();
+                submit(queue, this->in_flight_fences[slot]);
+            break;
+            case FrameSyncMode::TimelineSemaphore:
+                // The timeline's value becomes the frame value once the GPU is done with it, retiring every frame up to and including this one.
+                submit.add_timeline_signal(this->frame_timeline.value(), this->frame_value);
+                submit(queue);
+            break;
+        }
+    }
 }
 
 #endif // TZ_VULKAN
\ No newline at end of file
@@ -8,27 +8,83 @@
 
 namespace tz::gl::vk
 {
+    /**
+     * @brief Describes how a @ref FrameAdmin keeps track of which frames the GPU has finished.
+     */
+    enum class FrameSyncMode
+    {
+        /// A fence per frame in flight.
+        Fences,
+        /// A single timeline semaphore, whose value is the number of frames the GPU has finished. Requires @ref LogicalDevice::supports_timeline_semaphores().
+        TimelineSemaphore
+    };
+
+    /**
+     * @brief Submits frames, ensuring no more than `frame_depth` are in flight at once.
+     * @details Every submitted frame is given a value, starting at 1 and increasing by 1 each frame. A frame is retired once the GPU has finished it. Frames are always retired in order, so a single value describes everything the GPU is done with.
+     */
     class FrameAdmin
     {
     public:
-        FrameAdmin(const LogicalDevice& device, std::size_t frame_depth);
+        FrameAdmin(const LogicalDevice& device, std::size_t frame_depth, FrameSyncMode sync_mode = FrameSyncMode::Fences);
         ~FrameAdmin();
         void render_frame(hardware::Queue queue, const Swapchain& swapchain, const CommandPool& command_pool, WaitStages wait_stages);
         void render_frame_headless(hardware::Queue queue, const CommandPool& command_pool, WaitStages wait_stages);
         void set_regeneration_function(tz::Action auto regeneration_function);
+        /**
+         * @brief Provide a function which is invoked just before the command buffer for an image is submitted. At this point, it is guaranteed that the GPU is no longer using the command buffer (or anything it references), so it is safe to modify.
+         * @param pre_submit_function Invoked with the index of the command buffer which is about to be submitted.
+         */
+        void set_pre_submit_function(tz::Action<std::size_t> auto pre_submit_function);
+        /**
+         * @brief Make the next submitted frame wait on the given semaphore, in addition to what it normally waits on. May be called from within the pre-submit function.
+         * @pre `semaphore` must remain valid until the frame has finished rendering.
+         */
+        void wait_on_next_submit(const Semaphore& semaphore, WaitStage wait_stage);
         std::size_t get_image_index() const;
+        /**
+         * @brief Block until the GPU has finished the most recent frame which used the given command buffer.
+         */
         void wait_for(std::size_t cmd_buf_id) const;
-    private:        
+        FrameSyncMode get_sync_mode() const;
+        /**
+         * @brief Retrieve the value of the most recently submitted frame, or 0 if no frames have been submitted.
+         */
+        std::uint64_t get_frame_value() const;
+        /**
+         * @brief Retrieve the value of the most recent frame which the GPU has finished, without waiting. Every frame with a value less than or equal to this has also been retired.
+         */
+        std::uint64_t get_retired_frame_value() const;
+        /**
+         * @brief Block until the GPU has finished the frame with the given value. Returns immediately for frame 0.
+         */
+        void wait_for_frame(std::uint64_t frame_value) const;
+    private:
+        /// Add any waits requested via @ref FrameAdmin::wait_on_next_submit to the given submit.
+        void add_extra_waits(Submit& submit);
+        /// Submit the next frame using the current frame slot, giving it the next frame value.
+        void submit_frame(Submit& submit, const hardware::Queue& queue);
+
         const LogicalDevice* device;
         std::size_t frame_depth;
-        std::vector<std::size_t> image_index_at_frame;
+        FrameSyncMode sync_mode;
+        /// Index of the frame slot (semaphores and fence) which the next frame will use.
         std::size_t frame_counter;
         std::uint32_t cur_image_index;
         std::vector<Semaphore> image_available_semaphores;
         std::vector<Semaphore> render_finish_semaphores;
+        /// Only used with @ref FrameSyncMode::Fences.
         std::vector<Fence> in_flight_fences;
-        std::vector<Fence*> images_in_flight;
+        /// Only used with @ref FrameSyncMode::TimelineSemaphore.
+        std::optional<TimelineSemaphore> frame_timeline;
+        std::uint64_t frame_value;
+        /// Value of the frame which most recently used each frame slot.
+        std::vector<std::uint64_t> slot_frame_values;
+        /// Value of the frame which most recently rendered into each image.
+        std::vector<std::uint64_t> image_frame_values;
         std::function<void()> regenerate_function;
+        std::function<void(std::size_t)> pre_submit_function;
+        std::vector<std::pair<const Semaphore*, WaitStage>> extra_waits;
     };
 }
 
@@ -7,6 +7,11 @@ namespace tz::gl::vk
         this->regenerate_function = regeneration_function;
     }
 
+    void FrameAdmin::set_pre_submit_function(tz::Action<std::size_t> auto pre_submit_function)
+    {
+        this->pre_submit_function = pre_submit_function;
+    }
+
 }
 
 #endif // TZ_VULKAN
\ No newline at end of file
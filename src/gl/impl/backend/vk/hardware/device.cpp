@@ -36,7 +36,7 @@ namespace tz::gl::vk::hardware
         int i = 0;
         for(const VkQueueFamilyProperties& prop : queue_fams)
         {
-            DeviceQueueFamily fam{.dev = this, .index = i, .types_supported = {}};
+            DeviceQueueFamily fam{.dev = this, .index = i, .types_supported = {}, .timestamp_valid_bits = prop.timestampValidBits};
             VkQueueFlags flag = prop.queueFlags;
             
             // The following queue family types are represented with a special bit.
@@ -26,6 +26,8 @@ namespace tz::gl::vk::hardware
     {
         CPU,
         CPUPersistent,
+        /// Persistently mapped, for data written by the GPU and read back by the CPU.
+        CPUReadback,
         GPU
     };
 
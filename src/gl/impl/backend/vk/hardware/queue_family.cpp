@@ -1,9 +1,30 @@
 #if TZ_VULKAN
 #include "gl/impl/backend/vk/hardware/queue_family.hpp"
+#include "gl/impl/backend/vk/hardware/device.hpp"
 
 namespace tz::gl::vk::hardware
 {
-    
+    std::optional<DeviceQueueFamily> find_dedicated_transfer_queue_family(const Device& device)
+    {
+        std::optional<DeviceQueueFamily> best_family = std::nullopt;
+        for(DeviceQueueFamily queue_family : device.get_queue_families())
+        {
+            if(!queue_family.types_supported.contains(QueueFamilyType::Transfer) || queue_family.types_supported.contains(QueueFamilyType::Graphics))
+            {
+                continue;
+            }
+            // A transfer-only family is the copy engine itself. Async compute families can transfer too, but prefer not to share with compute work.
+            if(!queue_family.types_supported.contains(QueueFamilyType::Compute))
+            {
+                return queue_family;
+            }
+            if(!best_family.has_value())
+            {
+                best_family = queue_family;
+            }
+        }
+        return best_family;
+    }
 }
 
-#endif
\ No newline at end of file
+#endif
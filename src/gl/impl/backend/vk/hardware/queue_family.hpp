@@ -3,6 +3,7 @@
 #if TZ_VULKAN
 #include "vulkan/vulkan.h"
 #include "core/containers/enum_field.hpp"
+#include <cstdint>
 #include <optional>
 #include <span>
 #include <vector>
@@ -31,7 +32,15 @@ namespace tz::gl::vk::hardware
         const Device* dev;
         QueueFamilyIndex index;
         QueueFamilyTypeField types_supported;
+        /// Number of meaningful bits in timestamps written by queues of this family. Zero if timestamps are unsupported.
+        std::uint32_t timestamp_valid_bits;
     };
+
+    /**
+     * @brief Find a queue family on the device which supports transfer but not graphics. Such families usually map to dedicated copy hardware, so transfers submitted to them can run alongside rendering.
+     * @return The most specialised such family, or std::nullopt if every transfer-capable family also supports graphics.
+     */
+    std::optional<DeviceQueueFamily> find_dedicated_transfer_queue_family(const Device& device);
 }
 
 #endif
@@ -87,6 +87,24 @@ namespace tz::gl::vk::hardware
                     }
                 }
             break;
+            case SwapchainPresentModePreferences::PreferVsync:
+                for(VkPresentModeKHR present_mode : present_modes)
+                {
+                    if(present_mode == VK_PRESENT_MODE_FIFO_KHR)
+                    {
+                        return present_mode;
+                    }
+                }
+            break;
+            case SwapchainPresentModePreferences::PreferImmediate:
+                for(VkPresentModeKHR present_mode : present_modes)
+                {
+                    if(present_mode == VK_PRESENT_MODE_IMMEDIATE_KHR)
+                    {
+                        return present_mode;
+                    }
+                }
+            break;
             case SwapchainPresentModePreferences::DontCare:
                 if(!present_modes.empty())
                 {
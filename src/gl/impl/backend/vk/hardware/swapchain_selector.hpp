@@ -2,6 +2,7 @@
 #define TOPAZ_GL_VK_HARDWARE_SWAPCHAIN_SELECTOR_HPP
 #if TZ_VULKAN
 #include "vulkan/vulkan.h"
+#include <cstdint>
 #include <optional>
 #include <span>
 #include <vector>
@@ -20,7 +21,9 @@ namespace tz::gl::vk::hardware
 
     enum class SwapchainPresentModePreferences
     {
-        PreferTripleBuffering,
+        PreferTripleBuffering, // Mailbox: The newest image replaces any image waiting to be presented
+        PreferVsync, // FIFO: Images are queued and presented in order at the display's refresh rate. Always supported
+        PreferImmediate, // Immediate: Images are presented straight away, which may tear
         DontCare
     };
 
@@ -33,6 +36,8 @@ namespace tz::gl::vk::hardware
     {
         std::vector<SwapchainFormatPreferences> format_pref;
         std::vector<SwapchainPresentModePreferences> present_mode_pref;
+        /// Minimum number of swapchain images. If this is less than the surface's minimum (e.g 0), the surface's minimum is used instead.
+        std::uint32_t image_count = 0;
     };
 
     // TODO: (C++20 compiler support for constexpr std::vector) -- Make this constexpr
@@ -27,6 +27,14 @@ namespace tz::gl::vk
         create.usage = static_cast<VkImageUsageFlags>(static_cast<Image::Usage>(usage));
         create.samples = VK_SAMPLE_COUNT_1_BIT;
         create.flags = 0;
+        // See vk::Buffer. Images which can be copied into may be written by the transfer queue.
+        std::vector<std::uint32_t> family_indices = device.get_queue_family_indices();
+        if(usage.contains(Image::Usage::TransferDestination) && family_indices.size() > 1)
+        {
+            create.sharingMode = VK_SHARING_MODE_CONCURRENT;
+            create.queueFamilyIndexCount = family_indices.size();
+            create.pQueueFamilyIndices = family_indices.data();
+        }
 
         VmaAllocationCreateInfo alloc_info{};
         switch(residency)
@@ -2,28 +2,46 @@
 #include "gl/impl/backend/vk/logical_device.hpp"
 #include "gl/impl/backend/vk/tz_vulkan.hpp"
 #include "core/assert.hpp"
+#include <algorithm>
+#include <cstring>
 
 namespace tz::gl::vk
 {
-    LogicalDevice::LogicalDevice(hardware::DeviceQueueFamily queue_family, ExtensionList device_extensions, VkPhysicalDeviceFeatures features):
+    LogicalDevice::LogicalDevice(hardware::DeviceQueueFamily queue_family, ExtensionList device_extensions, VkPhysicalDeviceFeatures features, std::optional<hardware::DeviceQueueFamily> transfer_queue_family):
     dev(VK_NULL_HANDLE),
     queue_family(queue_family),
+    transfer_queue_family(transfer_queue_family),
+    timeline_semaphores(false),
     vma(std::nullopt)
     {
-        VkDeviceQueueCreateInfo queue_create{};
-        queue_create.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-        queue_create.queueFamilyIndex = queue_family.index;
-        queue_create.queueCount = 1;
-
+        tz_assert(!transfer_queue_family.has_value() || transfer_queue_family->index != queue_family.index, "tz::gl::vk::LogicalDevice(...): Dedicated transfer queue family must differ from the main queue family.");
         float queue_priority = 1.0f;
-        queue_create.pQueuePriorities = &queue_priority;
+        std::vector<VkDeviceQueueCreateInfo> queue_creates;
+        for(std::uint32_t family_index : this->get_queue_family_indices())
+        {
+            VkDeviceQueueCreateInfo& queue_create = queue_creates.emplace_back();
+            queue_create.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+            queue_create.queueFamilyIndex = family_index;
+            queue_create.queueCount = 1;
+            queue_create.pQueuePriorities = &queue_priority;
+        }
         
         VkDeviceCreateInfo create{};
         create.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
-        create.pQueueCreateInfos = &queue_create;
-        create.queueCreateInfoCount = 1;
+        create.pQueueCreateInfos = queue_creates.data();
+        create.queueCreateInfoCount = queue_creates.size();
         create.pEnabledFeatures = &features;
 
+        // Timeline semaphores are a feature as well as an extension, so need to be enabled separately.
+        VkPhysicalDeviceTimelineSemaphoreFeaturesKHR timeline_features{};
+        timeline_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR;
+        timeline_features.timelineSemaphore = VK_TRUE;
+        this->timeline_semaphores = std::any_of(device_extensions.begin(), device_extensions.end(), [](VulkanExtension extension){return std::strcmp(extension, VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME) == 0;});
+        if(this->timeline_semaphores)
+        {
+            create.pNext = &timeline_features;
+        }
+
         create.enabledExtensionCount = device_extensions.length();
         create.ppEnabledExtensionNames = device_extensions.data();
         // Note: In Vulkan 1.1.175, device-only layers are not a thing, they just use the instance layers.
@@ -50,6 +68,8 @@ namespace tz::gl::vk
     LogicalDevice::LogicalDevice(LogicalDevice&& move):
     dev(VK_NULL_HANDLE),
     queue_family(),
+    transfer_queue_family(std::nullopt),
+    timeline_semaphores(false),
     vma(std::nullopt)
     {
         *this = std::move(move);
@@ -72,6 +92,8 @@ namespace tz::gl::vk
     {
         std::swap(this->dev, rhs.dev);
         std::swap(this->queue_family, rhs.queue_family);
+        std::swap(this->transfer_queue_family, rhs.transfer_queue_family);
+        std::swap(this->timeline_semaphores, rhs.timeline_semaphores);
         std::swap(this->vma, rhs.vma);
         return *this;
     }
@@ -107,6 +129,40 @@ namespace tz::gl::vk
         return {*this, this->get_queue_family(), family_index};
     }
 
+    const hardware::DeviceQueueFamily& LogicalDevice::get_transfer_queue_family() const
+    {
+        if(this->transfer_queue_family.has_value())
+        {
+            return this->transfer_queue_family.value();
+        }
+        return this->queue_family;
+    }
+
+    hardware::Queue LogicalDevice::get_transfer_queue() const
+    {
+        return {*this, this->get_transfer_queue_family(), 0};
+    }
+
+    bool LogicalDevice::has_dedicated_transfer_queue() const
+    {
+        return this->transfer_queue_family.has_value();
+    }
+
+    std::vector<std::uint32_t> LogicalDevice::get_queue_family_indices() const
+    {
+        std::vector<std::uint32_t> family_indices{static_cast<std::uint32_t>(this->queue_family.index)};
+        if(this->transfer_queue_family.has_value())
+        {
+            family_indices.push_back(static_cast<std::uint32_t>(this->transfer_queue_family->index));
+        }
+        return family_indices;
+    }
+
+    bool LogicalDevice::supports_timeline_semaphores() const
+    {
+        return this->timeline_semaphores;
+    }
+
     void LogicalDevice::block_until_idle() const
     {
         vkDeviceWaitIdle(this->dev);
@@ -114,7 +170,9 @@ namespace tz::gl::vk
 
     LogicalDevice::LogicalDevice():
     dev(VK_NULL_HANDLE),
-    queue_family()
+    queue_family(),
+    transfer_queue_family(std::nullopt),
+    timeline_semaphores(false)
     {}
 }
 
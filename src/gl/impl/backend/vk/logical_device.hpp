@@ -13,7 +13,11 @@ namespace tz::gl::vk
     class LogicalDevice
     {
     public:
-        LogicalDevice(hardware::DeviceQueueFamily queue_family, ExtensionList device_extensions = {}, VkPhysicalDeviceFeatures features = vk::required_rendering_features());
+        /**
+         * @brief Create a logical device with a single queue from the given family.
+         * @param transfer_queue_family If provided, a second queue is created from this family and used for transfers. Otherwise, transfers share the queue from `queue_family`.
+         */
+        LogicalDevice(hardware::DeviceQueueFamily queue_family, ExtensionList device_extensions = {}, VkPhysicalDeviceFeatures features = vk::required_rendering_features(), std::optional<hardware::DeviceQueueFamily> transfer_queue_family = std::nullopt);
         LogicalDevice(const LogicalDevice& copy) = delete;
         LogicalDevice(LogicalDevice&& move);
         ~LogicalDevice();
@@ -28,6 +32,20 @@ namespace tz::gl::vk
         VkDevice native() const;
         VmaAllocator native_allocator() const;
         hardware::Queue get_hardware_queue(std::uint32_t family_index = 0) const;
+        /**
+         * @brief Retrieve the queue family transfers should be submitted to. This is the same as @ref LogicalDevice::get_queue_family() unless the device has a dedicated transfer queue.
+         */
+        const hardware::DeviceQueueFamily& get_transfer_queue_family() const;
+        hardware::Queue get_transfer_queue() const;
+        bool has_dedicated_transfer_queue() const;
+        /**
+         * @brief Retrieve the index of every queue family this device has a queue from. Resources written by one queue and read by another must be shared between all of these.
+         */
+        std::vector<std::uint32_t> get_queue_family_indices() const;
+        /**
+         * @brief Query whether @ref TimelineSemaphore can be used with this device. This is the case if the device was created with the VK_KHR_timeline_semaphore extension.
+         */
+        bool supports_timeline_semaphores() const;
 
         void block_until_idle() const;
     private:
@@ -35,6 +53,8 @@ namespace tz::gl::vk
 
         VkDevice dev;
         hardware::DeviceQueueFamily queue_family;
+        std::optional<hardware::DeviceQueueFamily> transfer_queue_family;
+        bool timeline_semaphores;
         std::optional<VmaAllocator> vma;
     };
 }
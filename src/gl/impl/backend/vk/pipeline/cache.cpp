@@ -0,0 +1,110 @@
+#if TZ_VULKAN
+#include "gl/impl/backend/vk/pipeline/cache.hpp"
+#include "core/assert.hpp"
+
+namespace tz::gl::vk
+{
+    PipelineCache::PipelineCache(const LogicalDevice& device, std::span<const std::byte> initial_data):
+    pipeline_cache(VK_NULL_HANDLE),
+    device(&device),
+    hit_count(0),
+    miss_count(0)
+    {
+        VkPipelineCacheCreateInfo create{};
+        create.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+        create.initialDataSize = initial_data.size_bytes();
+        create.pInitialData = initial_data.data();
+
+        auto res = vkCreatePipelineCache(this->device->native(), &create, nullptr, &this->pipeline_cache);
+        tz_assert(res == VK_SUCCESS, "Failed to create pipeline cache");
+    }
+
+    PipelineCache::PipelineCache(PipelineCache&& move):
+    PipelineCache()
+    {
+        *this = std::move(move);
+    }
+
+    PipelineCache::~PipelineCache()
+    {
+        if(this->pipeline_cache != VK_NULL_HANDLE)
+        {
+            vkDestroyPipelineCache(this->device->native(), this->pipeline_cache, nullptr);
+            this->pipeline_cache = VK_NULL_HANDLE;
+        }
+    }
+
+    PipelineCache& PipelineCache::operator=(PipelineCache&& rhs)
+    {
+        std::swap(this->pipeline_cache, rhs.pipeline_cache);
+        std::swap(this->device, rhs.device);
+        std::swap(this->hit_count, rhs.hit_count);
+        std::swap(this->miss_count, rhs.miss_count);
+        return *this;
+    }
+
+    VkPipelineCache PipelineCache::native() const
+    {
+        return this->pipeline_cache;
+    }
+
+    std::vector<std::byte> PipelineCache::get_data() const
+    {
+        std::size_t data_size = this->get_data_size();
+        std::vector<std::byte> data(data_size);
+        auto res = vkGetPipelineCacheData(this->device->native(), this->pipeline_cache, &data_size, data.data());
+        tz_assert(res == VK_SUCCESS, "Failed to retrieve pipeline cache data");
+        // The driver is allowed to write less than it initially said it would.
+        data.resize(data_size);
+        return data;
+    }
+
+    std::size_t PipelineCache::get_data_size() const
+    {
+        std::size_t data_size = 0;
+        auto res = vkGetPipelineCacheData(this->device->native(), this->pipeline_cache, &data_size, nullptr);
+        tz_assert(res == VK_SUCCESS, "Failed to retrieve pipeline cache data size");
+        return data_size;
+    }
+
+    void PipelineCache::notify_pipeline_created(std::size_t data_size_before)
+    {
+        if(this->get_data_size() == data_size_before)
+        {
+            this->hit_count++;
+        }
+        else
+        {
+            this->miss_count++;
+        }
+    }
+
+    std::size_t PipelineCache::get_hit_count() const
+    {
+        return this->hit_count;
+    }
+
+    std::size_t PipelineCache::get_miss_count() const
+    {
+        return this->miss_count;
+    }
+
+    bool PipelineCache::is_null() const
+    {
+        return this->pipeline_cache == VK_NULL_HANDLE;
+    }
+
+    PipelineCache PipelineCache::null()
+    {
+        return {};
+    }
+
+    PipelineCache::PipelineCache():
+    pipeline_cache(VK_NULL_HANDLE),
+    device(nullptr),
+    hit_count(0),
+    miss_count(0)
+    {}
+}
+
+#endif // TZ_VULKAN
@@ -0,0 +1,60 @@
+#ifndef TOPAZ_GL_VK_PIPELINE_CACHE_HPP
+#define TOPAZ_GL_VK_PIPELINE_CACHE_HPP
+#if TZ_VULKAN
+#include "gl/impl/backend/vk/logical_device.hpp"
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace tz::gl::vk
+{
+    /**
+     * @brief Stores the results of pipeline compilation so that creating an equivalent pipeline later is much cheaper. The contents can be retrieved and used to create a cache in a later run of the program.
+     */
+    class PipelineCache
+    {
+    public:
+        /**
+         * @brief Create a pipeline cache.
+         * @param device Device which will create pipelines using this cache.
+         * @param initial_data Data previously retrieved via @ref PipelineCache::get_data(). If the data was produced by an incompatible device or driver, it is ignored and the cache begins empty.
+         */
+        PipelineCache(const LogicalDevice& device, std::span<const std::byte> initial_data = {});
+        PipelineCache(const PipelineCache& copy) = delete;
+        PipelineCache(PipelineCache&& move);
+        ~PipelineCache();
+
+        PipelineCache& operator=(const PipelineCache& rhs) = delete;
+        PipelineCache& operator=(PipelineCache&& rhs);
+
+        VkPipelineCache native() const;
+        /**
+         * @brief Retrieve the contents of the cache, suitable for writing to disk.
+         */
+        std::vector<std::byte> get_data() const;
+        /**
+         * @brief Retrieve the size of the contents of the cache, in bytes.
+         */
+        std::size_t get_data_size() const;
+        /**
+         * @brief Record the outcome of creating a pipeline using this cache.
+         * @param data_size_before Value of @ref PipelineCache::get_data_size() just before the pipeline was created. If the cache didn't grow, the pipeline was already in it.
+         */
+        void notify_pipeline_created(std::size_t data_size_before);
+        std::size_t get_hit_count() const;
+        std::size_t get_miss_count() const;
+
+        bool is_null() const;
+        static PipelineCache null();
+    private:
+        PipelineCache();
+
+        VkPipelineCache pipeline_cache;
+        const LogicalDevice* device;
+        std::size_t hit_count;
+        std::size_t miss_count;
+    };
+}
+
+#endif // TZ_VULKAN
+#endif // TOPAZ_GL_VK_PIPELINE_CACHE_HPP
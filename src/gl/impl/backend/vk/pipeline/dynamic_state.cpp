@@ -22,9 +22,17 @@ namespace tz::gl::vk::pipeline
         return {};
     }
 
+    DynamicState DynamicState::ViewportScissor()
+    {
+        return {{DynamicStateType::ViewportDimensions, DynamicStateType::ScissorDimensions}};
+    }
+
     VkPipelineDynamicStateCreateInfo DynamicState::native() const
     {
-        return this->create;
+        VkPipelineDynamicStateCreateInfo create = this->create;
+        // Copies of this object have their own state natives, so don't rely on the pointer set at construction.
+        create.pDynamicStates = this->state_natives.empty() ? nullptr : this->state_natives.data();
+        return create;
     }
 
     DynamicState::DynamicState():
@@ -20,6 +20,8 @@ namespace tz::gl::vk::pipeline
     public:
         DynamicState(DynamicStateTypeField state_enables);
         static DynamicState None();
+        /// Viewport and scissor are set when commands are recorded, so the pipeline doesn't depend on the size of the render target.
+        static DynamicState ViewportScissor();
         VkPipelineDynamicStateCreateInfo native() const;
     private:
         DynamicState();
@@ -17,7 +17,8 @@ namespace tz::gl::vk
         pipeline::ColourBlendState colour_blend_state,
         pipeline::DynamicState dynamic_state,
         const pipeline::Layout& layout,
-        const RenderPass& render_pass
+        const RenderPass& render_pass,
+        PipelineCache* cache
     ):
     shaders(shader_stages),
     device(&device),
@@ -71,8 +72,13 @@ namespace tz::gl::vk
         create.basePipelineHandle = VK_NULL_HANDLE;
         create.basePipelineIndex= -1;
 
-        auto res = vkCreateGraphicsPipelines(this->device->native(), VK_NULL_HANDLE, 1, &create, nullptr, &this->graphics_pipeline);
+        std::size_t cache_size_before = cache != nullptr ? cache->get_data_size() : 0;
+        auto res = vkCreateGraphicsPipelines(this->device->native(), cache != nullptr ? cache->native() : VK_NULL_HANDLE, 1, &create, nullptr, &this->graphics_pipeline);
         tz_assert(res == VK_SUCCESS, "tz::gl::vk::GraphicsPipeline::GraphicsPipeline(...): Failed to create graphics pipeline");
+        if(cache != nullptr)
+        {
+            cache->notify_pipeline_created(cache_size_before);
+        }
     }
 
     GraphicsPipeline::GraphicsPipeline(GraphicsPipeline&& move):
@@ -13,6 +13,7 @@
 #include "gl/impl/backend/vk/pipeline/colour_blend_state.hpp"
 #include "gl/impl/backend/vk/pipeline/dynamic_state.hpp"
 #include "gl/impl/backend/vk/pipeline/layout.hpp"
+#include "gl/impl/backend/vk/pipeline/cache.hpp"
 #include "gl/impl/backend/vk/render_pass.hpp"
 
 namespace tz::gl::vk
@@ -35,7 +36,8 @@ namespace tz::gl::vk
             pipeline::ColourBlendState colour_blend_state,
             pipeline::DynamicState dynamic_state,
             const pipeline::Layout& layout,
-            const RenderPass& render_pass
+            const RenderPass& render_pass,
+            PipelineCache* cache = nullptr
         );
         GraphicsPipeline(const GraphicsPipeline& copy) = delete;
         GraphicsPipeline(GraphicsPipeline&& move);
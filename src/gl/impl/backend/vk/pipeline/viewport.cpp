@@ -13,7 +13,21 @@ namespace tz::gl::vk::pipeline
 
     VkPipelineViewportStateCreateInfo ViewportState::native() const
     {
-        return this->create;
+        VkPipelineViewportStateCreateInfo create = this->create;
+        // Copies of this object have their own viewport and scissor, so don't rely on the pointers set at construction.
+        create.pViewports = &this->viewport;
+        create.pScissors = &this->scissor;
+        return create;
+    }
+
+    const VkViewport& ViewportState::get_viewport() const
+    {
+        return this->viewport;
+    }
+
+    const VkRect2D& ViewportState::get_scissor() const
+    {
+        return this->scissor;
     }
 
     ViewportState::ViewportState(float width, float height, VkExtent2D extent, bool use_opengl_coordinate_system):
@@ -11,6 +11,10 @@ namespace tz::gl::vk::pipeline
         ViewportState(const Swapchain& swapchain, bool use_opengl_coordinate_system = false);
         ViewportState(const Image& image, bool use_opengl_coordinate_system = false);
         VkPipelineViewportStateCreateInfo native() const;
+        /// Retrieve the viewport, e.g to set it dynamically via @ref CommandBufferRecording::set_viewport.
+        const VkViewport& get_viewport() const;
+        /// Retrieve the scissor rectangle, e.g to set it dynamically via @ref CommandBufferRecording::set_scissor.
+        const VkRect2D& get_scissor() const;
     private:
         ViewportState(float width, float height, VkExtent2D extent, bool use_opengl_coordinate_system);
         VkPipelineViewportStateCreateInfo create;
@@ -0,0 +1,92 @@
+#if TZ_VULKAN
+#include "core/assert.hpp"
+#include "gl/impl/backend/vk/hardware/device.hpp"
+#include "gl/impl/backend/vk/query_pool.hpp"
+#include <array>
+
+namespace tz::gl::vk
+{
+    TimestampQueryPool::TimestampQueryPool(const LogicalDevice& device, std::uint32_t query_count):
+    query_pool(VK_NULL_HANDLE),
+    device(&device),
+    query_count(query_count),
+    timestamp_period(device.get_queue_family().dev->get_properties().limits.timestampPeriod),
+    timestamp_mask(0)
+    {
+        std::uint32_t valid_bits = device.get_queue_family().timestamp_valid_bits;
+        tz_assert(valid_bits > 0, "TimestampQueryPool: Queue family does not support timestamps");
+        this->timestamp_mask = valid_bits >= 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << valid_bits) - 1;
+
+        VkQueryPoolCreateInfo create{};
+        create.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        create.queryType = VK_QUERY_TYPE_TIMESTAMP;
+        create.queryCount = this->query_count;
+        auto res = vkCreateQueryPool(this->device->native(), &create, nullptr, &this->query_pool);
+        tz_assert(res == VK_SUCCESS, "Failed to create timestamp query pool");
+    }
+
+    TimestampQueryPool::TimestampQueryPool(TimestampQueryPool&& move):
+    query_pool(VK_NULL_HANDLE),
+    device(nullptr),
+    query_count(0),
+    timestamp_period(0.0f),
+    timestamp_mask(0)
+    {
+        *this = std::move(move);
+    }
+
+    TimestampQueryPool::~TimestampQueryPool()
+    {
+        if(this->query_pool != VK_NULL_HANDLE)
+        {
+            vkDestroyQueryPool(this->device->native(), this->query_pool, nullptr);
+            this->query_pool = VK_NULL_HANDLE;
+        }
+    }
+
+    TimestampQueryPool& TimestampQueryPool::operator=(TimestampQueryPool&& rhs)
+    {
+        std::swap(this->query_pool, rhs.query_pool);
+        std::swap(this->device, rhs.device);
+        std::swap(this->query_count, rhs.query_count);
+        std::swap(this->timestamp_period, rhs.timestamp_period);
+        std::swap(this->timestamp_mask, rhs.timestamp_mask);
+        return *this;
+    }
+
+    VkQueryPool TimestampQueryPool::native() const
+    {
+        return this->query_pool;
+    }
+
+    std::uint32_t TimestampQueryPool::get_query_count() const
+    {
+        return this->query_count;
+    }
+
+    std::optional<float> TimestampQueryPool::get_elapsed_milliseconds(std::uint32_t begin_query, std::uint32_t end_query) const
+    {
+        tz_assert(begin_query < this->query_count && end_query < this->query_count, "TimestampQueryPool::get_elapsed_milliseconds(%u, %u): Query out of range (%u queries)", begin_query, end_query, this->query_count);
+        // Each result is followed by its availability, which is non-zero once the timestamp has been written.
+        auto read = [this](std::uint32_t query)->std::optional<std::uint64_t>
+        {
+            std::array<std::uint64_t, 2> result_and_availability{};
+            vkGetQueryPoolResults(this->device->native(), this->query_pool, query, 1, sizeof(result_and_availability), result_and_availability.data(), sizeof(result_and_availability), VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+            if(result_and_availability[1] == 0)
+            {
+                return std::nullopt;
+            }
+            return result_and_availability[0];
+        };
+        std::optional<std::uint64_t> begin = read(begin_query);
+        std::optional<std::uint64_t> end = read(end_query);
+        if(!begin.has_value() || !end.has_value())
+        {
+            return std::nullopt;
+        }
+        std::uint64_t ticks = (end.value() - begin.value()) & this->timestamp_mask;
+        return static_cast<float>(static_cast<double>(ticks) * this->timestamp_period / 1000000.0);
+    }
+}
+
+#endif // TZ_VULKAN
@@ -0,0 +1,56 @@
+#ifndef TOPAZ_GL_VK_QUERY_POOL_HPP
+#define TOPAZ_GL_VK_QUERY_POOL_HPP
+#if TZ_VULKAN
+#include "gl/impl/backend/vk/logical_device.hpp"
+#include <cstdint>
+#include <optional>
+
+namespace tz::gl::vk
+{
+    /**
+     * @brief Specifies when a timestamp is written, relative to the commands recorded before it.
+     */
+    enum class TimestampStage
+    {
+        /// As soon as the timestamp command is reached, i.e roughly when the next commands begin.
+        Top = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+        /// Once every previous command has completely finished.
+        Bottom = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT
+    };
+
+    /**
+     * @brief A pool of timestamp queries. Timestamps are written by a command buffer (see @ref CommandBufferRecording::write_timestamp) and read back on the host once it has finished.
+     * @pre The queue family of the logical device must support timestamps. See @ref hardware::DeviceQueueFamily::timestamp_valid_bits.
+     */
+    class TimestampQueryPool
+    {
+    public:
+        TimestampQueryPool(const LogicalDevice& device, std::uint32_t query_count);
+        TimestampQueryPool(const TimestampQueryPool& copy) = delete;
+        TimestampQueryPool(TimestampQueryPool&& move);
+        ~TimestampQueryPool();
+
+        TimestampQueryPool& operator=(const TimestampQueryPool& rhs) = delete;
+        TimestampQueryPool& operator=(TimestampQueryPool&& rhs);
+
+        VkQueryPool native() const;
+        std::uint32_t get_query_count() const;
+        /**
+         * @brief Retrieve the time between two timestamps in the pool, without waiting.
+         * @pre Both queries must have been reset since the pool was created.
+         * @return Elapsed time in milliseconds, or std::nullopt if either timestamp has not been written yet.
+         */
+        std::optional<float> get_elapsed_milliseconds(std::uint32_t begin_query, std::uint32_t end_query) const;
+    private:
+        VkQueryPool query_pool;
+        const LogicalDevice* device;
+        std::uint32_t query_count;
+        /// Number of nanoseconds per timestamp tick.
+        float timestamp_period;
+        /// Timestamps wrap around after this many bits.
+        std::uint64_t timestamp_mask;
+    };
+}
+
+#endif // TZ_VULKAN
+#endif // TOPAZ_GL_VK_QUERY_POOL_HPP
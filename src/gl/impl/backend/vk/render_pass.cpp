@@ -2,6 +2,7 @@
 #include "gl/impl/backend/vk/render_pass.hpp"
 #include "gl/impl/backend/vk/framebuffer.hpp"
 #include "core/assert.hpp"
+#include <algorithm>
 #include <array>
 
 namespace tz::gl::vk
@@ -191,7 +192,6 @@ namespace tz::gl::vk
         create.pAttachments = attachments.data();
         create.subpassCount = builder.get_subpasses().size();
         create.pSubpasses = subpass_vk_descriptions.data();
-        create.dependencyCount = 1;
         VkSubpassDependency initial_dep{};
         initial_dep.srcSubpass = VK_SUBPASS_EXTERNAL;
         initial_dep.dstSubpass = 0;
@@ -206,7 +206,22 @@ namespace tz::gl::vk
             initial_dep.dstAccessMask |= VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
         }
 
-        create.pDependencies = &initial_dep;
+        std::vector<VkSubpassDependency> dependencies{initial_dep};
+        // If a colour attachment ends up as a transfer source, it's about to be copied out of. Make sure the copy waits for the writes.
+        bool colour_copied_out = std::any_of(attachments.begin(), attachments.end(), [](const VkAttachmentDescription& attachment){return attachment.finalLayout == VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;});
+        if(colour_copied_out)
+        {
+            VkSubpassDependency final_dep{};
+            final_dep.srcSubpass = static_cast<std::uint32_t>(builder.get_subpasses().size() - 1);
+            final_dep.dstSubpass = VK_SUBPASS_EXTERNAL;
+            final_dep.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+            final_dep.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+            final_dep.dstStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+            final_dep.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+            dependencies.push_back(final_dep);
+        }
+        create.dependencyCount = static_cast<std::uint32_t>(dependencies.size());
+        create.pDependencies = dependencies.data();
 
         auto res = vkCreateRenderPass(this->device->native(), &create, nullptr, &this->render_pass);
         tz_assert(res == VK_SUCCESS, "Failed to create render pass");
@@ -244,7 +259,7 @@ namespace tz::gl::vk
         return this->render_pass;
     }
 
-    RenderPassRun::RenderPassRun(const CommandBuffer& command_buffer, const RenderPass& render_pass, const Framebuffer& framebuffer, VkRect2D render_area, VkClearValue clear_colour):
+    RenderPassRun::RenderPassRun(const CommandBuffer& command_buffer, const RenderPass& render_pass, const Framebuffer& framebuffer, VkRect2D render_area, VkClearValue clear_colour, RenderPassContents contents):
     command_buffer(&command_buffer)
     {
         VkRenderPassBeginInfo begin{};
@@ -260,7 +275,7 @@ namespace tz::gl::vk
         begin.clearValueCount = clear_vals.size();
         begin.pClearValues = clear_vals.data();
         
-        vkCmdBeginRenderPass(this->command_buffer->native(), &begin, VK_SUBPASS_CONTENTS_INLINE);
+        vkCmdBeginRenderPass(this->command_buffer->native(), &begin, contents == RenderPassContents::SecondaryCommandBuffers ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS : VK_SUBPASS_CONTENTS_INLINE);
     }
 
     RenderPassRun::~RenderPassRun()
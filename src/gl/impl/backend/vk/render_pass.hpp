@@ -86,10 +86,19 @@ namespace tz::gl::vk
 
     class Framebuffer;
 
+    /// Describes where the commands within a render pass are recorded.
+    enum class RenderPassContents
+    {
+        /// Commands are recorded directly into the primary command buffer running the render pass.
+        Inline,
+        /// Commands are recorded into secondary command buffers, which the primary command buffer executes.
+        SecondaryCommandBuffers
+    };
+
     class RenderPassRun
     {
     public:
-        RenderPassRun(const CommandBuffer& command_buffer, const RenderPass& render_pass, const Framebuffer& framebuffer, VkRect2D render_area, VkClearValue clear_colour);
+        RenderPassRun(const CommandBuffer& command_buffer, const RenderPass& render_pass, const Framebuffer& framebuffer, VkRect2D render_area, VkClearValue clear_colour, RenderPassContents contents = RenderPassContents::Inline);
         ~RenderPassRun();
     private:
         const CommandBuffer* command_buffer;
@@ -1,5 +1,6 @@
 #if TZ_VULKAN
 #include "gl/impl/backend/vk/semaphore.hpp"
+#include <limits>
 
 namespace tz::gl::vk
 {
@@ -41,6 +42,79 @@ namespace tz::gl::vk
         return this->sem;
     }
 
+    TimelineSemaphore::TimelineSemaphore(const LogicalDevice& device, std::uint64_t initial_value):
+    sem(VK_NULL_HANDLE),
+    device(&device),
+    get_counter_value_func(nullptr),
+    wait_semaphores_func(nullptr)
+    {
+        tz_assert(this->device->supports_timeline_semaphores(), "Attempted to create a TimelineSemaphore, but the LogicalDevice was not created with timeline semaphore support.");
+        VkSemaphoreTypeCreateInfoKHR type_create{};
+        type_create.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+        type_create.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+        type_create.initialValue = initial_value;
+
+        VkSemaphoreCreateInfo create{};
+        create.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        create.pNext = &type_create;
+        auto res = vkCreateSemaphore(this->device->native(), &create, nullptr, &this->sem);
+        tz_assert(res == VK_SUCCESS, "Failed to create timeline semaphore");
+        // We target Vulkan 1.1, where these are only available via the extension.
+        this->get_counter_value_func = reinterpret_cast<PFN_vkGetSemaphoreCounterValueKHR>(vkGetDeviceProcAddr(this->device->native(), "vkGetSemaphoreCounterValueKHR"));
+        this->wait_semaphores_func = reinterpret_cast<PFN_vkWaitSemaphoresKHR>(vkGetDeviceProcAddr(this->device->native(), "vkWaitSemaphoresKHR"));
+        tz_assert(this->get_counter_value_func != nullptr && this->wait_semaphores_func != nullptr, "Failed to load timeline semaphore functions");
+    }
+
+    TimelineSemaphore::TimelineSemaphore(TimelineSemaphore&& move):
+    sem(VK_NULL_HANDLE),
+    device(nullptr),
+    get_counter_value_func(nullptr),
+    wait_semaphores_func(nullptr)
+    {
+        *this = std::move(move);
+    }
+
+    TimelineSemaphore::~TimelineSemaphore()
+    {
+        if(this->sem != VK_NULL_HANDLE)
+        {
+            vkDestroySemaphore(this->device->native(), this->sem, nullptr);
+            this->sem = VK_NULL_HANDLE;
+        }
+    }
+
+    TimelineSemaphore& TimelineSemaphore::operator=(TimelineSemaphore&& rhs)
+    {
+        std::swap(this->sem, rhs.sem);
+        std::swap(this->device, rhs.device);
+        std::swap(this->get_counter_value_func, rhs.get_counter_value_func);
+        std::swap(this->wait_semaphores_func, rhs.wait_semaphores_func);
+        return *this;
+    }
+
+    VkSemaphore TimelineSemaphore::native() const
+    {
+        return this->sem;
+    }
+
+    std::uint64_t TimelineSemaphore::get_value() const
+    {
+        std::uint64_t value = 0;
+        auto res = this->get_counter_value_func(this->device->native(), this->sem, &value);
+        tz_assert(res == VK_SUCCESS, "Failed to retrieve timeline semaphore value");
+        return value;
+    }
+
+    void TimelineSemaphore::wait_for(std::uint64_t value) const
+    {
+        VkSemaphoreWaitInfoKHR wait{};
+        wait.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+        wait.semaphoreCount = 1;
+        wait.pSemaphores = &this->sem;
+        wait.pValues = &value;
+        this->wait_semaphores_func(this->device->native(), &wait, std::numeric_limits<std::uint64_t>::max());
+    }
+
 }
 
 #endif // TZ_VULKAN
\ No newline at end of file
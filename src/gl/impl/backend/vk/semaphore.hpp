@@ -23,6 +23,37 @@ namespace tz::gl::vk
     };
 
     using SemaphoreRefs = std::initializer_list<std::reference_wrapper<const Semaphore>>;
+
+    /**
+     * @brief A semaphore containing a 64-bit value which only ever increases. Unlike a binary @ref Semaphore, any number of submissions and the host can wait for it to reach a given value.
+     * @pre The LogicalDevice must support timeline semaphores. See @ref LogicalDevice::supports_timeline_semaphores().
+     */
+    class TimelineSemaphore
+    {
+    public:
+        TimelineSemaphore(const LogicalDevice& device, std::uint64_t initial_value = 0);
+        TimelineSemaphore(const TimelineSemaphore& copy) = delete;
+        TimelineSemaphore(TimelineSemaphore&& move);
+        ~TimelineSemaphore();
+
+        TimelineSemaphore& operator=(const TimelineSemaphore& rhs) = delete;
+        TimelineSemaphore& operator=(TimelineSemaphore&& rhs);
+
+        VkSemaphore native() const;
+        /**
+         * @brief Retrieve the current value of the semaphore, without waiting.
+         */
+        std::uint64_t get_value() const;
+        /**
+         * @brief Block the current thread until the semaphore has reached at least the given value.
+         */
+        void wait_for(std::uint64_t value) const;
+    private:
+        VkSemaphore sem;
+        const LogicalDevice* device;
+        PFN_vkGetSemaphoreCounterValueKHR get_counter_value_func;
+        PFN_vkWaitSemaphoresKHR wait_semaphores_func;
+    };
 }
 
 #endif // TZ_VULKAN
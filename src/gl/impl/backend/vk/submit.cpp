@@ -8,7 +8,9 @@ namespace tz::gl::vk
     wait_semaphore_natives(),
     command_buffer_natives(),
     signal_semaphore_natives(),
-    wait_stages()
+    wait_stages(),
+    timeline_submit(),
+    signal_values()
     {
         this->submit.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
 
@@ -35,6 +37,28 @@ namespace tz::gl::vk
         this->update();
     }
 
+    void Submit::add_wait(const Semaphore& wait_semaphore, WaitStage wait_stage)
+    {
+        this->wait_semaphore_natives.push_back(wait_semaphore.native());
+        this->wait_stages.push_back(static_cast<VkPipelineStageFlags>(wait_stage));
+        this->update();
+    }
+
+    void Submit::add_signal(const Semaphore& signal_semaphore)
+    {
+        this->signal_semaphore_natives.push_back(signal_semaphore.native());
+        this->update();
+    }
+
+    void Submit::add_timeline_signal(const TimelineSemaphore& signal_semaphore, std::uint64_t value)
+    {
+        // Every signal semaphore needs a value, even the binary ones.
+        this->signal_values.resize(this->signal_semaphore_natives.size(), 0);
+        this->signal_semaphore_natives.push_back(signal_semaphore.native());
+        this->signal_values.push_back(value);
+        this->update();
+    }
+
     void Submit::operator()(const hardware::Queue& queue, const Fence& fence) const
     {
         vkQueueSubmit(queue.native(), 1, &this->submit, fence.native());
@@ -56,6 +80,16 @@ namespace tz::gl::vk
 
         this->submit.signalSemaphoreCount = this->signal_semaphore_natives.size();
         this->submit.pSignalSemaphores = this->signal_semaphore_natives.data();
+
+        if(!this->signal_values.empty())
+        {
+            // Binary semaphores signalled after the timeline one still need a (ignored) value.
+            this->signal_values.resize(this->signal_semaphore_natives.size(), 0);
+            this->timeline_submit.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+            this->timeline_submit.signalSemaphoreValueCount = this->signal_values.size();
+            this->timeline_submit.pSignalSemaphoreValues = this->signal_values.data();
+            this->submit.pNext = &this->timeline_submit;
+        }
     }
 
 }
@@ -10,7 +10,9 @@ namespace tz::gl::vk
 {
     enum class WaitStage
     {
-        ColourAttachmentOutput = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT
+        ColourAttachmentOutput = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+        /// Earliest stage which reads buffers. Waiting here also holds back every later stage, e.g vertex input and shader reads.
+        DrawIndirect = VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT
     };
 
     using CommandBuffers = std::initializer_list<std::reference_wrapper<const CommandBuffer>>;
@@ -20,6 +22,18 @@ namespace tz::gl::vk
     {
     public:
         Submit(CommandBuffers buffers, SemaphoreRefs wait_semaphores, WaitStages wait_stages, SemaphoreRefs signal_semaphores);
+        /**
+         * @brief Additionally wait on the given semaphore before the given stage of the submitted commands.
+         */
+        void add_wait(const Semaphore& wait_semaphore, WaitStage wait_stage);
+        /**
+         * @brief Additionally signal the given semaphore once the submitted commands complete.
+         */
+        void add_signal(const Semaphore& signal_semaphore);
+        /**
+         * @brief Additionally set the given timeline semaphore to the given value once the submitted commands complete.
+         */
+        void add_timeline_signal(const TimelineSemaphore& signal_semaphore, std::uint64_t value);
         void operator()(const hardware::Queue& queue, const Fence& fence) const;
         void operator()(const hardware::Queue& queue) const;
     private:
@@ -30,6 +44,9 @@ namespace tz::gl::vk
         std::vector<VkCommandBuffer> command_buffer_natives;
         std::vector<VkSemaphore> signal_semaphore_natives;
         std::vector<VkPipelineStageFlags> wait_stages;
+        /// Only used if a timeline semaphore is involved. Binary semaphores ignore their value.
+        VkTimelineSemaphoreSubmitInfoKHR timeline_submit;
+        std::vector<std::uint64_t> signal_values;
     };
 }
 
@@ -1,6 +1,7 @@
 #if TZ_VULKAN
 #include "gl/impl/backend/vk/swapchain.hpp"
 #include "gl/impl/backend/vk/tz_vulkan.hpp"
+#include <algorithm>
 #include <limits>
 
 namespace tz::gl::vk
@@ -24,8 +25,12 @@ namespace tz::gl::vk
         tz_assert(maybe_format.has_value(), "tz::gl::vk::Swapchain::Swapchain(...): No valid format found");
         tz_assert(maybe_present_mode.has_value(), "tz::gl::vk::Swapchain::Swapchain(...): No valid present mode found");
         
-        std::uint32_t image_count = support.capabilities.minImageCount; // We'll go with at least one more than the mimimum as a hardcoded default.
-        image_count = std::min(image_count, support.capabilities.maxImageCount); // This shouldn't really be a problem but lets be safe.
+        std::uint32_t image_count = std::max(support.capabilities.minImageCount, preferences.image_count);
+        // A maximum of 0 means there is no limit.
+        if(support.capabilities.maxImageCount != 0)
+        {
+            image_count = std::min(image_count, support.capabilities.maxImageCount);
+        }
 
         VkSwapchainCreateInfoKHR create{};
         create.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR;
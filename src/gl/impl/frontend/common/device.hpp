@@ -1,5 +1,6 @@
 #ifndef TOPAZ_GL_IMPL_COMMON_DEVICE_HPP
 #define TOPAZ_GL_IMPL_COMMON_DEVICE_HPP
+#include <cstddef>
 #include <functional>
 
 namespace tz::gl
@@ -9,6 +10,21 @@ namespace tz::gl
         Triangles,
     };
 
+    /**
+     * @brief Describes how finished frames should be presented to the window. If the preferred mode is not supported, the closest supported mode is used instead.
+     */
+    enum class PresentModePreference
+    {
+        /// Let the implementation decide.
+        DontCare,
+        /// Every frame is queued and presented in step with the display's refresh rate. Never tears, and gets the most throughput out of the GPU at the cost of latency.
+        Vsync,
+        /// Only the most recently finished frame is presented, replacing any older frame still waiting. Low latency without tearing.
+        LowLatency,
+        /// Frames are presented as soon as they're finished, even if this causes tearing.
+        Immediate
+    };
+
     using DeviceWindowResizeCallback = std::function<void()>;
 }
 
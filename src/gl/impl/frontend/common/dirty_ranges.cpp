@@ -0,0 +1,90 @@
+#include "gl/impl/frontend/common/dirty_ranges.hpp"
+#include <algorithm>
+
+namespace tz::gl
+{
+    void DirtyRangeList::add(std::size_t offset, std::size_t length)
+    {
+        this->ever_added = true;
+        if(length == 0)
+        {
+            return;
+        }
+        // Consecutive writes are common (e.g updating a few vertices in order), so extend the last range instead of adding a new one if we can.
+        if(!this->ranges.empty())
+        {
+            DirtyRange& last = this->ranges.back();
+            if(offset >= last.offset && offset <= last.end())
+            {
+                last.length = std::max(last.end(), offset + length) - last.offset;
+                return;
+            }
+            // Still sorted and disjoint if this range begins after the last one ends.
+            this->coalesced = this->coalesced && offset > last.end();
+        }
+        this->ranges.push_back({.offset = offset, .length = length});
+    }
+
+    std::span<const DirtyRange> DirtyRangeList::get_ranges()
+    {
+        this->coalesce();
+        return this->ranges;
+    }
+
+    bool DirtyRangeList::empty() const
+    {
+        return this->ranges.empty();
+    }
+
+    bool DirtyRangeList::is_explicit() const
+    {
+        return this->ever_added;
+    }
+
+    void DirtyRangeList::clear()
+    {
+        this->ranges.clear();
+        this->coalesced = true;
+    }
+
+    void DirtyRangeList::coalesce()
+    {
+        if(this->coalesced || this->ranges.empty())
+        {
+            return;
+        }
+        std::sort(this->ranges.begin(), this->ranges.end(), [](const DirtyRange& lhs, const DirtyRange& rhs){return lhs.offset < rhs.offset;});
+        std::size_t write_id = 0;
+        for(std::size_t read_id = 1; read_id < this->ranges.size(); read_id++)
+        {
+            DirtyRange& current = this->ranges[write_id];
+            const DirtyRange& next = this->ranges[read_id];
+            if(next.offset <= current.end())
+            {
+                current.length = std::max(current.end(), next.end()) - current.offset;
+            }
+            else
+            {
+                this->ranges[++write_id] = next;
+            }
+        }
+        this->ranges.resize(write_id + 1);
+        this->coalesced = true;
+    }
+
+    DynamicDataWriter::DynamicDataWriter(std::span<std::byte> data, std::size_t offset, DirtyRangeList& dirty_ranges):
+    data(data),
+    offset(offset),
+    dirty_ranges(&dirty_ranges)
+    {}
+
+    DynamicDataWriter::~DynamicDataWriter()
+    {
+        this->dirty_ranges->add(this->offset, this->data.size_bytes());
+    }
+
+    std::span<std::byte> DynamicDataWriter::bytes() const
+    {
+        return this->data;
+    }
+}
@@ -0,0 +1,98 @@
+#ifndef TOPAZ_GL_IMPL_COMMON_DIRTY_RANGES_HPP
+#define TOPAZ_GL_IMPL_COMMON_DIRTY_RANGES_HPP
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace tz::gl
+{
+    /**
+	 * \addtogroup tz_gl Topaz Graphics Library (tz::gl)
+	 * A collection of low-level renderer-agnostic graphical interfaces.
+	 * @{
+	 */
+
+    /**
+     * @brief Describes a range of bytes which have been changed.
+     */
+    struct DirtyRange
+    {
+        /// Number of bytes between the beginning of the data and the first changed byte.
+        std::size_t offset;
+        /// Number of changed bytes.
+        std::size_t length;
+
+        std::size_t end() const{return this->offset + this->length;}
+        bool operator==(const DirtyRange& rhs) const = default;
+    };
+
+    /**
+     * @brief Keeps track of which parts of a block of data have been changed.
+     * @details Ranges may be added in any order and may overlap. When retrieved, ranges are sorted and any overlapping or adjacent ranges are coalesced.
+     */
+    class DirtyRangeList
+    {
+    public:
+        DirtyRangeList() = default;
+        /**
+         * @brief Record that the given range has been changed. Empty ranges are ignored.
+         */
+        void add(std::size_t offset, std::size_t length);
+        /**
+         * @brief Retrieve all changed ranges, sorted by offset and coalesced.
+         */
+        std::span<const DirtyRange> get_ranges();
+        /**
+         * @brief Query as to whether no ranges have been changed since the last clear.
+         */
+        bool empty() const;
+        /**
+         * @brief Query as to whether a range has ever been added to this list. Owners of data which never add ranges are assumed to change any of their data at any time.
+         */
+        bool is_explicit() const;
+        /**
+         * @brief Forget all changed ranges. Does not affect @ref DirtyRangeList::is_explicit().
+         */
+        void clear();
+    private:
+        void coalesce();
+
+        std::vector<DirtyRange> ranges = {};
+        bool coalesced = true;
+        bool ever_added = false;
+    };
+
+    /**
+     * @brief Provides write access to part of some dynamic data. When the writer is destroyed, the whole range it covers is marked as dirty.
+     */
+    class DynamicDataWriter
+    {
+    public:
+        /**
+         * @param data Range of the dynamic data which can be written to.
+         * @param offset Offset of `data`, in bytes, from the beginning of the dynamic data.
+         * @param dirty_ranges List which will receive the range when the writer is destroyed.
+         */
+        DynamicDataWriter(std::span<std::byte> data, std::size_t offset, DirtyRangeList& dirty_ranges);
+        DynamicDataWriter(const DynamicDataWriter& copy) = delete;
+        DynamicDataWriter(DynamicDataWriter&& move) = delete;
+        ~DynamicDataWriter();
+        DynamicDataWriter& operator=(const DynamicDataWriter& rhs) = delete;
+        DynamicDataWriter& operator=(DynamicDataWriter&& rhs) = delete;
+
+        /**
+         * @brief Retrieve the bytes which can be written to.
+         */
+        std::span<std::byte> bytes() const;
+    private:
+        std::span<std::byte> data;
+        std::size_t offset;
+        DirtyRangeList* dirty_ranges;
+    };
+
+    /**
+     * @}
+     */
+}
+
+#endif // TOPAZ_GL_IMPL_COMMON_DIRTY_RANGES_HPP
@@ -0,0 +1,126 @@
+#include "core/assert.hpp"
+#include "gl/impl/frontend/common/draw_table.hpp"
+
+namespace tz::gl
+{
+    RendererDrawTable::RendererDrawTable():
+    commands(),
+    accesses(),
+    static_input_count(0),
+    dynamic_input_count(0)
+    {}
+
+    RendererDrawTable::RendererDrawTable(std::span<const IRendererInput* const> inputs):
+    commands(),
+    accesses(),
+    static_input_count(0),
+    dynamic_input_count(0)
+    {
+        this->commands.reserve(inputs.size());
+        this->accesses.reserve(inputs.size());
+        std::size_t static_vtx_count = 0, static_idx_count = 0;
+        std::size_t dynamic_vtx_count = 0, dynamic_idx_count = 0;
+        for(const IRendererInput* input : inputs)
+        {
+            if(input == nullptr)
+            {
+                this->commands.push_back({.index_count = 0, .instance_count = 0, .first_index = 0, .vertex_offset = 0, .first_instance = 0});
+                this->accesses.push_back(RendererInputDataAccess::StaticFixed);
+                continue;
+            }
+            DrawIndirectCommand cmd;
+            cmd.index_count = input->index_count();
+            cmd.instance_count = 1;
+            cmd.first_instance = 0;
+            switch(input->data_access())
+            {
+                case RendererInputDataAccess::StaticFixed:
+                    cmd.vertex_offset = static_vtx_count;
+                    cmd.first_index = static_idx_count;
+                    static_vtx_count += input->vertex_count();
+                    static_idx_count += input->index_count();
+                    this->static_input_count++;
+                break;
+                case RendererInputDataAccess::DynamicFixed:
+                    cmd.vertex_offset = dynamic_vtx_count;
+                    cmd.first_index = dynamic_idx_count;
+                    dynamic_vtx_count += input->vertex_count();
+                    dynamic_idx_count += input->index_count();
+                    this->dynamic_input_count++;
+                break;
+                default:
+                    tz_error("Unknown renderer input data access");
+                break;
+            }
+            this->commands.push_back(cmd);
+            this->accesses.push_back(input->data_access());
+        }
+    }
+
+    std::size_t RendererDrawTable::input_count_of(RendererInputDataAccess access) const
+    {
+        switch(access)
+        {
+            case RendererInputDataAccess::StaticFixed:
+                return this->static_input_count;
+            break;
+            case RendererInputDataAccess::DynamicFixed:
+                return this->dynamic_input_count;
+            break;
+            default:
+                tz_error("Unknown renderer input data access");
+                return 0;
+            break;
+        }
+    }
+
+    RendererDrawCounts RendererDrawTable::count(const RendererDrawList& draws) const
+    {
+        RendererDrawCounts counts;
+        for(RendererInputHandle handle : draws)
+        {
+            std::size_t handle_val = static_cast<std::size_t>(static_cast<tz::HandleValue>(handle));
+            tz_assert(handle_val < this->accesses.size(), "Draw list contains handle %zu, which does not belong to this renderer (%zu inputs)", handle_val, this->accesses.size());
+            if(this->accesses[handle_val] == RendererInputDataAccess::StaticFixed)
+            {
+                counts.static_draws++;
+            }
+        }
+        counts.dynamic_draws = draws.length() - counts.static_draws;
+        return counts;
+    }
+
+    RendererDrawCounts RendererDrawTable::gather(const RendererDrawList& draws, std::span<DrawIndirectCommand> destination) const
+    {
+        tz_assert(destination.size() >= draws.length(), "Draw command destination too small (needs %zu, has %zu)", draws.length(), destination.size());
+        RendererDrawCounts counts = this->count(draws);
+        // Static draws go at the front and dynamic draws go immediately after, so write both in a single pass.
+        DrawIndirectCommand* static_cmd = destination.data();
+        DrawIndirectCommand* dynamic_cmd = destination.data() + counts.static_draws;
+        for(RendererInputHandle handle : draws)
+        {
+            std::size_t handle_val = static_cast<std::size_t>(static_cast<tz::HandleValue>(handle));
+            if(this->accesses[handle_val] == RendererInputDataAccess::StaticFixed)
+            {
+                *static_cmd++ = this->commands[handle_val];
+            }
+            else
+            {
+                *dynamic_cmd++ = this->commands[handle_val];
+            }
+        }
+        return counts;
+    }
+
+    void RendererDrawTable::rebase_static(std::uint32_t base_index, std::int32_t base_vertex)
+    {
+        for(std::size_t i = 0; i < this->commands.size(); i++)
+        {
+            if(this->accesses[i] == RendererInputDataAccess::StaticFixed)
+            {
+                this->commands[i].first_index += base_index;
+                this->commands[i].vertex_offset += base_vertex;
+            }
+        }
+    }
+}
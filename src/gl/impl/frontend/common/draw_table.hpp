@@ -0,0 +1,90 @@
+#ifndef TOPAZ_GL_IMPL_COMMON_DRAW_TABLE_HPP
+#define TOPAZ_GL_IMPL_COMMON_DRAW_TABLE_HPP
+#include "gl/api/renderer.hpp"
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace tz::gl
+{
+    /**
+	 * \addtogroup tz_gl Topaz Graphics Library (tz::gl)
+	 * A collection of low-level renderer-agnostic graphical interfaces.
+	 * @{
+	 */
+
+    /**
+     * @brief An indexed indirect draw command. The layout matches both `VkDrawIndexedIndirectCommand` and OpenGL's `DrawElementsIndirectCommand`, so a span of these can be copied directly into a draw-indirect buffer for either backend.
+     */
+    struct DrawIndirectCommand
+    {
+        std::uint32_t index_count;
+        std::uint32_t instance_count;
+        std::uint32_t first_index;
+        std::int32_t vertex_offset;
+        std::uint32_t first_instance;
+    };
+
+    /**
+     * @brief Describes how many static and dynamic draws a draw list contains.
+     */
+    struct RendererDrawCounts
+    {
+        std::size_t static_draws = 0;
+        std::size_t dynamic_draws = 0;
+
+        std::size_t total() const{return this->static_draws + this->dynamic_draws;}
+        bool operator==(const RendererDrawCounts& rhs) const = default;
+    };
+
+    /**
+     * @brief Stores a precomputed draw command for every input of a renderer, indexed by its @ref RendererInputHandle.
+     * @details Static and dynamic input data live in separate vertex/index buffers. Each draw command's `first_index` and `vertex_offset` are relative to the buffer its input lives in. Static data may live part-way into a shared buffer, see @ref RendererDrawTable::rebase_static.
+     */
+    class RendererDrawTable
+    {
+    public:
+        /**
+         * @brief Create an empty table, for a renderer with no inputs.
+         */
+        RendererDrawTable();
+        /**
+         * @brief Compute the draw command for every input. This is the only time the inputs are inspected.
+         * @param inputs List of all renderer inputs, in handle order. Null inputs are permitted, and never draw anything.
+         */
+        RendererDrawTable(std::span<const IRendererInput* const> inputs);
+        /**
+         * @brief Retrieve the number of inputs which have the given data access.
+         */
+        std::size_t input_count_of(RendererInputDataAccess access) const;
+        /**
+         * @brief Count how many static and dynamic draws a draw list would yield.
+         */
+        RendererDrawCounts count(const RendererDrawList& draws) const;
+        /**
+         * @brief Translate a draw list into draw commands. All static draws are written first, immediately followed by all dynamic draws, each in draw list order.
+         * @pre `destination.size() >= draws.length()`
+         * @param draws Draw list to translate. Each handle must belong to an input passed at construction.
+         * @param destination Where to write the draw commands. This can point directly into a mapped draw-indirect buffer.
+         * @return Number of static and dynamic draw commands written.
+         */
+        RendererDrawCounts gather(const RendererDrawList& draws, std::span<DrawIndirectCommand> destination) const;
+        /**
+         * @brief Offset the draw command of every static input, for when the static input data does not begin at the start of its buffers.
+         * @param base_index Number of indices which precede the first static index in the index buffer.
+         * @param base_vertex Number of vertices which precede the first static vertex in the vertex buffer.
+         */
+        void rebase_static(std::uint32_t base_index, std::int32_t base_vertex);
+    private:
+        std::vector<DrawIndirectCommand> commands;
+        std::vector<RendererInputDataAccess> accesses;
+        std::size_t static_input_count;
+        std::size_t dynamic_input_count;
+    };
+
+    /**
+     * @}
+     */
+}
+
+#endif // TOPAZ_GL_IMPL_COMMON_DRAW_TABLE_HPP
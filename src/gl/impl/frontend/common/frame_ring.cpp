@@ -0,0 +1,121 @@
+#include "core/assert.hpp"
+#include "gl/impl/frontend/common/frame_ring.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace tz::gl
+{
+    RendererFrameRing::RendererFrameRing(std::span<const std::byte> initial_data, std::size_t slice_count):
+    host_data(initial_data.begin(), initial_data.end()),
+    last_seen_data(),
+    block_versions((initial_data.size_bytes() + block_size - 1) / block_size, 1),
+    slice_versions(slice_count, 0),
+    version(1),
+    changes_pending(false)
+    {
+        tz_assert(slice_count > 0, "RendererFrameRing must have at least one slice");
+    }
+
+    std::span<std::byte> RendererFrameRing::data()
+    {
+        return this->host_data;
+    }
+
+    std::size_t RendererFrameRing::size() const
+    {
+        return this->host_data.size();
+    }
+
+    std::size_t RendererFrameRing::get_slice_count() const
+    {
+        return this->slice_versions.size();
+    }
+
+    void RendererFrameRing::mark_dirty(std::size_t offset, std::size_t length)
+    {
+        tz_assert(offset + length <= this->size(), "RendererFrameRing::mark_dirty(%zu, %zu): Range out of bounds (%zu bytes)", offset, length, this->size());
+        this->stamp(offset, length);
+    }
+
+    void RendererFrameRing::detect_changes(std::size_t offset, std::size_t length)
+    {
+        tz_assert(offset + length <= this->size(), "RendererFrameRing::detect_changes(%zu, %zu): Range out of bounds (%zu bytes)", offset, length, this->size());
+        if(this->last_seen_data.empty())
+        {
+            // First time anything has been compared. We don't know what changed before now, so assume everything did.
+            this->last_seen_data = this->host_data;
+            this->stamp(0, this->size());
+            return;
+        }
+        std::size_t end = offset + length;
+        for(std::size_t block_begin = offset; block_begin < end;)
+        {
+            // Compare up to the end of the block containing block_begin, so each block is visited once.
+            std::size_t block_end = std::min((block_begin / block_size + 1) * block_size, end);
+            std::size_t block_length = block_end - block_begin;
+            if(std::memcmp(this->host_data.data() + block_begin, this->last_seen_data.data() + block_begin, block_length) != 0)
+            {
+                std::memcpy(this->last_seen_data.data() + block_begin, this->host_data.data() + block_begin, block_length);
+                this->stamp(block_begin, block_length);
+            }
+            block_begin = block_end;
+        }
+    }
+
+    std::size_t RendererFrameRing::publish(std::size_t slice_id, std::span<std::byte> slice, DirtyRangeList* copied_ranges)
+    {
+        tz_assert(slice_id < this->get_slice_count(), "RendererFrameRing: Slice %zu is out of range (%zu slices)", slice_id, this->get_slice_count());
+        tz_assert(slice.size_bytes() >= this->size(), "RendererFrameRing: Slice is too small (needs %zu bytes, has %zu)", this->size(), slice.size_bytes());
+        // All changes reported since the last publish share the same new version.
+        if(this->changes_pending)
+        {
+            this->version++;
+            this->changes_pending = false;
+        }
+
+        std::size_t& slice_version = this->slice_versions[slice_id];
+        std::size_t bytes_copied = 0;
+        std::size_t block_count = this->block_versions.size();
+        std::size_t block_id = 0;
+        while(block_id < block_count)
+        {
+            if(this->block_versions[block_id] <= slice_version)
+            {
+                block_id++;
+                continue;
+            }
+            // Coalesce adjacent out-of-date blocks into a single copy.
+            std::size_t run_end = block_id + 1;
+            while(run_end < block_count && this->block_versions[run_end] > slice_version)
+            {
+                run_end++;
+            }
+            std::size_t offset = block_id * block_size;
+            std::size_t length = std::min(run_end * block_size, this->size()) - offset;
+            std::memcpy(slice.data() + offset, this->host_data.data() + offset, length);
+            if(copied_ranges != nullptr)
+            {
+                copied_ranges->add(offset, length);
+            }
+            bytes_copied += length;
+            block_id = run_end;
+        }
+        slice_version = this->version;
+        return bytes_copied;
+    }
+
+    void RendererFrameRing::stamp(std::size_t offset, std::size_t length)
+    {
+        if(length == 0)
+        {
+            return;
+        }
+        std::size_t first_block = offset / block_size;
+        std::size_t last_block = (offset + length - 1) / block_size;
+        for(std::size_t block_id = first_block; block_id <= last_block; block_id++)
+        {
+            this->block_versions[block_id] = this->version + 1;
+        }
+        this->changes_pending = true;
+    }
+}
@@ -0,0 +1,81 @@
+#ifndef TOPAZ_GL_IMPL_COMMON_FRAME_RING_HPP
+#define TOPAZ_GL_IMPL_COMMON_FRAME_RING_HPP
+#include "gl/impl/frontend/common/dirty_ranges.hpp"
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace tz::gl
+{
+    /**
+	 * \addtogroup tz_gl Topaz Graphics Library (tz::gl)
+	 * A collection of low-level renderer-agnostic graphical interfaces.
+	 * @{
+	 */
+
+    /**
+     * @brief Versions a block of dynamic data so that the GPU can read one copy of it while the CPU writes another.
+     * @details The CPU only ever writes to the ring's own host memory (see @ref RendererFrameRing::data()). The renderer owns a GPU-visible slice per frame in flight, and just before a frame is submitted it calls @ref RendererFrameRing::publish to bring that frame's slice up-to-date. Only the parts of the data which have changed since that slice was last published are copied.
+     * 
+     * Changes must be reported before publishing, either explicitly via @ref RendererFrameRing::mark_dirty or by comparing against the last-seen data via @ref RendererFrameRing::detect_changes.
+     */
+    class RendererFrameRing
+    {
+    public:
+        /// Changes are tracked at this granularity, in bytes.
+        constexpr static std::size_t block_size = 256;
+        /**
+         * @brief Create a ring containing a copy of the given data.
+         * @param initial_data Initial value of the data. Every slice is considered out-of-date until it is first published.
+         * @param slice_count Number of GPU-visible slices that will be published to. Usually one per frame in flight.
+         */
+        RendererFrameRing(std::span<const std::byte> initial_data, std::size_t slice_count);
+        /**
+         * @brief Retrieve the host memory the CPU should write to. The pointer remains valid for the lifetime of the ring, even if the ring is moved.
+         */
+        std::span<std::byte> data();
+        /**
+         * @brief Retrieve the size of the data, in bytes. Each slice needs at least this many bytes.
+         */
+        std::size_t size() const;
+        std::size_t get_slice_count() const;
+        /**
+         * @brief Record that the given range of the host memory has been changed.
+         */
+        void mark_dirty(std::size_t offset, std::size_t length);
+        /**
+         * @brief Compare the given range of the host memory against how it looked the last time it was compared, recording any changes. This is much slower than @ref RendererFrameRing::mark_dirty and should only be used for data whose owner does not report its changes.
+         */
+        void detect_changes(std::size_t offset, std::size_t length);
+        /**
+         * @brief Copy every change which the given slice has not yet seen into it.
+         * @pre The GPU must not currently be reading from `slice`.
+         * @param slice_id Which slice is being published. Must be less than @ref RendererFrameRing::get_slice_count().
+         * @param slice GPU-visible memory of the slice. Must be at least @ref RendererFrameRing::size() bytes.
+         * @param copied_ranges If not null, receives each range that was copied into the slice, e.g so it can be flushed.
+         * @return Number of bytes copied into the slice.
+         */
+        std::size_t publish(std::size_t slice_id, std::span<std::byte> slice, DirtyRangeList* copied_ranges = nullptr);
+    private:
+        /// Stamp each block overlapping the given range with the pending version.
+        void stamp(std::size_t offset, std::size_t length);
+
+        /// What the CPU writes to.
+        std::vector<std::byte> host_data;
+        /// Contents of `host_data` as of the last call to `detect_changes`. Empty until `detect_changes` is first invoked.
+        std::vector<std::byte> last_seen_data;
+        /// Version at which each block was last changed.
+        std::vector<std::size_t> block_versions;
+        /// Version each slice was last published at.
+        std::vector<std::size_t> slice_versions;
+        std::size_t version;
+        /// Whether any blocks have been stamped with `version + 1`.
+        bool changes_pending;
+    };
+
+    /**
+     * @}
+     */
+}
+
+#endif // TOPAZ_GL_IMPL_COMMON_FRAME_RING_HPP
@@ -0,0 +1,151 @@
+#include "core/assert.hpp"
+#include "gl/impl/frontend/common/geometry_arena.hpp"
+#include <algorithm>
+#include <numeric>
+
+namespace tz::gl
+{
+    ArenaAllocator::ArenaAllocator(std::size_t capacity):
+    capacity(capacity),
+    free_ranges()
+    {
+        if(capacity > 0)
+        {
+            this->free_ranges.push_back({.offset = 0, .length = capacity});
+        }
+    }
+
+    std::optional<ArenaRange> ArenaAllocator::allocate(std::size_t length, std::size_t alignment)
+    {
+        tz_assert(length > 0, "ArenaAllocator::allocate: Cannot allocate an empty range");
+        tz_assert(alignment > 0, "ArenaAllocator::allocate: Alignment must be non-zero");
+        for(std::size_t i = 0; i < this->free_ranges.size(); i++)
+        {
+            ArenaRange free_range = this->free_ranges[i];
+            std::size_t aligned_offset = (free_range.offset + alignment - 1) / alignment * alignment;
+            if(aligned_offset + length > free_range.end())
+            {
+                continue;
+            }
+            ArenaRange allocation{.offset = aligned_offset, .length = length};
+            // Whatever is left either side of the allocation remains free. Padding from alignment stays free too, so it can be used by a later allocation with a smaller alignment.
+            ArenaRange before{.offset = free_range.offset, .length = aligned_offset - free_range.offset};
+            ArenaRange after{.offset = allocation.end(), .length = free_range.end() - allocation.end()};
+            auto position = this->free_ranges.erase(this->free_ranges.begin() + i);
+            if(after.length > 0)
+            {
+                position = this->free_ranges.insert(position, after);
+            }
+            if(before.length > 0)
+            {
+                this->free_ranges.insert(position, before);
+            }
+            return allocation;
+        }
+        return std::nullopt;
+    }
+
+    void ArenaAllocator::free(ArenaRange range)
+    {
+        tz_assert(range.end() <= this->capacity, "ArenaAllocator::free: Range [%zu, %zu) is out of bounds (%zu bytes)", range.offset, range.end(), this->capacity);
+        auto next = std::lower_bound(this->free_ranges.begin(), this->free_ranges.end(), range, [](const ArenaRange& lhs, const ArenaRange& rhs){return lhs.offset < rhs.offset;});
+        tz_assert(next == this->free_ranges.end() || range.end() <= next->offset, "ArenaAllocator::free: Range [%zu, %zu) overlaps a free range. Double free?", range.offset, range.end());
+        tz_assert(next == this->free_ranges.begin() || std::prev(next)->end() <= range.offset, "ArenaAllocator::free: Range [%zu, %zu) overlaps a free range. Double free?", range.offset, range.end());
+        // Merge with the neighbouring free ranges if they're adjacent, so that fragmentation doesn't build up.
+        bool merge_prev = next != this->free_ranges.begin() && std::prev(next)->end() == range.offset;
+        bool merge_next = next != this->free_ranges.end() && next->offset == range.end();
+        if(merge_prev && merge_next)
+        {
+            auto prev = std::prev(next);
+            prev->length = next->end() - prev->offset;
+            this->free_ranges.erase(next);
+        }
+        else if(merge_prev)
+        {
+            std::prev(next)->length += range.length;
+        }
+        else if(merge_next)
+        {
+            next->offset = range.offset;
+            next->length += range.length;
+        }
+        else
+        {
+            this->free_ranges.insert(next, range);
+        }
+    }
+
+    std::size_t ArenaAllocator::get_capacity() const
+    {
+        return this->capacity;
+    }
+
+    std::size_t ArenaAllocator::get_free_bytes() const
+    {
+        return std::accumulate(this->free_ranges.begin(), this->free_ranges.end(), std::size_t{0}, [](std::size_t total, const ArenaRange& range){return total + range.length;});
+    }
+
+    std::span<const ArenaRange> ArenaAllocator::get_free_ranges() const
+    {
+        return this->free_ranges;
+    }
+
+    GeometryArenaAllocator::GeometryArenaAllocator(std::size_t vertex_page_size, std::size_t index_page_size):
+    vertex_page_size(vertex_page_size),
+    index_page_size(index_page_size),
+    pages()
+    {}
+
+    GeometryArenaAllocation GeometryArenaAllocator::allocate(std::size_t vertex_bytes, std::size_t vertex_stride, std::size_t index_bytes)
+    {
+        tz_assert(vertex_stride > 0, "GeometryArenaAllocator::allocate: Vertex stride must be non-zero");
+        // Vertices must start on a whole vertex, so that draws can address them with a vertex offset.
+        for(std::size_t page_id = 0; page_id < this->pages.size(); page_id++)
+        {
+            Page& page = this->pages[page_id];
+            std::optional<ArenaRange> vertices = page.vertices.allocate(vertex_bytes, vertex_stride);
+            if(!vertices.has_value())
+            {
+                continue;
+            }
+            std::optional<ArenaRange> indices = page.indices.allocate(index_bytes, sizeof(unsigned int));
+            if(!indices.has_value())
+            {
+                page.vertices.free(vertices.value());
+                continue;
+            }
+            return {.page_id = page_id, .vertices = vertices.value(), .indices = indices.value(), .vertex_stride = vertex_stride};
+        }
+        // No room anywhere. Make a new page, large enough even if this geometry is bigger than a normal page.
+        std::size_t page_id = this->pages.size();
+        this->pages.push_back({.vertices = {std::max(this->vertex_page_size, vertex_bytes)}, .indices = {std::max(this->index_page_size, index_bytes)}});
+        Page& page = this->pages.back();
+        std::optional<ArenaRange> vertices = page.vertices.allocate(vertex_bytes, vertex_stride);
+        std::optional<ArenaRange> indices = page.indices.allocate(index_bytes, sizeof(unsigned int));
+        tz_assert(vertices.has_value() && indices.has_value(), "GeometryArenaAllocator::allocate: Allocation failed on a brand new page");
+        return {.page_id = page_id, .vertices = vertices.value(), .indices = indices.value(), .vertex_stride = vertex_stride};
+    }
+
+    void GeometryArenaAllocator::free(const GeometryArenaAllocation& allocation)
+    {
+        tz_assert(allocation.page_id < this->pages.size(), "GeometryArenaAllocator::free: Page %zu does not exist (%zu pages)", allocation.page_id, this->pages.size());
+        Page& page = this->pages[allocation.page_id];
+        page.vertices.free(allocation.vertices);
+        page.indices.free(allocation.indices);
+    }
+
+    std::size_t GeometryArenaAllocator::get_page_count() const
+    {
+        return this->pages.size();
+    }
+
+    std::size_t GeometryArenaAllocator::get_vertex_page_capacity(std::size_t page_id) const
+    {
+        return this->pages[page_id].vertices.get_capacity();
+    }
+
+    std::size_t GeometryArenaAllocator::get_index_page_capacity(std::size_t page_id) const
+    {
+        return this->pages[page_id].indices.get_capacity();
+    }
+}
@@ -0,0 +1,138 @@
+#ifndef TOPAZ_GL_IMPL_COMMON_GEOMETRY_ARENA_HPP
+#define TOPAZ_GL_IMPL_COMMON_GEOMETRY_ARENA_HPP
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace tz::gl
+{
+    /**
+	 * \addtogroup tz_gl Topaz Graphics Library (tz::gl)
+	 * A collection of low-level renderer-agnostic graphical interfaces.
+	 * @{
+	 */
+
+    /**
+     * @brief Describes a range of bytes within an arena.
+     */
+    struct ArenaRange
+    {
+        /// Number of bytes between the beginning of the arena and the beginning of the range.
+        std::size_t offset;
+        /// Number of bytes within the range.
+        std::size_t length;
+
+        std::size_t end() const{return this->offset + this->length;}
+        bool operator==(const ArenaRange& rhs) const = default;
+    };
+
+    /**
+     * @brief Carves a fixed-size block of memory into ranges. Knows nothing about the memory itself, only which parts of it are in use.
+     * @details Free ranges are kept sorted by offset and any adjacent free ranges are merged, so freeing everything always yields a single range covering the whole arena. Allocation is first-fit.
+     */
+    class ArenaAllocator
+    {
+    public:
+        /**
+         * @brief Create an allocator where the whole arena is free.
+         * @param capacity Size of the arena, in bytes.
+         */
+        ArenaAllocator(std::size_t capacity);
+        /**
+         * @brief Attempt to allocate a range.
+         * @param length Size of the range, in bytes. Must be non-zero.
+         * @param alignment The offset of the range will be a multiple of this value. It need not be a power of two.
+         * @return The allocated range, or null if no free range is large enough.
+         */
+        std::optional<ArenaRange> allocate(std::size_t length, std::size_t alignment = 1);
+        /**
+         * @brief Return a range to the arena.
+         * @pre `range` must have been returned by @ref ArenaAllocator::allocate on this allocator, and must not have been freed since.
+         */
+        void free(ArenaRange range);
+        std::size_t get_capacity() const;
+        /**
+         * @brief Retrieve the total number of bytes which are not in use.
+         */
+        std::size_t get_free_bytes() const;
+        /**
+         * @brief Retrieve every free range, sorted by offset.
+         */
+        std::span<const ArenaRange> get_free_ranges() const;
+    private:
+        std::size_t capacity;
+        std::vector<ArenaRange> free_ranges;
+    };
+
+    /**
+     * @brief Describes where some geometry lives within a @ref GeometryArenaAllocator.
+     */
+    struct GeometryArenaAllocation
+    {
+        /// Which page the vertices and indices live in.
+        std::size_t page_id;
+        /// Range of the page's vertex buffer containing the vertices.
+        ArenaRange vertices;
+        /// Range of the page's index buffer containing the indices.
+        ArenaRange indices;
+        /// Stride of each vertex, in bytes. `vertices.offset` is always a multiple of it.
+        std::size_t vertex_stride;
+
+        /// Number of vertices between the beginning of the page's vertex buffer and the first vertex. Add this to the vertex offset of each draw.
+        std::size_t get_base_vertex() const{return this->vertices.offset / this->vertex_stride;}
+        /// Number of indices between the beginning of the page's index buffer and the first index. Add this to the first index of each draw.
+        std::size_t get_base_index() const{return this->indices.offset / sizeof(unsigned int);}
+    };
+
+    /**
+     * @brief Keeps track of geometry shared by many renderers. Geometry lives in pages, each of which is a pair of large vertex and index buffers. Renderers with geometry in the same page all bind the same buffers.
+     * @details This only decides where geometry goes -- each backend owns the buffers for each page. New pages are only created when no existing page has room, and are never destroyed.
+     */
+    class GeometryArenaAllocator
+    {
+    public:
+        /**
+         * @param vertex_page_size Capacity of each page's vertex buffer, in bytes. Larger pages are created if a single allocation wouldn't fit.
+         * @param index_page_size Capacity of each page's index buffer, in bytes. Larger pages are created if a single allocation wouldn't fit.
+         */
+        GeometryArenaAllocator(std::size_t vertex_page_size, std::size_t index_page_size);
+        /**
+         * @brief Find room for some geometry, creating a new page if necessary. Check @ref GeometryArenaAllocator::get_page_count() to see whether a page was created.
+         * @param vertex_bytes Size of the vertex data, in bytes. Must be non-zero.
+         * @param vertex_stride Size of a single vertex, in bytes. Must be non-zero.
+         * @param index_bytes Size of the index data, in bytes. Must be non-zero.
+         */
+        GeometryArenaAllocation allocate(std::size_t vertex_bytes, std::size_t vertex_stride, std::size_t index_bytes);
+        /**
+         * @brief Return geometry to the arena, so its ranges can be reused.
+         * @pre The GPU must no longer be reading from the allocation.
+         */
+        void free(const GeometryArenaAllocation& allocation);
+        std::size_t get_page_count() const;
+        /**
+         * @brief Retrieve the capacity of the given page's vertex buffer, in bytes.
+         */
+        std::size_t get_vertex_page_capacity(std::size_t page_id) const;
+        /**
+         * @brief Retrieve the capacity of the given page's index buffer, in bytes.
+         */
+        std::size_t get_index_page_capacity(std::size_t page_id) const;
+    private:
+        struct Page
+        {
+            ArenaAllocator vertices;
+            ArenaAllocator indices;
+        };
+
+        std::size_t vertex_page_size;
+        std::size_t index_page_size;
+        std::vector<Page> pages;
+    };
+
+    /**
+     * @}
+     */
+}
+
+#endif // TOPAZ_GL_IMPL_COMMON_GEOMETRY_ARENA_HPP
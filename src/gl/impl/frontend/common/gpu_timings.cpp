@@ -0,0 +1,44 @@
+#include "core/assert.hpp"
+#include "gl/impl/frontend/common/gpu_timings.hpp"
+#include <algorithm>
+#include <numeric>
+
+namespace tz::gl
+{
+    GPUTimingHistory::GPUTimingHistory(std::size_t capacity):
+    samples(),
+    capacity(capacity),
+    next_id(0)
+    {
+        tz_assert(capacity > 0, "GPUTimingHistory must be able to remember at least one sample");
+        this->samples.reserve(capacity);
+    }
+
+    void GPUTimingHistory::add(float milliseconds)
+    {
+        if(this->samples.size() < this->capacity)
+        {
+            this->samples.push_back(milliseconds);
+            return;
+        }
+        this->samples[this->next_id] = milliseconds;
+        this->next_id = (this->next_id + 1) % this->capacity;
+    }
+
+    RendererGPUTimingStats GPUTimingHistory::get_stats() const
+    {
+        if(this->samples.empty())
+        {
+            return {.sample_count = 0, .average_ms = 0.0f, .min_ms = 0.0f, .max_ms = 0.0f};
+        }
+        auto [min, max] = std::minmax_element(this->samples.begin(), this->samples.end());
+        float total = std::accumulate(this->samples.begin(), this->samples.end(), 0.0f);
+        return
+        {
+            .sample_count = this->samples.size(),
+            .average_ms = total / static_cast<float>(this->samples.size()),
+            .min_ms = *min,
+            .max_ms = *max
+        };
+    }
+}
@@ -0,0 +1,45 @@
+#ifndef TOPAZ_GL_IMPL_COMMON_GPU_TIMINGS_HPP
+#define TOPAZ_GL_IMPL_COMMON_GPU_TIMINGS_HPP
+#include "gl/impl/frontend/common/renderer.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace tz::gl
+{
+    /**
+	 * \addtogroup tz_gl Topaz Graphics Library (tz::gl)
+	 * A collection of low-level renderer-agnostic graphical interfaces.
+	 * @{
+	 */
+
+    /**
+     * @brief Remembers the most recent GPU timings of something, so that statistics can be computed over a rolling window of frames.
+     */
+    class GPUTimingHistory
+    {
+    public:
+        /// Number of samples remembered by default. At 60fps, this is roughly the last second.
+        constexpr static std::size_t default_capacity = 64;
+        /**
+         * @brief Create an empty history.
+         * @param capacity Maximum number of samples remembered. Once full, each new sample replaces the oldest.
+         */
+        GPUTimingHistory(std::size_t capacity = default_capacity);
+        void add(float milliseconds);
+        /**
+         * @brief Retrieve the average, minimum and maximum of the remembered samples.
+         */
+        RendererGPUTimingStats get_stats() const;
+    private:
+        std::vector<float> samples;
+        std::size_t capacity;
+        /// Where the next sample goes, once `samples` is full.
+        std::size_t next_id;
+    };
+
+    /**
+     * @}
+     */
+}
+
+#endif // TOPAZ_GL_IMPL_COMMON_GPU_TIMINGS_HPP
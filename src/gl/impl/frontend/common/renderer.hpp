@@ -1,6 +1,9 @@
 #ifndef TOPAZ_GL_IMPL_COMMON_RENDERER_HPP
 #define TOPAZ_GL_IMPL_COMMON_RENDERER_HPP
 #include "core/handle.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
 
 namespace tz::gl
 {
@@ -62,11 +65,58 @@ namespace tz::gl
         DynamicFixed
     };
 
+    /**
+     * @brief Describes how a Renderer stores the data of its dynamic inputs and dynamic buffer resources. See @ref IRendererBuilder for defaults.
+     */
+    enum class RendererDynamicDataMode
+    {
+        /// Dynamic data is written directly into GPU-visible memory. Writes may race with the GPU reading a previous frame.
+        DirectMapped,
+        /// Dynamic data is written to host memory, and only copied into a per-frame-in-flight slice of GPU-visible memory once the GPU is done with that slice. Writes never race with the GPU, at the cost of extra memory and a copy of any changed data per frame.
+        FrameRing
+    };
+
     enum class RendererOutputType
     {
         Window,
         Texture
     };
+
+    /**
+     * @brief A frame rendered by a headless renderer, read back into host memory.
+     */
+    struct RendererOffscreenFrame
+    {
+        /// Frames are numbered from 1, in the order they were rendered.
+        std::uint64_t frame_id;
+        std::uint32_t width;
+        std::uint32_t height;
+        /// Tightly-packed pixels, row by row, in the format of the device's offscreen output.
+        std::span<const std::byte> pixels;
+    };
+
+    /**
+     * @brief Statistics about how long the GPU took to do something, over the last few frames.
+     */
+    struct RendererGPUTimingStats
+    {
+        /// Number of frames the statistics cover. If zero, no timings are available yet and the other values are meaningless.
+        std::size_t sample_count;
+        float average_ms;
+        float min_ms;
+        float max_ms;
+    };
+
+    /**
+     * @brief GPU time spent by a renderer, measured via timestamp queries. Results are read back a few frames after they are recorded, so they lag slightly behind.
+     */
+    struct RendererGPUTimings
+    {
+        /// Time between the beginning and end of the render pass, including the clear.
+        RendererGPUTimingStats render_pass;
+        /// Time spent on draw-indirect batches, summed over every batch in the frame.
+        RendererGPUTimingStats draws;
+    };
     /**
      * @} 
      */
@@ -1,10 +1,17 @@
 #if TZ_OGL
+#include "core/assert.hpp"
+#include "core/profile.hpp"
 #include "gl/impl/frontend/ogl/device.hpp"
+#include "gl/impl/backend/ogl/tz_opengl.hpp"
+#include "GLFW/glfw3.h"
 
 namespace tz::gl
 {
     DeviceBuilderOGL::DeviceBuilderOGL():
-    primitive_type(GraphicsPrimitiveType::Triangles)
+    primitive_type(GraphicsPrimitiveType::Triangles),
+    frames_in_flight(2),
+    swapchain_image_count(0),
+    present_mode(PresentModePreference::DontCare)
     {
 
     }
@@ -19,10 +26,60 @@ namespace tz::gl
         return this->primitive_type;
     }
 
+    void DeviceBuilderOGL::set_frames_in_flight(std::size_t frames_in_flight)
+    {
+        tz_assert(frames_in_flight > 0, "DeviceBuilderOGL::set_frames_in_flight(%zu): Must have at least one frame in flight", frames_in_flight);
+        this->frames_in_flight = frames_in_flight;
+    }
+
+    std::size_t DeviceBuilderOGL::get_frames_in_flight() const
+    {
+        return this->frames_in_flight;
+    }
+
+    void DeviceBuilderOGL::set_swapchain_image_count(std::size_t image_count)
+    {
+        this->swapchain_image_count = image_count;
+    }
+
+    std::size_t DeviceBuilderOGL::get_swapchain_image_count() const
+    {
+        return this->swapchain_image_count;
+    }
+
+    void DeviceBuilderOGL::set_present_mode(PresentModePreference present_mode)
+    {
+        this->present_mode = present_mode;
+    }
+
+    PresentModePreference DeviceBuilderOGL::get_present_mode() const
+    {
+        return this->present_mode;
+    }
+
     DeviceOGL::DeviceOGL(DeviceBuilderOGL builder):
-    primitive_type(builder.get_primitive_type())
+    primitive_type(builder.get_primitive_type()),
+    geometry_arena()
     {
-        
+        // The driver decides how many frames are in flight and how many images are in the swapchain, so we can only ask for a swap interval. Headless applications never present, so there's nothing to ask for.
+        if(ogl::is_headless())
+        {
+            return;
+        }
+        switch(builder.get_present_mode())
+        {
+            case PresentModePreference::DontCare:
+            break;
+            case PresentModePreference::Vsync:
+                glfwSwapInterval(1);
+            break;
+            case PresentModePreference::LowLatency:
+                // There's no way to replace a queued frame with a newer one in OpenGL, so the lowest latency we can get is not waiting for vsync at all.
+            [[fallthrough]];
+            case PresentModePreference::Immediate:
+                glfwSwapInterval(0);
+            break;
+        }
     }
 
     RenderPass DeviceOGL::create_render_pass(RenderPassBuilder builder) const
@@ -32,7 +89,8 @@ namespace tz::gl
 
     Renderer DeviceOGL::create_renderer(RendererBuilder builder) const
     {
-        return {builder};
+        tz_profile_scope("Device::create_renderer");
+        return {builder, this->geometry_arena};
     }
 
     Shader DeviceOGL::create_shader(ShaderBuilder builder) const
@@ -2,6 +2,7 @@
 #define TOPAZ_GL_IMPL_OGL_DEVICE_HPP
 #if TZ_OGL
 #include "gl/api/device.hpp"
+#include "gl/impl/frontend/ogl/geometry_arena.hpp"
 
 namespace tz::gl
 {
@@ -11,10 +12,19 @@ namespace tz::gl
         DeviceBuilderOGL();
         virtual void set_primitive_type(GraphicsPrimitiveType type) final;
         virtual GraphicsPrimitiveType get_primitive_type() const final;
+        virtual void set_frames_in_flight(std::size_t frames_in_flight) final;
+        virtual std::size_t get_frames_in_flight() const final;
+        virtual void set_swapchain_image_count(std::size_t image_count) final;
+        virtual std::size_t get_swapchain_image_count() const final;
+        virtual void set_present_mode(PresentModePreference present_mode) final;
+        virtual PresentModePreference get_present_mode() const final;
 
         friend class DeviceOGL;
     private:
         GraphicsPrimitiveType primitive_type;
+        std::size_t frames_in_flight;
+        std::size_t swapchain_image_count;
+        PresentModePreference present_mode;
     };
 
     class DeviceOGL : IDevice
@@ -26,6 +36,8 @@ namespace tz::gl
         [[nodiscard]] virtual Shader create_shader(ShaderBuilder builder) const final;
     private:
         GraphicsPrimitiveType primitive_type;
+        /// Static geometry of all renderers created by this device.
+        mutable GeometryArenaOGL geometry_arena;
     };
 }
 
@@ -0,0 +1,47 @@
+#if TZ_OGL
+#include "core/report.hpp"
+#include "gl/impl/frontend/ogl/geometry_arena.hpp"
+
+namespace tz::gl
+{
+    GeometryArenaOGL::GeometryArenaOGL():
+    allocator(vertex_page_size, index_page_size),
+    pages()
+    {}
+
+    GeometryArenaAllocation GeometryArenaOGL::allocate(std::size_t vertex_bytes, std::size_t vertex_stride, std::size_t index_bytes)
+    {
+        GeometryArenaAllocation allocation = this->allocator.allocate(vertex_bytes, vertex_stride, index_bytes);
+        while(this->pages.size() < this->allocator.get_page_count())
+        {
+            std::size_t page_id = this->pages.size();
+            std::size_t vertex_capacity = this->allocator.get_vertex_page_capacity(page_id);
+            std::size_t index_capacity = this->allocator.get_index_page_capacity(page_id);
+            this->pages.push_back
+            ({
+                .vertex_buffer = ogl::Buffer{ogl::BufferType::Vertex, ogl::BufferPurpose::StaticDraw, ogl::BufferUsage::ReadWrite, vertex_capacity},
+                .index_buffer = ogl::Buffer{ogl::BufferType::Index, ogl::BufferPurpose::StaticDraw, ogl::BufferUsage::ReadWrite, index_capacity}
+            });
+            tz_report("Geometry Arena Page %zu (VB %zu bytes, IB %zu bytes)", page_id, vertex_capacity, index_capacity);
+        }
+        return allocation;
+    }
+
+    void GeometryArenaOGL::free(const GeometryArenaAllocation& allocation)
+    {
+        // OpenGL orders any later writes to this range after earlier draws which read from it, so it can be reused immediately.
+        this->allocator.free(allocation);
+    }
+
+    ogl::Buffer& GeometryArenaOGL::get_vertex_buffer(std::size_t page_id)
+    {
+        return this->pages[page_id].vertex_buffer;
+    }
+
+    ogl::Buffer& GeometryArenaOGL::get_index_buffer(std::size_t page_id)
+    {
+        return this->pages[page_id].index_buffer;
+    }
+}
+
+#endif // TZ_OGL
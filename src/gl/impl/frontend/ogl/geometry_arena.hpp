@@ -0,0 +1,41 @@
+#ifndef TOPAZ_GL_IMPL_OGL_GEOMETRY_ARENA_HPP
+#define TOPAZ_GL_IMPL_OGL_GEOMETRY_ARENA_HPP
+#if TZ_OGL
+#include "gl/impl/frontend/common/geometry_arena.hpp"
+#include "gl/impl/backend/ogl/buffer.hpp"
+
+namespace tz::gl
+{
+    /**
+     * @brief Device-wide storage for static geometry. Renderers sub-allocate from large shared vertex/index buffers instead of each making their own.
+     */
+    class GeometryArenaOGL
+    {
+    public:
+        constexpr static std::size_t vertex_page_size = 16 * 1024 * 1024;
+        constexpr static std::size_t index_page_size = 4 * 1024 * 1024;
+        GeometryArenaOGL();
+        /**
+         * @brief Find room for some geometry, creating new buffers if no existing page has room.
+         */
+        GeometryArenaAllocation allocate(std::size_t vertex_bytes, std::size_t vertex_stride, std::size_t index_bytes);
+        /**
+         * @brief Return geometry to the arena, so its ranges can be reused by a future allocation.
+         */
+        void free(const GeometryArenaAllocation& allocation);
+        ogl::Buffer& get_vertex_buffer(std::size_t page_id);
+        ogl::Buffer& get_index_buffer(std::size_t page_id);
+    private:
+        struct Page
+        {
+            ogl::Buffer vertex_buffer;
+            ogl::Buffer index_buffer;
+        };
+
+        GeometryArenaAllocator allocator;
+        std::vector<Page> pages;
+    };
+}
+
+#endif // TZ_OGL
+#endif // TOPAZ_GL_IMPL_OGL_GEOMETRY_ARENA_HPP
@@ -1,6 +1,7 @@
 #if TZ_OGL
 #include "core/assert.hpp"
 #include "gl/impl/frontend/ogl/render_pass.hpp"
+#include <algorithm>
 
 namespace tz::gl
 {
@@ -1,20 +1,14 @@
 #if TZ_OGL
+#include "core/profile.hpp"
 #include "core/report.hpp"
 #include "core/tz.hpp"
 #include "gl/impl/frontend/ogl/renderer.hpp"
+#include "gl/impl/backend/ogl/tz_opengl.hpp"
 #include <numeric>
+#include <limits>
 
 namespace tz::gl
 {
-    struct DrawIndirectCommand
-    {
-        unsigned int count;
-        unsigned int instanceCount;
-        unsigned int firstIndex;
-        unsigned int baseVertex;
-        unsigned int baseInstance;
-    };
-
    RendererInputHandle RendererBuilderOGL::add_input(const IRendererInput& input)
    {
        auto sz = this->inputs.size();
@@ -69,6 +63,16 @@ namespace tz::gl
         return this->culling_strategy;
     }
 
+    void RendererBuilderOGL::set_dynamic_data_mode(RendererDynamicDataMode dynamic_data_mode)
+    {
+        this->dynamic_data_mode = dynamic_data_mode;
+    }
+
+    RendererDynamicDataMode RendererBuilderOGL::get_dynamic_data_mode() const
+    {
+        return this->dynamic_data_mode;
+    }
+
     void RendererBuilderOGL::set_render_pass(const RenderPass& render_pass)
     {
         this->render_pass = &render_pass;
@@ -106,23 +110,36 @@ namespace tz::gl
     }
 
 
-    RendererOGL::RendererOGL(RendererBuilderOGL builder):
+    RendererOGL::RendererOGL(RendererBuilderOGL builder, GeometryArenaOGL& geometry_arena):
     vao(0),
-    vbo(std::nullopt),
-    ibo(std::nullopt),
+    geometry_arena(&geometry_arena),
+    static_geometry(std::nullopt),
     vbo_dynamic(std::nullopt),
     ibo_dynamic(std::nullopt),
-    indirect_buffer(std::nullopt),
-    indirect_buffer_dynamic(std::nullopt),
+    indirect_buffers(),
+    indirect_buffer_fences(draw_indirect_buffer_count, nullptr),
+    indirect_buffer_capacity(0),
+    indirect_buffer_id(0),
     resources(),
     resource_ubos(),
     resource_textures(),
+    dynamic_vertex_regions(),
     render_pass(&builder.get_render_pass()),
     shader(&builder.get_shader()),
     inputs(this->copy_inputs(builder)),
-    output(builder.get_output())
-    {
-        auto persistent_mapped_buffer_flags = GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    output(builder.get_output()),
+    draw_table(builder.ogl_get_inputs()),
+    draw_cache(),
+    draw_counts(),
+    gpu_timing_frames(),
+    gpu_timing_frame_id(0),
+    render_pass_timings(),
+    draw_timings()
+    {
+        tz_profile_scope("RendererOGL::RendererOGL");
+        // Dynamic resources aren't coherent. Instead, only the ranges which have changed are flushed before each draw.
+        auto persistent_mapped_storage_flags = GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT;
+        auto persistent_mapped_map_flags = persistent_mapped_storage_flags | GL_MAP_FLUSH_EXPLICIT_BIT;
 
         if(builder.get_render_pass().requires_depth_image())
         {
@@ -214,23 +231,27 @@ namespace tz::gl
             }
 
             // Step 2: Fill buffers and map properly.
-            if(any_static_geometry)
+            if(any_static_geometry && !total_indices.empty())
             {
-                this->vbo = ogl::Buffer{ogl::BufferType::Vertex, ogl::BufferPurpose::StaticDraw, ogl::BufferUsage::ReadWrite, total_vertices.size()};
-                this->vbo->write(total_vertices.data(), total_vertices.size());
-                tz_report("VB Static (%zu vertices, %zu bytes total)", total_vertices.size() / fmt.binding_size, total_vertices.size());
+                tz_profile_scope("RendererOGL::upload_static_geometry");
+                // Static geometry lives in buffers shared by every renderer on the device.
                 std::size_t total_indices_size = total_indices.size() * sizeof(unsigned int);
-                this->ibo = ogl::Buffer{ogl::BufferType::Index, ogl::BufferPurpose::StaticDraw, ogl::BufferUsage::ReadWrite, total_indices_size};
-                this->ibo->write(total_indices.data(), total_indices_size);
-                tz_report("IB Static (%zu indices, %zu bytes total)", total_indices.size(), total_indices_size);
+                this->static_geometry = this->geometry_arena->allocate(total_vertices.size(), fmt.binding_size, total_indices_size);
+                const GeometryArenaAllocation& static_geometry = this->static_geometry.value();
+                this->geometry_arena->get_vertex_buffer(static_geometry.page_id).write(total_vertices.data(), total_vertices.size(), static_geometry.vertices.offset);
+                tz_report("VB Static (%zu vertices, %zu bytes total, arena page %zu)", total_vertices.size() / fmt.binding_size, total_vertices.size(), static_geometry.page_id);
+                this->geometry_arena->get_index_buffer(static_geometry.page_id).write(total_indices.data(), total_indices_size, static_geometry.indices.offset);
+                tz_report("IB Static (%zu indices, %zu bytes total, arena page %zu)", total_indices.size(), total_indices_size, static_geometry.page_id);
+                // The shared buffers are bound from the beginning, so draws need to know where this renderer's geometry begins.
+                this->draw_table.rebase_static(static_cast<std::uint32_t>(static_geometry.get_base_index()), static_cast<std::int32_t>(static_geometry.get_base_vertex()));
             }
             if(any_dynamic_geometry)
             {
-                this->vbo_dynamic = ogl::Buffer{ogl::BufferType::Vertex, ogl::BufferPurpose::DynamicDraw, ogl::BufferUsage::PersistentMapped, total_vertices_dynamic.size()};
+                this->vbo_dynamic = ogl::Buffer{ogl::BufferType::Vertex, ogl::BufferPurpose::DynamicDraw, ogl::BufferUsage::PersistentMappedExplicitFlush, total_vertices_dynamic.size()};
                 this->vbo_dynamic->write(total_vertices_dynamic.data(), total_vertices_dynamic.size());
                 tz_report("VB Dynamic (%zu vertices, %zu bytes total)", total_vertices_dynamic.size() / fmt.binding_size, total_vertices_dynamic.size());
                 std::size_t total_indices_dynamic_size = total_indices_dynamic.size() * sizeof(unsigned int);
-                this->ibo_dynamic = ogl::Buffer{ogl::BufferType::Index, ogl::BufferPurpose::DynamicDraw, ogl::BufferUsage::PersistentMapped, total_indices_dynamic_size};
+                this->ibo_dynamic = ogl::Buffer{ogl::BufferType::Index, ogl::BufferPurpose::DynamicDraw, ogl::BufferUsage::PersistentMappedExplicitFlush, total_indices_dynamic_size};
                 this->ibo_dynamic->write(total_indices_dynamic.data(), total_indices_dynamic_size);
                 tz_report("IB Dynamic (%zu indices, %zu bytes total)", total_indices_dynamic.size(), total_indices_dynamic_size);
 
@@ -241,6 +262,7 @@ namespace tz::gl
                 for(const auto& vertex_region : vertex_regions)
                 {
                     vertex_region.input.set_vertex_data(vtx_mem + vertex_region.offset);
+                    this->dynamic_vertex_regions.push_back({.input = &vertex_region.input, .offset = vertex_region.offset, .length = vertex_region.length});
                 }
 
                 unsigned int* idx_mem = static_cast<unsigned int*>(idx_data);
@@ -248,6 +270,9 @@ namespace tz::gl
                 {
                     index_region.input.set_index_data(idx_mem + index_region.offset);
                 }
+                // Initial data was just written into the mapped buffers directly.
+                this->vbo_dynamic->flush(0, total_vertices_dynamic.size());
+                this->ibo_dynamic->flush(0, total_indices_dynamic_size);
             }
 
             // Step 3: Sort out formats (vertex array attributes)
@@ -310,9 +335,10 @@ namespace tz::gl
                     {
                         auto& dynamic_buf = *static_cast<IDynamicResource*>(buffer_resource);
                         auto buf_bytes = dynamic_buf.get_resource_bytes().size_bytes();
-                        glNamedBufferStorage(buf, buf_bytes, dynamic_buf.get_resource_bytes().data(), persistent_mapped_buffer_flags);
-                        void* res_data = glMapNamedBufferRange(buf, 0, buf_bytes, persistent_mapped_buffer_flags);
+                        glNamedBufferStorage(buf, buf_bytes, dynamic_buf.get_resource_bytes().data(), persistent_mapped_storage_flags);
+                        void* res_data = glMapNamedBufferRange(buf, 0, buf_bytes, persistent_mapped_map_flags);
                         dynamic_buf.set_resource_data(static_cast<std::byte*>(res_data));
+                        glFlushMappedNamedBufferRange(buf, 0, buf_bytes);
                     }
                 break;
                 default:
@@ -395,23 +421,43 @@ namespace tz::gl
             glTextureSubImage2D(tex, 0, 0, 0, tex_w, tex_h, format, type, texture_resource->get_resource_bytes().data());
         }
 
+        this->ensure_indirect_capacity(this->inputs.size());
         this->bind_draw_list(this->all_inputs_once());
 
+        // Implementations are allowed to not support timestamps at all, in which case they report zero bits.
+        GLint timestamp_bits = 0;
+        glGetQueryiv(GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &timestamp_bits);
+        if(timestamp_bits > 0)
+        {
+            this->gpu_timing_frames.resize(gpu_timing_frame_count);
+            for(GPUTimingFrame& frame : this->gpu_timing_frames)
+            {
+                glCreateQueries(GL_TIMESTAMP, GPUTimestampCount, frame.queries.data());
+                frame.written.fill(false);
+            }
+        }
+
         tz_report("RendererOGL (%zu input%s, %zu resource%s)", this->inputs.size(), this->inputs.size() == 1 ? "" : "s", this->resources.size(), this->resources.size() == 1 ? "" : "s");
     }
 
     RendererOGL::RendererOGL(RendererOGL&& move):
     vao(0),
-    vbo(std::nullopt),
-    ibo(std::nullopt),
+    geometry_arena(nullptr),
+    static_geometry(std::nullopt),
     vbo_dynamic(std::nullopt),
     ibo_dynamic(std::nullopt),
-    indirect_buffer(std::nullopt),
-    indirect_buffer_dynamic(std::nullopt),
+    indirect_buffers(),
+    indirect_buffer_fences(),
+    indirect_buffer_capacity(0),
+    indirect_buffer_id(0),
     resource_ubos(),
     render_pass(nullptr),
     shader(nullptr),
-    output(nullptr)
+    output(nullptr),
+    gpu_timing_frames(),
+    gpu_timing_frame_id(0),
+    render_pass_timings(),
+    draw_timings()
     {
         *this = std::move(move);
     }
@@ -420,25 +466,55 @@ namespace tz::gl
     {
         glDeleteBuffers(static_cast<GLsizei>(this->resource_ubos.size()), this->resource_ubos.data());
         glDeleteTextures(static_cast<GLsizei>(this->resource_textures.size()), this->resource_textures.data());
+        for(GLsync fence : this->indirect_buffer_fences)
+        {
+            if(fence != nullptr)
+            {
+                glDeleteSync(fence);
+            }
+        }
+
+        for(GPUTimingFrame& frame : this->gpu_timing_frames)
+        {
+            glDeleteQueries(GPUTimestampCount, frame.queries.data());
+        }
 
         if(this->vao != 0)
         {
             glDeleteVertexArrays(1, &this->vao);
         }
+        if(this->static_geometry.has_value())
+        {
+            this->geometry_arena->free(this->static_geometry.value());
+        }
     }
 
     RendererOGL& RendererOGL::operator=(RendererOGL&& rhs)
     {
         std::swap(this->vao, rhs.vao);
-        std::swap(this->vbo, rhs.vbo);
-        std::swap(this->ibo, rhs.ibo);
+        std::swap(this->geometry_arena, rhs.geometry_arena);
+        std::swap(this->static_geometry, rhs.static_geometry);
+        std::swap(this->vbo_dynamic, rhs.vbo_dynamic);
+        std::swap(this->ibo_dynamic, rhs.ibo_dynamic);
+        std::swap(this->indirect_buffers, rhs.indirect_buffers);
+        std::swap(this->indirect_buffer_fences, rhs.indirect_buffer_fences);
+        std::swap(this->indirect_buffer_capacity, rhs.indirect_buffer_capacity);
+        std::swap(this->indirect_buffer_id, rhs.indirect_buffer_id);
+        std::swap(this->draw_table, rhs.draw_table);
+        std::swap(this->draw_cache, rhs.draw_cache);
+        std::swap(this->draw_counts, rhs.draw_counts);
         std::swap(this->resource_ubos, rhs.resource_ubos);
         std::swap(this->resource_textures, rhs.resource_textures);
+        std::swap(this->dynamic_vertex_regions, rhs.dynamic_vertex_regions);
         std::swap(this->format, rhs.format);
         std::swap(this->render_pass, rhs.render_pass);
         std::swap(this->shader, rhs.shader);
         std::swap(this->inputs, rhs.inputs);
         std::swap(this->output, rhs.output);
+        std::swap(this->gpu_timing_frames, rhs.gpu_timing_frames);
+        std::swap(this->gpu_timing_frame_id, rhs.gpu_timing_frame_id);
+        std::swap(this->render_pass_timings, rhs.render_pass_timings);
+        std::swap(this->draw_timings, rhs.draw_timings);
         return *this;
     }
 
@@ -510,14 +586,26 @@ namespace tz::gl
 
     void RendererOGL::render()
     {
+        tz_profile_scope("RendererOGL::render");
+        this->write_gpu_timestamp(PassBegin);
         if(this->output == nullptr)
         {
-            tz_report("[Warning]: RendererOGL::render() invoked with no output specified. The behaviour is undefined.");
+            tz_warning_report("RendererOGL::render() invoked with no output specified. The behaviour is undefined.");
         }
         else if(this->output->get_type() == RendererOutputType::Window)
         {
-            glBindFramebuffer(GL_FRAMEBUFFER, 0);
-            glViewport(0, 0, static_cast<GLsizei>(tz::window().get_width()), static_cast<GLsizei>(tz::window().get_height()));
+            if(ogl::is_headless())
+            {
+                // No window, so render into the framebuffer standing in for it.
+                const ogl::HeadlessFramebuffer& framebuffer = ogl::get_headless_framebuffer();
+                glBindFramebuffer(GL_FRAMEBUFFER, framebuffer.native());
+                glViewport(0, 0, framebuffer.get_width(), framebuffer.get_height());
+            }
+            else
+            {
+                glBindFramebuffer(GL_FRAMEBUFFER, 0);
+                glViewport(0, 0, static_cast<GLsizei>(tz::window().get_width()), static_cast<GLsizei>(tz::window().get_height()));
+            }
         }
 
         auto attachment = this->render_pass->ogl_get_attachments()[0];
@@ -537,6 +625,7 @@ namespace tz::gl
         }
         glClear(buffer_bits);
 
+        this->flush_dynamic_data();
         glBindVertexArray(this->vao);
         for(std::size_t i = 0; i < this->resource_ubos.size(); i++)
         {
@@ -554,21 +643,40 @@ namespace tz::gl
             glProgramUniform1i(this->shader->ogl_get_program_handle(), tex_location, tex_location);
         }
 
-        if(this->indirect_buffer.has_value())
+        std::size_t static_draw_count = this->draw_counts.static_draws;
+        std::size_t dynamic_draw_count = this->draw_counts.dynamic_draws;
+        if(this->draw_counts.total() == 0)
         {
-            glVertexArrayVertexBuffer(this->vao, 0, this->vbo->native(), 0, static_cast<GLsizei>(this->format.binding_size));
-            glVertexArrayElementBuffer(this->vao, this->ibo->native());
-            this->indirect_buffer->bind();
-            glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, nullptr, this->num_static_draws(), sizeof(DrawIndirectCommand));
+            this->end_gpu_timing_frame();
+            return;
+        }
+        this->indirect_buffers[this->indirect_buffer_id].bind();
+        if(static_draw_count > 0)
+        {
+            this->write_gpu_timestamp(StaticDrawsBegin);
+            glVertexArrayVertexBuffer(this->vao, 0, this->geometry_arena->get_vertex_buffer(this->static_geometry->page_id).native(), 0, static_cast<GLsizei>(this->format.binding_size));
+            glVertexArrayElementBuffer(this->vao, this->geometry_arena->get_index_buffer(this->static_geometry->page_id).native());
+            glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, nullptr, static_draw_count, sizeof(DrawIndirectCommand));
+            this->write_gpu_timestamp(StaticDrawsEnd);
         }
 
-        if(this->indirect_buffer_dynamic.has_value())
+        if(dynamic_draw_count > 0)
         {
+            this->write_gpu_timestamp(DynamicDrawsBegin);
             glVertexArrayVertexBuffer(this->vao, 0, this->vbo_dynamic->native(), 0, static_cast<GLsizei>(this->format.binding_size));
             glVertexArrayElementBuffer(this->vao, this->ibo_dynamic->native());
-            this->indirect_buffer_dynamic->bind();
-            glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, nullptr, this->num_dynamic_draws(), sizeof(DrawIndirectCommand));
+            glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, reinterpret_cast<const void*>(sizeof(DrawIndirectCommand) * static_draw_count), dynamic_draw_count, sizeof(DrawIndirectCommand));
+            this->write_gpu_timestamp(DynamicDrawsEnd);
+        }
+        this->end_gpu_timing_frame();
+
+        // Remember when the GPU is done with this indirect buffer, so we know when it's safe to write into it again.
+        GLsync& fence = this->indirect_buffer_fences[this->indirect_buffer_id];
+        if(fence != nullptr)
+        {
+            glDeleteSync(fence);
         }
+        fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
     }
 
     void RendererOGL::render(RendererDrawList draw_list)
@@ -580,102 +688,156 @@ namespace tz::gl
         this->render();
     }
 
-    void RendererOGL::bind_draw_list(const RendererDrawList& draws)
+    RendererGPUTimings RendererOGL::get_gpu_timings() const
     {
-        if(this->draws_match_cache(draws))
+        return {.render_pass = this->render_pass_timings.get_stats(), .draws = this->draw_timings.get_stats()};
+    }
+
+    void RendererOGL::write_gpu_timestamp(std::size_t timestamp_id)
+    {
+        if(this->gpu_timing_frames.empty())
         {
             return;
         }
-        // Firstly, retrieve an internal draw command for every input.
-        std::unordered_map<const IRendererInput*, DrawIndirectCommand> input_draws;
-        std::unordered_map<const IRendererInput*, DrawIndirectCommand> dynamic_input_draws;
+        GPUTimingFrame& frame = this->gpu_timing_frames[this->gpu_timing_frame_id];
+        glQueryCounter(frame.queries[timestamp_id], GL_TIMESTAMP);
+        frame.written[timestamp_id] = true;
+    }
 
+    void RendererOGL::end_gpu_timing_frame()
+    {
+        if(this->gpu_timing_frames.empty())
+        {
+            return;
+        }
+        this->write_gpu_timestamp(PassEnd);
+        this->gpu_timing_frame_id = (this->gpu_timing_frame_id + 1) % gpu_timing_frame_count;
+
+        // The next frame's queries are about to be overwritten, so this is the last chance to read them.
+        GPUTimingFrame& frame = this->gpu_timing_frames[this->gpu_timing_frame_id];
+        if(!frame.written[PassBegin] || !frame.written[PassEnd])
+        {
+            return;
+        }
+        // Timestamps complete in order, so if the last one is available they all are. If the GPU is still that far behind, the frame is dropped rather than waited on.
+        GLuint available = GL_FALSE;
+        glGetQueryObjectuiv(frame.queries[PassEnd], GL_QUERY_RESULT_AVAILABLE, &available);
+        if(available == GL_TRUE)
         {
-            std::size_t static_vtx_count = 0, static_idx_count = 0;
-            std::size_t dynamic_vtx_count = 0, dynamic_idx_count = 0;
-            for(const auto& input_ptr : this->inputs)
+            std::array<GLuint64, GPUTimestampCount> timestamps{};
+            for(std::size_t i = 0; i < GPUTimestampCount; i++)
             {
-                const IRendererInput* input = input_ptr.get();
-                DrawIndirectCommand cmd;
-                cmd.count = input->index_count();
-                cmd.instanceCount = 1;
-                cmd.baseInstance = 0;
-                switch(input->data_access())
+                if(frame.written[i])
                 {
-                    case RendererInputDataAccess::StaticFixed:
-                        cmd.baseVertex = static_vtx_count;
-                        cmd.firstIndex = static_idx_count;
-                        static_vtx_count += input->vertex_count();
-                        static_idx_count += input->index_count();
-                        input_draws[input] = cmd;
-                    break;
-                    case RendererInputDataAccess::DynamicFixed:
-                        cmd.baseVertex = dynamic_vtx_count;
-                        cmd.firstIndex = dynamic_idx_count;
-                        dynamic_vtx_count += input->vertex_count();
-                        dynamic_idx_count += input->index_count();
-                        dynamic_input_draws[input] = cmd;
-                    break;
-                    default:
-                        tz_error("Unknown renderer input data access (OpenGL)");
-                    break;
+                    glGetQueryObjectui64v(frame.queries[i], GL_QUERY_RESULT, &timestamps[i]);
                 }
             }
+            auto elapsed_ms = [&timestamps](std::size_t begin, std::size_t end)
+            {
+                return static_cast<float>(timestamps[end] - timestamps[begin]) / 1000000.0f;
+            };
+            float draws_ms = 0.0f;
+            if(frame.written[StaticDrawsBegin])
+            {
+                draws_ms += elapsed_ms(StaticDrawsBegin, StaticDrawsEnd);
+            }
+            if(frame.written[DynamicDrawsBegin])
+            {
+                draws_ms += elapsed_ms(DynamicDrawsBegin, DynamicDrawsEnd);
+            }
+            this->render_pass_timings.add(elapsed_ms(PassBegin, PassEnd));
+            this->draw_timings.add(draws_ms);
+        }
+        frame.written.fill(false);
+    }
+
+    void RendererOGL::bind_draw_list(const RendererDrawList& draws)
+    {
+        tz_profile_scope("RendererOGL::bind_draw_list");
+        if(this->draws_match_cache(draws))
+        {
+            return;
         }
+        // Move onto the next indirect buffer. It hasn't been drawn from for a while so this should never actually block, but the GPU could still be reading from it so we must check.
+        this->indirect_buffer_id = (this->indirect_buffer_id + 1) % draw_indirect_buffer_count;
+        GLsync& fence = this->indirect_buffer_fences[this->indirect_buffer_id];
+        if(fence != nullptr)
+        {
+            while(glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, std::numeric_limits<GLuint64>::max()) == GL_TIMEOUT_EXPIRED){}
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+        this->ensure_indirect_capacity(draws.length());
 
-        // Secondly, convert the draw list to a list of indirect draw commands.
-        std::vector<DrawIndirectCommand> internal_draws;
-        std::vector<DrawIndirectCommand> internal_draws_dynamic;
-        internal_draws.reserve(draws.length());
-        for(RendererInputHandle handle : draws)
+        // Write the draw commands straight into the mapped buffer.
+        auto* cmd = draws.empty() ? nullptr : static_cast<DrawIndirectCommand*>(this->indirect_buffers[this->indirect_buffer_id].map_memory());
+        this->draw_counts = this->draw_table.gather(draws, {cmd, draws.length()});
+        this->draw_cache = draws;
+    }
+
+    void RendererOGL::ensure_indirect_capacity(std::size_t draw_count)
+    {
+        if(draw_count <= this->indirect_buffer_capacity)
         {
-            std::size_t handle_val = static_cast<std::size_t>(static_cast<tz::HandleValue>(handle));
-            const IRendererInput* input = this->inputs[handle_val].get();
-            switch(input->data_access())
+            return;
+        }
+        // Usually happens once at construction, afterwards only if a draw list contains duplicates. Deleting a buffer the GPU is still using is fine in OpenGL, so we don't need to wait.
+        for(GLsync& fence : this->indirect_buffer_fences)
+        {
+            if(fence != nullptr)
             {
-                case RendererInputDataAccess::StaticFixed:
-                    internal_draws.push_back(input_draws[input]);
-                break;
-                case RendererInputDataAccess::DynamicFixed:
-                    internal_draws_dynamic.push_back(dynamic_input_draws[input]);
-                break;
-                default:
-                        tz_error("Unknown renderer input data access (OpenGL)");
-                break;
+                glDeleteSync(fence);
+                fence = nullptr;
             }
         }
-        tz_assert(internal_draws.size() + internal_draws_dynamic.size() == draws.length(), "Internal draw total didn't match number of inputs in draw list");
-
-        if(internal_draws.empty())
+        this->indirect_buffers.clear();
+        for(std::size_t i = 0; i < draw_indirect_buffer_count; i++)
         {
-            this->indirect_buffer = std::nullopt;
+            ogl::Buffer& indirect_buffer = this->indirect_buffers.emplace_back(ogl::BufferType::DrawIndirect, ogl::BufferPurpose::StreamDraw, ogl::BufferUsage::PersistentMapped, sizeof(DrawIndirectCommand) * draw_count);
+            indirect_buffer.map_memory();
         }
-        else
+        this->indirect_buffer_capacity = draw_count;
+    }
+
+    void RendererOGL::flush_dynamic_data()
+    {
+        // Only ranges which have been marked dirty are flushed. Data whose owner has never marked anything dirty could have changed anywhere, so is flushed in its entirety.
+        auto flush_changes = [](DirtyRangeList& dirty_ranges, std::size_t region_offset, std::size_t region_length, auto flush)
         {
-            std::size_t draw_size_bytes = internal_draws.size() * sizeof(DrawIndirectCommand);
-            if(!this->indirect_buffer.has_value())
+            if(dirty_ranges.is_explicit())
             {
-                this->indirect_buffer = ogl::Buffer{ogl::BufferType::DrawIndirect, ogl::BufferPurpose::StaticDraw, ogl::BufferUsage::ReadWrite, draw_size_bytes};
+                for(const DirtyRange& range : dirty_ranges.get_ranges())
+                {
+                    flush(region_offset + range.offset, range.length);
+                }
             }
+            else if(region_length > 0)
+            {
+                flush(region_offset, region_length);
+            }
+            dirty_ranges.clear();
+        };
 
-            this->indirect_buffer->write(internal_draws.data(), draw_size_bytes);
-        }
-
-        if(internal_draws_dynamic.empty())
+        for(DynamicInputRegion& region : this->dynamic_vertex_regions)
         {
-            this->indirect_buffer_dynamic = std::nullopt;
+            flush_changes(region.input->dirty_ranges, region.offset, region.length, [this](std::size_t offset, std::size_t length)
+            {
+                this->vbo_dynamic->flush(offset, length);
+            });
         }
-        else
+        // Buffer resources come first, in the same order as their UBOs.
+        for(std::size_t i = 0; i < this->resource_ubos.size(); i++)
         {
-            std::size_t draw_size_bytes = internal_draws_dynamic.size() * sizeof(DrawIndirectCommand);
-            if(!this->indirect_buffer_dynamic.has_value())
+            IResource* buffer_resource = this->resources[i].get();
+            if(buffer_resource->data_access() == RendererInputDataAccess::DynamicFixed)
             {
-                this->indirect_buffer_dynamic = ogl::Buffer{ogl::BufferType::DrawIndirect, ogl::BufferPurpose::StaticDraw, ogl::BufferUsage::ReadWrite, draw_size_bytes};
+                GLuint res_ubo = this->resource_ubos[i];
+                flush_changes(static_cast<IDynamicResource*>(buffer_resource)->dirty_ranges, 0, buffer_resource->get_resource_bytes().size_bytes(), [res_ubo](std::size_t offset, std::size_t length)
+                {
+                    glFlushMappedNamedBufferRange(res_ubo, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(length));
+                });
             }
-
-            this->indirect_buffer_dynamic->write(internal_draws_dynamic.data(), draw_size_bytes);
         }
-        this->draw_cache = draws;
     }
 
     bool RendererOGL::draws_match_cache(const RendererDrawList& list) const
@@ -712,46 +874,6 @@ namespace tz::gl
         }
         return inputs;
     }
-
-    std::size_t RendererOGL::num_static_inputs() const
-    {
-        std::size_t total = std::accumulate(this->inputs.begin(), this->inputs.end(), 0, [](std::size_t accumulator, const std::unique_ptr<IRendererInput>& input)
-        {
-            return accumulator + (input->data_access() == RendererInputDataAccess::StaticFixed ? 1 : 0);
-        });
-
-        return total;
-    }
-
-    std::size_t RendererOGL::num_dynamic_inputs() const
-    {
-        std::size_t total = std::accumulate(this->inputs.begin(), this->inputs.end(), 0, [](std::size_t accumulator, const std::unique_ptr<IRendererInput>& input)
-        {
-            return accumulator + (input->data_access() == RendererInputDataAccess::DynamicFixed ? 1 : 0);
-        });
-
-        return total;
-    }
-
-    std::size_t RendererOGL::num_static_draws() const
-    {
-        std::size_t total = std::accumulate(this->draw_cache.begin(), this->draw_cache.end(), 0, [this](std::size_t accumulator, const RendererInputHandle& handle)
-        {
-            std::size_t handle_val = static_cast<std::size_t>(static_cast<tz::HandleValue>(handle));
-            return accumulator + (this->inputs[handle_val]->data_access() == RendererInputDataAccess::StaticFixed ? 1 : 0);
-        });
-        return total;
-    }
-    
-    std::size_t RendererOGL::num_dynamic_draws() const
-    {
-        std::size_t total = std::accumulate(this->draw_cache.begin(), this->draw_cache.end(), 0, [this](std::size_t accumulator, const RendererInputHandle& handle)
-        {
-            std::size_t handle_val = static_cast<std::size_t>(static_cast<tz::HandleValue>(handle));
-            return accumulator + (this->inputs[handle_val]->data_access() == RendererInputDataAccess::DynamicFixed ? 1 : 0);
-        });
-        return total;
-    }
 }
 
 #endif // TZ_OGL
\ No newline at end of file
@@ -3,6 +3,10 @@
 #if TZ_OGL
 #include "gl/api/renderer.hpp"
 #include "gl/impl/backend/ogl/buffer.hpp"
+#include "gl/impl/frontend/common/draw_table.hpp"
+#include "gl/impl/frontend/common/gpu_timings.hpp"
+#include "gl/impl/frontend/ogl/geometry_arena.hpp"
+#include <array>
 #include <optional>
 
 namespace tz::gl
@@ -21,6 +25,8 @@ namespace tz::gl
 
         virtual void set_culling_strategy(RendererCullingStrategy culling_strategy) final;
         virtual RendererCullingStrategy get_culling_strategy() const final;
+        virtual void set_dynamic_data_mode(RendererDynamicDataMode dynamic_data_mode) final;
+        virtual RendererDynamicDataMode get_dynamic_data_mode() const final;
         
         virtual void set_render_pass(const RenderPass& render_pass) final;
         virtual const RenderPass& get_render_pass() const final;
@@ -39,12 +45,17 @@ namespace tz::gl
         const RenderPass* render_pass = nullptr;
         const Shader* shader = nullptr;
         RendererCullingStrategy culling_strategy;
+        RendererDynamicDataMode dynamic_data_mode = RendererDynamicDataMode::DirectMapped;
     };
 
     class RendererOGL : public IRenderer
     {
     public:
-        RendererOGL(RendererBuilderOGL builder);
+        /**
+         * @param builder Describes the renderer.
+         * @param geometry_arena Device-wide storage which the static input geometry is placed into.
+         */
+        RendererOGL(RendererBuilderOGL builder, GeometryArenaOGL& geometry_arena);
         RendererOGL(const RendererOGL& copy) = delete;
         RendererOGL(RendererOGL&& move);
         ~RendererOGL();
@@ -66,31 +77,83 @@ namespace tz::gl
         
         virtual void render() final;
         virtual void render(RendererDrawList draw_list) final;
+        virtual RendererGPUTimings get_gpu_timings() const final;
     private:
         void bind_draw_list(const RendererDrawList& list);
         bool draws_match_cache(const RendererDrawList& list) const;
         RendererDrawList all_inputs_once() const;
         std::vector<std::unique_ptr<IRendererInput>> copy_inputs(const RendererBuilderOGL& builder);
         std::vector<IRendererInput*> get_inputs();
-        std::size_t num_static_inputs() const;
-        std::size_t num_dynamic_inputs() const;
-        std::size_t num_static_draws() const;
-        std::size_t num_dynamic_draws() const;
+        void ensure_indirect_capacity(std::size_t draw_count);
+        /// Flush any changes to dynamic inputs/resources so they're visible to the next draw.
+        void flush_dynamic_data();
+        /// Record the GPU time at which everything before this point has finished, into the current timing frame.
+        void write_gpu_timestamp(std::size_t timestamp_id);
+        /// Write the final timestamp of the frame and move onto the next timing frame, collecting its previous results first.
+        void end_gpu_timing_frame();
+
+        /// Where the vertex data of a dynamic input lives within the dynamic vertex buffer.
+        struct DynamicInputRegion
+        {
+            IRendererDynamicInput* input;
+            std::size_t offset;
+            std::size_t length;
+        };
+
+        /// Number of persistently-mapped draw-indirect buffers we cycle through whenever the draw list changes.
+        constexpr static std::size_t draw_indirect_buffer_count = 3;
+
+        enum GPUTimestamp : std::size_t
+        {
+            PassBegin,
+            StaticDrawsBegin,
+            StaticDrawsEnd,
+            DynamicDrawsBegin,
+            DynamicDrawsEnd,
+            PassEnd,
+            GPUTimestampCount
+        };
+        /// Timestamp queries written during a single frame.
+        struct GPUTimingFrame
+        {
+            std::array<GLuint, GPUTimestampCount> queries;
+            /// Which of the queries were written during the frame. Batches with no draws are skipped.
+            std::array<bool, GPUTimestampCount> written;
+        };
+        /// Number of frames of timestamp queries we cycle through. Each frame's results are only read once we come back round to it, by which point they should be available without waiting.
+        constexpr static std::size_t gpu_timing_frame_count = 4;
 
         GLuint vao;
-        std::optional<ogl::Buffer> vbo, ibo, vbo_dynamic, ibo_dynamic;
+        GeometryArenaOGL* geometry_arena;
+        /// Where the static input geometry lives within `geometry_arena`, if there is any.
+        std::optional<GeometryArenaAllocation> static_geometry;
+        std::optional<ogl::Buffer> vbo_dynamic, ibo_dynamic;
         //GLuint vbo, ibo, vbo_dynamic, ibo_dynamic;
-        std::optional<ogl::Buffer> indirect_buffer, indirect_buffer_dynamic;
         //GLuint indirect_buffer, indirect_buffer_dynamic;
+        /// Static draws come first in each buffer, immediately followed by dynamic draws.
+        std::vector<ogl::Buffer> indirect_buffers;
+        /// Signalled once the GPU has finished the last draw which used the corresponding indirect buffer.
+        std::vector<GLsync> indirect_buffer_fences;
+        std::size_t indirect_buffer_capacity;
+        std::size_t indirect_buffer_id;
         std::vector<std::unique_ptr<IResource>> resources;
         std::vector<GLuint> resource_ubos;
         std::vector<GLuint> resource_textures;
+        std::vector<DynamicInputRegion> dynamic_vertex_regions;
         RendererElementFormat format;
         const RenderPass* render_pass;
         const Shader* shader;
         std::vector<std::unique_ptr<IRendererInput>> inputs;
         const IRendererOutput* output;
+        RendererDrawTable draw_table;
         RendererDrawList draw_cache;
+        /// Number of draws in `draw_cache`.
+        RendererDrawCounts draw_counts;
+        /// Empty if the implementation does not support timestamp queries.
+        std::vector<GPUTimingFrame> gpu_timing_frames;
+        std::size_t gpu_timing_frame_id;
+        GPUTimingHistory render_pass_timings;
+        GPUTimingHistory draw_timings;
     };
 }
 
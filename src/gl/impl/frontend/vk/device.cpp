@@ -1,13 +1,21 @@
 #if TZ_VULKAN
+#include "core/profile.hpp"
 #include "core/tz.hpp"
 #include "gl/impl/frontend/vk/device.hpp"
 #include "gl/impl/backend/vk/tz_vulkan.hpp"
 #include "gl/impl/backend/vk/hardware/device_filter.hpp"
+#include "core/report.hpp"
+#include <fstream>
+#include <iterator>
 
 namespace tz::gl
 {
     DeviceBuilderVulkan::DeviceBuilderVulkan():
-    primitive_type(GraphicsPrimitiveType::Triangles)
+    primitive_type(GraphicsPrimitiveType::Triangles),
+    frames_in_flight(2),
+    swapchain_image_count(0),
+    present_mode(PresentModePreference::DontCare),
+    frame_sync_mode(vk::FrameSyncMode::Fences)
     {
 
     }
@@ -22,6 +30,37 @@ namespace tz::gl
         return this->primitive_type;
     }
 
+    void DeviceBuilderVulkan::set_frames_in_flight(std::size_t frames_in_flight)
+    {
+        tz_assert(frames_in_flight > 0, "DeviceBuilderVulkan::set_frames_in_flight(%zu): Must have at least one frame in flight", frames_in_flight);
+        this->frames_in_flight = frames_in_flight;
+    }
+
+    std::size_t DeviceBuilderVulkan::get_frames_in_flight() const
+    {
+        return this->frames_in_flight;
+    }
+
+    void DeviceBuilderVulkan::set_swapchain_image_count(std::size_t image_count)
+    {
+        this->swapchain_image_count = image_count;
+    }
+
+    std::size_t DeviceBuilderVulkan::get_swapchain_image_count() const
+    {
+        return this->swapchain_image_count;
+    }
+
+    void DeviceBuilderVulkan::set_present_mode(PresentModePreference present_mode)
+    {
+        this->present_mode = present_mode;
+    }
+
+    PresentModePreference DeviceBuilderVulkan::get_present_mode() const
+    {
+        return this->present_mode;
+    }
+
     vk::pipeline::PrimitiveTopology DeviceBuilderVulkan::vk_get_primitive_topology() const
     {
         switch(this->primitive_type)
@@ -36,6 +75,40 @@ namespace tz::gl
         }
     }
 
+    vk::hardware::SwapchainSelectorPreferences DeviceBuilderVulkan::vk_get_swapchain_preferences() const
+    {
+        vk::hardware::SwapchainSelectorPreferences prefs;
+        prefs.format_pref = {vk::hardware::SwapchainFormatPreferences::Goldilocks, vk::hardware::SwapchainFormatPreferences::FlexibleGoldilocks, vk::hardware::SwapchainFormatPreferences::DontCare};
+        // FIFO is always supported, so Vsync is the last resort for every mode.
+        switch(this->present_mode)
+        {
+            case PresentModePreference::DontCare:
+                prefs.present_mode_pref = {vk::hardware::SwapchainPresentModePreferences::PreferTripleBuffering, vk::hardware::SwapchainPresentModePreferences::DontCare};
+            break;
+            case PresentModePreference::Vsync:
+                prefs.present_mode_pref = {vk::hardware::SwapchainPresentModePreferences::PreferVsync, vk::hardware::SwapchainPresentModePreferences::DontCare};
+            break;
+            case PresentModePreference::LowLatency:
+                prefs.present_mode_pref = {vk::hardware::SwapchainPresentModePreferences::PreferTripleBuffering, vk::hardware::SwapchainPresentModePreferences::PreferVsync, vk::hardware::SwapchainPresentModePreferences::DontCare};
+            break;
+            case PresentModePreference::Immediate:
+                prefs.present_mode_pref = {vk::hardware::SwapchainPresentModePreferences::PreferImmediate, vk::hardware::SwapchainPresentModePreferences::PreferTripleBuffering, vk::hardware::SwapchainPresentModePreferences::PreferVsync, vk::hardware::SwapchainPresentModePreferences::DontCare};
+            break;
+        }
+        prefs.image_count = static_cast<std::uint32_t>(this->swapchain_image_count);
+        return prefs;
+    }
+
+    void DeviceBuilderVulkan::vk_set_frame_sync_mode(vk::FrameSyncMode sync_mode)
+    {
+        this->frame_sync_mode = sync_mode;
+    }
+
+    vk::FrameSyncMode DeviceBuilderVulkan::vk_get_frame_sync_mode() const
+    {
+        return this->frame_sync_mode;
+    }
+
     vk::Image::Format DeviceWindowBufferVulkan::get_format() const
     {
         if(vk::is_headless())
@@ -126,6 +199,11 @@ namespace tz::gl
     device(vk::LogicalDevice::null()),
     swapchain(),
     primitive_type(),
+    frame_sync_mode(vk::FrameSyncMode::Fences),
+    frames_in_flight(0),
+    swapchain_preferences(vk::hardware::default_swapchain_preferences),
+    pipeline_cache(vk::PipelineCache::null()),
+    geometry_arena(this->device),
     renderer_resize_callbacks()
     {
         // Setup window resize support.
@@ -146,6 +224,60 @@ namespace tz::gl
         }
     }
 
+    DeviceFunctionalityVulkan::~DeviceFunctionalityVulkan()
+    {
+        if(this->pipeline_cache.is_null())
+        {
+            return;
+        }
+        tz_report("Pipeline Cache: %zu hit%s, %zu miss%s", this->pipeline_cache.get_hit_count(), this->pipeline_cache.get_hit_count() == 1 ? "" : "s", this->pipeline_cache.get_miss_count(), this->pipeline_cache.get_miss_count() == 1 ? "" : "es");
+        if(this->pipeline_cache.get_miss_count() == 0)
+        {
+            // Nothing new was compiled, so what's on disk is already up-to-date.
+            return;
+        }
+        std::vector<std::byte> data = this->pipeline_cache.get_data();
+        std::filesystem::path cache_path = this->get_pipeline_cache_path();
+        std::ofstream cache_file{cache_path, std::ios::binary | std::ios::trunc};
+        if(cache_file.write(reinterpret_cast<const char*>(data.data()), data.size()))
+        {
+            tz_report("Pipeline Cache: Saved %zu bytes to \"%s\"", data.size(), cache_path.string().c_str());
+        }
+        else
+        {
+            tz_warning_report("Pipeline Cache: Failed to save to \"%s\"", cache_path.string().c_str());
+        }
+    }
+
+    void DeviceFunctionalityVulkan::initialise_pipeline_cache()
+    {
+        std::vector<std::byte> initial_data;
+        std::filesystem::path cache_path = this->get_pipeline_cache_path();
+        std::ifstream cache_file{cache_path, std::ios::binary};
+        if(cache_file.is_open())
+        {
+            std::vector<char> file_data{std::istreambuf_iterator<char>{cache_file}, std::istreambuf_iterator<char>{}};
+            initial_data.resize(file_data.size());
+            std::copy(file_data.begin(), file_data.end(), reinterpret_cast<char*>(initial_data.data()));
+            tz_report("Pipeline Cache: Loaded %zu bytes from \"%s\"", initial_data.size(), cache_path.string().c_str());
+        }
+        this->pipeline_cache = vk::PipelineCache{this->device, initial_data};
+    }
+
+    std::filesystem::path DeviceFunctionalityVulkan::get_pipeline_cache_path() const
+    {
+        vk::hardware::DeviceProperties props = this->physical_device.get_properties();
+        std::string file_name = "tz_pipeline_cache_";
+        constexpr char hex_digits[] = "0123456789abcdef";
+        for(std::uint8_t uuid_byte : props.pipelineCacheUUID)
+        {
+            file_name += hex_digits[uuid_byte >> 4];
+            file_name += hex_digits[uuid_byte & 0xF];
+        }
+        file_name += "_" + std::to_string(props.vendorID) + "_" + std::to_string(props.deviceID) + "_" + std::to_string(props.driverVersion) + ".bin";
+        return std::filesystem::temp_directory_path() / file_name;
+    }
+
     RenderPass DeviceFunctionalityVulkan::create_render_pass(RenderPassBuilder builder) const
     {
         builder.vk_finalise(this->swapchain.get_format());
@@ -157,11 +289,16 @@ namespace tz::gl
 
     Renderer DeviceFunctionalityVulkan::create_renderer(RendererBuilder builder) const
     {
+        tz_profile_scope("Device::create_renderer");
         RendererBuilderDeviceInfoVulkan device_info;
         device_info.device = &this->device;
         device_info.primitive_type = this->primitive_type;
+        device_info.frame_sync_mode = this->frame_sync_mode;
+        device_info.frames_in_flight = this->frames_in_flight;
         device_info.device_swapchain = &this->swapchain;
         device_info.on_resize = &this->renderer_resize_callbacks.emplace_back(nullptr);
+        device_info.pipeline_cache = &this->pipeline_cache;
+        device_info.geometry_arena = &this->geometry_arena;
         return {builder, device_info};
     }
 
@@ -200,18 +337,41 @@ namespace tz::gl
             }
         }
         tz_assert(maybe_chosen_queue_family.has_value(), "Valid device found which supports present, graphics and transfer, but not a single queue that can do both. Topaz Vulkan does not support your hardware.");
-        this->device = {maybe_chosen_queue_family.value(), extensions};
+        this->frame_sync_mode = builder.vk_get_frame_sync_mode();
+        if(this->frame_sync_mode == vk::FrameSyncMode::TimelineSemaphore)
+        {
+            if(vk::hardware::DeviceExtensionSupportFilter{{VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME}}.satisfies(this->physical_device))
+            {
+                extensions.add(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+            }
+            else
+            {
+                tz_report("Frame Sync: Timeline semaphores requested but not supported. Falling back to fences.");
+                this->frame_sync_mode = vk::FrameSyncMode::Fences;
+            }
+        }
+        // Uploads go to a dedicated transfer queue if there is one, so they can run alongside rendering. Otherwise they share the graphics queue.
+        std::optional<vk::hardware::DeviceQueueFamily> maybe_transfer_queue_family = vk::hardware::find_dedicated_transfer_queue_family(this->physical_device);
+        this->device = {maybe_chosen_queue_family.value(), extensions, vk::required_rendering_features(), maybe_transfer_queue_family};
+        if(maybe_transfer_queue_family.has_value())
+        {
+            tz_report("Transfer Queue: Dedicated (Queue Family %d)", maybe_transfer_queue_family->index);
+        }
+        else
+        {
+            tz_report("Transfer Queue: Shared with graphics (Queue Family %d)", maybe_chosen_queue_family->index);
+        }
+        this->initialise_pipeline_cache();
+        this->frames_in_flight = builder.get_frames_in_flight();
+        this->swapchain_preferences = builder.vk_get_swapchain_preferences();
         if(vk::is_headless())
         {
             this->swapchain = vk::Image{this->device, 800, 600, vk::Image::Format::Rgba32sRGB, vk::Image::UsageField{vk::Image::Usage::ColourAttachment, vk::Image::Usage::TransferSource}, vk::hardware::MemoryResidency::GPU};
         }
         else
         {
-            vk::hardware::SwapchainSelectorPreferences my_prefs;
-            my_prefs.format_pref = {vk::hardware::SwapchainFormatPreferences::Goldilocks, vk::hardware::SwapchainFormatPreferences::FlexibleGoldilocks, vk::hardware::SwapchainFormatPreferences::DontCare};
-            my_prefs.present_mode_pref = {vk::hardware::SwapchainPresentModePreferences::PreferTripleBuffering, vk::hardware::SwapchainPresentModePreferences::DontCare};
-            
-            this->swapchain = vk::Swapchain{this->device, my_prefs};
+            this->swapchain = vk::Swapchain{this->device, this->swapchain_preferences};
+            tz_report("Swapchain: %zu images, %zu frame%s in flight", static_cast<const vk::Swapchain&>(this->swapchain).get_image_views().size(), this->frames_in_flight, this->frames_in_flight == 1 ? "" : "s");
         }
         
         this->primitive_type = builder.vk_get_primitive_topology();
@@ -223,13 +383,9 @@ namespace tz::gl
         if(!vk::is_headless())
         {
             // First update swapchain.
-            vk::hardware::SwapchainSelectorPreferences my_prefs;
-            my_prefs.format_pref = {vk::hardware::SwapchainFormatPreferences::Goldilocks, vk::hardware::SwapchainFormatPreferences::FlexibleGoldilocks, vk::hardware::SwapchainFormatPreferences::DontCare};
-            my_prefs.present_mode_pref = {vk::hardware::SwapchainPresentModePreferences::PreferTripleBuffering, vk::hardware::SwapchainPresentModePreferences::DontCare};
-
             vk::Swapchain& real_swapchain = std::get<vk::Swapchain>(this->swapchain);
             real_swapchain.~Swapchain();
-            new (&real_swapchain) vk::Swapchain(this->device, my_prefs);
+            new (&real_swapchain) vk::Swapchain(this->device, this->swapchain_preferences);
         }
         // Then notify all renderers which care.
         for(const DeviceWindowResizeCallback& callback : this->renderer_resize_callbacks)
@@ -6,7 +6,11 @@
 #include "gl/impl/backend/vk/logical_device.hpp"
 #include "gl/impl/backend/vk/swapchain.hpp"
 #include "gl/impl/backend/vk/pipeline/input_assembly.hpp"
+#include "gl/impl/backend/vk/pipeline/cache.hpp"
+#include "gl/impl/backend/vk/frame_admin.hpp"
+#include "gl/impl/frontend/vk/geometry_arena.hpp"
 #include <deque>
+#include <filesystem>
 
 namespace tz::gl
 {
@@ -16,10 +20,29 @@ namespace tz::gl
         DeviceBuilderVulkan();
         virtual void set_primitive_type(GraphicsPrimitiveType type) final;
         virtual GraphicsPrimitiveType get_primitive_type() const final;
+        virtual void set_frames_in_flight(std::size_t frames_in_flight) final;
+        virtual std::size_t get_frames_in_flight() const final;
+        virtual void set_swapchain_image_count(std::size_t image_count) final;
+        virtual std::size_t get_swapchain_image_count() const final;
+        virtual void set_present_mode(PresentModePreference present_mode) final;
+        virtual PresentModePreference get_present_mode() const final;
         
         vk::pipeline::PrimitiveTopology vk_get_primitive_topology() const;
+        /**
+         * @brief Retrieve the swapchain preferences corresponding to the requested present mode and swapchain image count.
+         */
+        vk::hardware::SwapchainSelectorPreferences vk_get_swapchain_preferences() const;
+        /**
+         * @brief Choose how renderers keep track of frames in flight. If timeline semaphores are requested but the hardware does not support them, fences are used instead.
+         */
+        void vk_set_frame_sync_mode(vk::FrameSyncMode sync_mode);
+        vk::FrameSyncMode vk_get_frame_sync_mode() const;
     private:
         GraphicsPrimitiveType primitive_type;
+        std::size_t frames_in_flight;
+        std::size_t swapchain_image_count;
+        PresentModePreference present_mode;
+        vk::FrameSyncMode frame_sync_mode;
     };
 
     class DeviceWindowBufferVulkan : public std::variant<std::monostate, vk::Swapchain, vk::Image>
@@ -48,13 +71,30 @@ namespace tz::gl
         [[nodiscard]] virtual Shader create_shader(ShaderBuilder builder) const final;
     protected:
         DeviceFunctionalityVulkan();
+        /// Writes the pipeline cache to disk, so the next run of the program can skip most pipeline compilation.
+        ~DeviceFunctionalityVulkan();
+        /**
+         * @brief Create the pipeline cache, loading it from disk if this device and driver have been used before.
+         * @pre `device` must have been initialised.
+         */
+        void initialise_pipeline_cache();
         
         vk::hardware::Device physical_device;
         vk::LogicalDevice device;
         DeviceWindowBufferVulkan swapchain;
         vk::pipeline::PrimitiveTopology primitive_type;
+        vk::FrameSyncMode frame_sync_mode;
+        std::size_t frames_in_flight;
+        /// Used whenever the swapchain is (re)created.
+        vk::hardware::SwapchainSelectorPreferences swapchain_preferences;
+        /// Shared by all renderers created by this device. Must be destroyed before `device`.
+        mutable vk::PipelineCache pipeline_cache;
+        /// Static geometry of all renderers created by this device. Must be destroyed before `device`.
+        mutable GeometryArenaVulkan geometry_arena;
     private:
         void on_window_resize();
+        /// Pipeline cache data is only valid for the same device and driver, so the path is unique to both.
+        std::filesystem::path get_pipeline_cache_path() const;
 
         mutable std::deque<DeviceWindowResizeCallback> renderer_resize_callbacks;
     };
@@ -0,0 +1,57 @@
+#if TZ_VULKAN
+#include "core/report.hpp"
+#include "gl/impl/frontend/vk/geometry_arena.hpp"
+
+namespace tz::gl
+{
+    GeometryArenaVulkan::GeometryArenaVulkan(const vk::LogicalDevice& device):
+    device(&device),
+    allocator(vertex_page_size, index_page_size),
+    pages()
+    {}
+
+    GeometryArenaAllocation GeometryArenaVulkan::allocate(std::size_t vertex_bytes, std::size_t vertex_stride, std::size_t index_bytes)
+    {
+        GeometryArenaAllocation allocation = this->allocator.allocate(vertex_bytes, vertex_stride, index_bytes);
+        while(this->pages.size() < this->allocator.get_page_count())
+        {
+            std::size_t page_id = this->pages.size();
+            std::size_t vertex_capacity = this->allocator.get_vertex_page_capacity(page_id);
+            std::size_t index_capacity = this->allocator.get_index_page_capacity(page_id);
+            this->pages.push_back
+            ({
+                .vertex_buffer = vk::Buffer{vk::BufferType::Vertex, vk::BufferPurpose::TransferDestination, *this->device, vk::hardware::MemoryResidency::GPU, vertex_capacity},
+                .index_buffer = vk::Buffer{vk::BufferType::Index, vk::BufferPurpose::TransferDestination, *this->device, vk::hardware::MemoryResidency::GPU, index_capacity}
+            });
+            tz_report("Geometry Arena Page %zu (VB %zu bytes, IB %zu bytes)", page_id, vertex_capacity, index_capacity);
+        }
+        return allocation;
+    }
+
+    void GeometryArenaVulkan::free(const GeometryArenaAllocation& allocation)
+    {
+        this->allocator.free(allocation);
+    }
+
+    const vk::Buffer& GeometryArenaVulkan::get_vertex_buffer(std::size_t page_id) const
+    {
+        return this->pages[page_id].vertex_buffer;
+    }
+
+    vk::Buffer& GeometryArenaVulkan::get_vertex_buffer(std::size_t page_id)
+    {
+        return this->pages[page_id].vertex_buffer;
+    }
+
+    const vk::Buffer& GeometryArenaVulkan::get_index_buffer(std::size_t page_id) const
+    {
+        return this->pages[page_id].index_buffer;
+    }
+
+    vk::Buffer& GeometryArenaVulkan::get_index_buffer(std::size_t page_id)
+    {
+        return this->pages[page_id].index_buffer;
+    }
+}
+
+#endif // TZ_VULKAN
@@ -0,0 +1,50 @@
+#ifndef TOPAZ_GL_IMPL_VK_GEOMETRY_ARENA_HPP
+#define TOPAZ_GL_IMPL_VK_GEOMETRY_ARENA_HPP
+#if TZ_VULKAN
+#include "gl/impl/frontend/common/geometry_arena.hpp"
+#include "gl/impl/backend/vk/buffer.hpp"
+#include "gl/impl/backend/vk/logical_device.hpp"
+
+namespace tz::gl
+{
+    /**
+     * @brief Device-wide storage for static geometry. Renderers sub-allocate from large shared vertex/index buffers instead of each making their own.
+     */
+    class GeometryArenaVulkan
+    {
+    public:
+        constexpr static std::size_t vertex_page_size = 16 * 1024 * 1024;
+        constexpr static std::size_t index_page_size = 4 * 1024 * 1024;
+        /**
+         * @param device Device which will own the buffers. It need not be initialised yet, so long as it is by the time anything is allocated.
+         */
+        GeometryArenaVulkan(const vk::LogicalDevice& device);
+        /**
+         * @brief Find room for some geometry, creating new buffers if no existing page has room.
+         * @note The vertex and index buffers of each page are GPU-resident, so data must be copied into them via a transfer command.
+         */
+        GeometryArenaAllocation allocate(std::size_t vertex_bytes, std::size_t vertex_stride, std::size_t index_bytes);
+        /**
+         * @brief Return geometry to the arena, so its ranges can be reused by a future allocation.
+         * @pre The GPU must no longer be reading from the allocation.
+         */
+        void free(const GeometryArenaAllocation& allocation);
+        const vk::Buffer& get_vertex_buffer(std::size_t page_id) const;
+        vk::Buffer& get_vertex_buffer(std::size_t page_id);
+        const vk::Buffer& get_index_buffer(std::size_t page_id) const;
+        vk::Buffer& get_index_buffer(std::size_t page_id);
+    private:
+        struct Page
+        {
+            vk::Buffer vertex_buffer;
+            vk::Buffer index_buffer;
+        };
+
+        const vk::LogicalDevice* device;
+        GeometryArenaAllocator allocator;
+        std::vector<Page> pages;
+    };
+}
+
+#endif // TZ_VULKAN
+#endif // TOPAZ_GL_IMPL_VK_GEOMETRY_ARENA_HPP
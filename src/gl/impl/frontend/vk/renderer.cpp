@@ -1,17 +1,22 @@
 #if TZ_VULKAN
+#include "core/profile.hpp"
 #include "core/report.hpp"
 #include "gl/impl/frontend/vk/renderer.hpp"
 #include "gl/impl/frontend/vk/device.hpp"
 #include "gl/impl/backend/vk/tz_vulkan.hpp"
 #include "gl/impl/backend/vk/fence.hpp"
 #include "gl/impl/backend/vk/submit.hpp"
+#include <algorithm>
+#include <memory>
 #include <numeric>
 #include <ranges>
+#include <chrono>
+#include <utility>
+#include <thread>
 
 namespace tz::gl
 {
-   using DrawIndirectCommand = VkDrawIndexedIndirectCommand;
-
+    static_assert(sizeof(DrawIndirectCommand) == sizeof(VkDrawIndexedIndirectCommand), "tz::gl::DrawIndirectCommand must match the layout of VkDrawIndexedIndirectCommand");
     RendererInputHandle RendererBuilderVulkan::add_input(const IRendererInput& input)
     {
         auto sz = this->inputs.size();
@@ -66,6 +71,16 @@ namespace tz::gl
         return this->culling_strategy;
     }
 
+    void RendererBuilderVulkan::set_dynamic_data_mode(RendererDynamicDataMode dynamic_data_mode)
+    {
+        this->dynamic_data_mode = dynamic_data_mode;
+    }
+
+    RendererDynamicDataMode RendererBuilderVulkan::get_dynamic_data_mode() const
+    {
+        return this->dynamic_data_mode;
+    }
+
     void RendererBuilderVulkan::set_render_pass(const RenderPass& render_pass)
     {
         this->render_pass = &render_pass;
@@ -204,20 +219,13 @@ namespace tz::gl
     input_assembly(device_info.primitive_type),
     rasteriser_state(builder.vk_get_rasteriser_state()),
     swapchain(device_info.device_swapchain),
+    pipeline_cache(device_info.pipeline_cache),
     resource_descriptor_layout(builder.vk_get_descriptor_set_layout(*this->device)),
     layout(*this->device, vk::DescriptorSetLayoutRefs{this->resource_descriptor_layout}),
     graphics_pipeline(this->create_pipeline())
     {
     }
 
-    void RendererPipelineManagerVulkan::reconstruct_pipeline()
-    {
-        // Assume swapchain has been reinitialised by the device.
-        // Assume render_pass has been reinitialised by the device.
-        // Recreate everything else.
-        this->graphics_pipeline = this->create_pipeline();
-    }
-
     const vk::GraphicsPipeline& RendererPipelineManagerVulkan::get_pipeline() const
     {
         return this->graphics_pipeline;
@@ -233,47 +241,86 @@ namespace tz::gl
         return this->layout;
     }
 
-    vk::GraphicsPipeline RendererPipelineManagerVulkan::create_pipeline() const
+    vk::pipeline::ViewportState RendererPipelineManagerVulkan::get_viewport_state() const
     {
-        auto make_viewport_state = [this]()
+        if(vk::is_headless())
         {
-            if(vk::is_headless())
-            {
-                const auto& as_image = static_cast<const vk::Image&>(*this->swapchain);
-                return vk::pipeline::ViewportState{as_image, true};
-            }
-            else
-            {
-                const auto& as_swapchain = static_cast<const vk::Swapchain&>(*this->swapchain);
-                return vk::pipeline::ViewportState{as_swapchain, true};
-            }
-        };
+            const auto& as_image = static_cast<const vk::Image&>(*this->swapchain);
+            return vk::pipeline::ViewportState{as_image, true};
+        }
+        else
+        {
+            const auto& as_swapchain = static_cast<const vk::Swapchain&>(*this->swapchain);
+            return vk::pipeline::ViewportState{as_swapchain, true};
+        }
+    }
+
+    vk::GraphicsPipeline RendererPipelineManagerVulkan::create_pipeline() const
+    {
         return vk::GraphicsPipeline
         {
             {vk::pipeline::ShaderStage{*this->vertex_shader, vk::pipeline::ShaderType::Vertex}, vk::pipeline::ShaderStage{*this->fragment_shader, vk::pipeline::ShaderType::Fragment}},
             *this->device,
             this->vertex_input_state,
             this->input_assembly,
-            make_viewport_state(),
+            this->get_viewport_state(),
             this->rasteriser_state,
             vk::pipeline::MultisampleState{},
             vk::pipeline::ColourBlendState{},
-            vk::pipeline::DynamicState::None(),
+            // Viewport and scissor are set when recording, so the pipeline survives a resize.
+            vk::pipeline::DynamicState::ViewportScissor(),
             this->layout,
-            this->render_pass->vk_get_render_pass()
+            this->render_pass->vk_get_render_pass(),
+            this->pipeline_cache
         };
     }
 
-    RendererBufferManagerVulkan::RendererBufferManagerVulkan(RendererBuilderDeviceInfoVulkan device_info, std::vector<IRendererInput*> renderer_inputs):
+    RendererBufferManagerVulkan::RendererBufferManagerVulkan(RendererBuilderDeviceInfoVulkan device_info, std::vector<IRendererInput*> renderer_inputs, RendererDynamicDataMode dynamic_data_mode):
     device(device_info.device),
     physical_device(this->device->get_queue_family().dev),
     inputs(renderer_inputs),
-    vertex_buffer(vk::Buffer::null()),
+    dynamic_data_mode(dynamic_data_mode),
+    slice_count(1),
+    geometry_arena(device_info.geometry_arena),
+    static_geometry(std::nullopt),
     dynamic_vertex_buffer(vk::Buffer::null()),
-    index_buffer(vk::Buffer::null()),
     dynamic_index_buffer(vk::Buffer::null()),
+    dynamic_vertex_slice_stride(0),
+    dynamic_index_slice_stride(0),
+    dynamic_vertex_ring(std::nullopt),
+    dynamic_index_ring(std::nullopt),
+    dynamic_vertex_regions(),
+    published_ranges(),
     buffer_components()
     {
+        // One slice per view, as each view has its own command buffer which always reads from the same slice.
+        if(vk::is_headless())
+        {
+            this->slice_count = device_info.frames_in_flight;
+        }
+        else
+        {
+            this->slice_count = static_cast<const vk::Swapchain&>(*device_info.device_swapchain).get_image_views().size();
+        }
+    }
+
+    RendererBufferManagerVulkan::~RendererBufferManagerVulkan()
+    {
+        tz_assert(!this->static_geometry.has_value(), "RendererBufferManagerVulkan: Static geometry was never released. Call release_static_geometry before destroying the buffer manager.");
+    }
+
+    void RendererBufferManagerVulkan::release_static_geometry(vk::DeletionQueue& deletion_queue, std::uint64_t last_used_frame)
+    {
+        if(!this->static_geometry.has_value())
+        {
+            return;
+        }
+        // Another renderer could be given this space straight away, so it only goes back to the arena once the GPU is done reading it.
+        deletion_queue.defer(vk::DeferredAction{[arena = this->geometry_arena, allocation = this->static_geometry.value()]()
+        {
+            arena->free(allocation);
+        }}, last_used_frame);
+        this->static_geometry = std::nullopt;
     }
 
     void RendererBufferManagerVulkan::initialise_resources(std::vector<IResource*> renderer_buffer_resources)
@@ -292,6 +339,11 @@ namespace tz::gl
             std::size_t offset;
             std::size_t length;
         };
+        // Alignments are always a power of two.
+        auto align_up = [](std::size_t value, std::size_t alignment)
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        };
 
         if(!this->inputs.empty())
         {
@@ -338,31 +390,58 @@ namespace tz::gl
             }
 
             // Step 2: Fill buffers and map properly.
-            if(any_static_geometry)
+            if(any_static_geometry && !static_indices.empty())
             {
-                this->vertex_buffer = vk::Buffer{vk::BufferType::Vertex, vk::BufferPurpose::TransferDestination, *this->device, vk::hardware::MemoryResidency::GPU, static_vertex_bytes.size()};
-                tz_report("VB Static (%zu vertices, %zu bytes total)", static_vertex_bytes.size() / fmt.binding_size, static_vertex_bytes.size());
-                this->index_buffer = vk::Buffer{vk::BufferType::Index, vk::BufferPurpose::TransferDestination, *this->device, vk::hardware::MemoryResidency::GPU, static_indices.size() * sizeof(unsigned int)};
-                tz_report("IB Static (%zu indices, %zu bytes total)", static_indices.size(), static_indices.size() * sizeof(unsigned int));
+                // Static geometry lives in buffers shared by every renderer on the device. The data itself is uploaded later alongside the other static data.
+                this->static_geometry = this->geometry_arena->allocate(static_vertex_bytes.size(), fmt.binding_size, static_indices.size() * sizeof(unsigned int));
+                tz_report("VB Static (%zu vertices, %zu bytes total, arena page %zu)", static_vertex_bytes.size() / fmt.binding_size, static_vertex_bytes.size(), this->static_geometry->page_id);
+                tz_report("IB Static (%zu indices, %zu bytes total, arena page %zu)", static_indices.size(), static_indices.size() * sizeof(unsigned int), this->static_geometry->page_id);
             }
             if(any_dynamic_geometry)
             {
-                this->dynamic_vertex_buffer = vk::Buffer{vk::BufferType::Vertex, vk::BufferPurpose::NothingSpecial, *this->device, vk::hardware::MemoryResidency::CPUPersistent, dynamic_vertex_bytes.size()};
-                tz_report("VB Dynamic (%zu vertices, %zu bytes total)", dynamic_vertex_bytes.size() / fmt.binding_size, dynamic_vertex_bytes.size());
-                this->dynamic_index_buffer = vk::Buffer{vk::BufferType::Index, vk::BufferPurpose::NothingSpecial, *this->device, vk::hardware::MemoryResidency::CPUPersistent, dynamic_indices.size() * sizeof(unsigned int)};
-                tz_report("IB Dynamic (%zu indices, %zu bytes total)", dynamic_indices.size(), dynamic_indices.size() * sizeof(unsigned int));
+                std::size_t dynamic_index_bytes = dynamic_indices.size() * sizeof(unsigned int);
+                std::byte* vtx_mem;
+                unsigned int* idx_mem;
+                if(this->dynamic_data_mode == RendererDynamicDataMode::FrameRing)
+                {
+                    // Each view reads its own slice. Inputs write to the ring's host memory, which is copied into a view's slice just before it is next submitted.
+                    constexpr std::size_t slice_alignment = 16;
+                    this->dynamic_vertex_slice_stride = align_up(dynamic_vertex_bytes.size(), slice_alignment);
+                    this->dynamic_index_slice_stride = align_up(dynamic_index_bytes, slice_alignment);
+                    this->dynamic_vertex_buffer = vk::Buffer{vk::BufferType::Vertex, vk::BufferPurpose::NothingSpecial, *this->device, vk::hardware::MemoryResidency::CPUPersistent, this->dynamic_vertex_slice_stride * this->slice_count};
+                    this->dynamic_index_buffer = vk::Buffer{vk::BufferType::Index, vk::BufferPurpose::NothingSpecial, *this->device, vk::hardware::MemoryResidency::CPUPersistent, this->dynamic_index_slice_stride * this->slice_count};
+                    this->dynamic_vertex_ring = RendererFrameRing{dynamic_vertex_bytes, this->slice_count};
+                    this->dynamic_index_ring = RendererFrameRing{std::as_bytes(std::span<const unsigned int>{dynamic_indices}), this->slice_count};
+                    vtx_mem = this->dynamic_vertex_ring->data().data();
+                    idx_mem = reinterpret_cast<unsigned int*>(this->dynamic_index_ring->data().data());
+                }
+                else
+                {
+                    this->dynamic_vertex_buffer = vk::Buffer{vk::BufferType::Vertex, vk::BufferPurpose::NothingSpecial, *this->device, vk::hardware::MemoryResidency::CPUPersistent, dynamic_vertex_bytes.size()};
+                    this->dynamic_index_buffer = vk::Buffer{vk::BufferType::Index, vk::BufferPurpose::NothingSpecial, *this->device, vk::hardware::MemoryResidency::CPUPersistent, dynamic_index_bytes};
+                    vtx_mem = static_cast<std::byte*>(this->dynamic_vertex_buffer.map_memory());
+                    idx_mem = static_cast<unsigned int*>(this->dynamic_index_buffer.map_memory());
+                }
+                std::size_t dynamic_copies = this->dynamic_vertex_ring.has_value() ? this->slice_count : 1;
+                tz_report("VB Dynamic (%zu vertices, %zu bytes total, %zu cop%s)", dynamic_vertex_bytes.size() / fmt.binding_size, dynamic_vertex_bytes.size(), dynamic_copies, dynamic_copies == 1 ? "y" : "ies");
+                tz_report("IB Dynamic (%zu indices, %zu bytes total, %zu cop%s)", dynamic_indices.size(), dynamic_index_bytes, dynamic_copies, dynamic_copies == 1 ? "y" : "ies");
 
-                std::byte* vtx_mem = static_cast<std::byte*>(this->dynamic_vertex_buffer.map_memory());
                 for(const auto& vertex_region : vertex_regions)
                 {
                     vertex_region.input.set_vertex_data(vtx_mem + vertex_region.offset);
+                    this->dynamic_vertex_regions.push_back({.input = &vertex_region.input, .offset = vertex_region.offset, .length = vertex_region.length});
                 }
 
-                unsigned int* idx_mem = static_cast<unsigned int*>(this->dynamic_index_buffer.map_memory());
                 for(const auto& index_region : index_regions)
                 {
                     index_region.input.set_index_data(idx_mem + index_region.offset);
                 }
+                if(this->dynamic_data_mode == RendererDynamicDataMode::DirectMapped)
+                {
+                    // Initial data was just written into the buffers directly.
+                    this->dynamic_vertex_buffer.flush(0, VK_WHOLE_SIZE);
+                    this->dynamic_index_buffer.flush(0, VK_WHOLE_SIZE);
+                }
             }
         }
 
@@ -377,8 +456,22 @@ namespace tz::gl
                 case RendererInputDataAccess::DynamicFixed:
                     {
                         auto& dynamic_resource = static_cast<IDynamicResource&>(*buffer_resource);
-                        buffer_component.buffer = vk::Buffer{vk::BufferType::Uniform, vk::BufferPurpose::NothingSpecial, *this->device, vk::hardware::MemoryResidency::CPUPersistent, dynamic_resource.get_resource_bytes().size_bytes()};
-                        dynamic_resource.set_resource_data(static_cast<std::byte*>(buffer_component.buffer.map_memory()));
+                        std::size_t resource_size = dynamic_resource.get_resource_bytes().size_bytes();
+                        if(this->dynamic_data_mode == RendererDynamicDataMode::FrameRing)
+                        {
+                            // Each view's descriptor set points at its own slice, so slices must respect the uniform buffer offset alignment.
+                            std::size_t slice_alignment = this->physical_device->get_properties().limits.minUniformBufferOffsetAlignment;
+                            buffer_component.slice_stride = align_up(resource_size, std::max<std::size_t>(slice_alignment, 1));
+                            buffer_component.buffer = vk::Buffer{vk::BufferType::Uniform, vk::BufferPurpose::NothingSpecial, *this->device, vk::hardware::MemoryResidency::CPUPersistent, buffer_component.slice_stride * this->slice_count};
+                            buffer_component.frame_ring = RendererFrameRing{dynamic_resource.get_resource_bytes(), this->slice_count};
+                            dynamic_resource.set_resource_data(buffer_component.frame_ring->data().data());
+                        }
+                        else
+                        {
+                            buffer_component.buffer = vk::Buffer{vk::BufferType::Uniform, vk::BufferPurpose::NothingSpecial, *this->device, vk::hardware::MemoryResidency::CPUPersistent, resource_size};
+                            dynamic_resource.set_resource_data(static_cast<std::byte*>(buffer_component.buffer.map_memory()));
+                            buffer_component.buffer.flush(0, VK_WHOLE_SIZE);
+                        }
                     }
                 break;
                 default:
@@ -388,24 +481,33 @@ namespace tz::gl
         }
     }
 
+    const std::optional<GeometryArenaAllocation>& RendererBufferManagerVulkan::get_static_geometry() const
+    {
+        return this->static_geometry;
+    }
+
     const vk::Buffer& RendererBufferManagerVulkan::get_vertex_buffer() const
     {
-        return this->vertex_buffer;
+        tz_assert(this->static_geometry.has_value(), "RendererBufferManagerVulkan has no static geometry, so has no vertex buffer.");
+        return this->geometry_arena->get_vertex_buffer(this->static_geometry->page_id);
     }
 
     vk::Buffer& RendererBufferManagerVulkan::get_vertex_buffer()
     {
-        return this->vertex_buffer;
+        tz_assert(this->static_geometry.has_value(), "RendererBufferManagerVulkan has no static geometry, so has no vertex buffer.");
+        return this->geometry_arena->get_vertex_buffer(this->static_geometry->page_id);
     }
 
     const vk::Buffer& RendererBufferManagerVulkan::get_index_buffer() const
     {
-        return this->index_buffer;
+        tz_assert(this->static_geometry.has_value(), "RendererBufferManagerVulkan has no static geometry, so has no index buffer.");
+        return this->geometry_arena->get_index_buffer(this->static_geometry->page_id);
     }
 
     vk::Buffer& RendererBufferManagerVulkan::get_index_buffer()
     {
-        return this->index_buffer;
+        tz_assert(this->static_geometry.has_value(), "RendererBufferManagerVulkan has no static geometry, so has no index buffer.");
+        return this->geometry_arena->get_index_buffer(this->static_geometry->page_id);
     }
 
     const vk::Buffer& RendererBufferManagerVulkan::get_dynamic_vertex_buffer() const
@@ -428,6 +530,102 @@ namespace tz::gl
         return this->dynamic_index_buffer;
     }
 
+    std::size_t RendererBufferManagerVulkan::get_dynamic_vertex_offset(std::size_t view_id) const
+    {
+        return this->dynamic_vertex_slice_stride * view_id;
+    }
+
+    std::size_t RendererBufferManagerVulkan::get_dynamic_index_offset(std::size_t view_id) const
+    {
+        return this->dynamic_index_slice_stride * view_id;
+    }
+
+    void RendererBufferManagerVulkan::publish_dynamic_data(std::size_t view_id)
+    {
+        if(this->dynamic_data_mode == RendererDynamicDataMode::FrameRing)
+        {
+            // Tell the rings what's changed. Data whose owner has never marked anything dirty has to be compared against what it looked like last time.
+            auto report_changes = [](RendererFrameRing& ring, DirtyRangeList& dirty_ranges, std::size_t region_offset, std::size_t region_length)
+            {
+                if(dirty_ranges.is_explicit())
+                {
+                    for(const DirtyRange& range : dirty_ranges.get_ranges())
+                    {
+                        ring.mark_dirty(region_offset + range.offset, range.length);
+                    }
+                }
+                else
+                {
+                    ring.detect_changes(region_offset, region_length);
+                }
+                dirty_ranges.clear();
+            };
+            // Then copy everything this view hasn't seen yet into its slice, and flush only what was copied.
+            auto publish = [this, view_id](RendererFrameRing& ring, vk::Buffer& buffer, std::size_t slice_stride)
+            {
+                std::size_t slice_offset = slice_stride * view_id;
+                auto* slice_begin = static_cast<std::byte*>(buffer.map_memory()) + slice_offset;
+                this->published_ranges.clear();
+                ring.publish(view_id, {slice_begin, ring.size()}, &this->published_ranges);
+                for(const DirtyRange& range : this->published_ranges.get_ranges())
+                {
+                    buffer.flush(slice_offset + range.offset, range.length);
+                }
+            };
+
+            if(this->dynamic_vertex_ring.has_value())
+            {
+                for(DynamicInputRegion& region : this->dynamic_vertex_regions)
+                {
+                    report_changes(this->dynamic_vertex_ring.value(), region.input->dirty_ranges, region.offset, region.length);
+                }
+                publish(this->dynamic_vertex_ring.value(), this->dynamic_vertex_buffer, this->dynamic_vertex_slice_stride);
+                // Index data can't be changed after construction, so this only ever copies on the first publish.
+                publish(this->dynamic_index_ring.value(), this->dynamic_index_buffer, this->dynamic_index_slice_stride);
+            }
+            for(BufferComponentVulkan& buffer_component : this->buffer_components)
+            {
+                if(buffer_component.frame_ring.has_value())
+                {
+                    auto& dynamic_resource = static_cast<IDynamicResource&>(*buffer_component.resource);
+                    report_changes(buffer_component.frame_ring.value(), dynamic_resource.dirty_ranges, 0, buffer_component.frame_ring->size());
+                    publish(buffer_component.frame_ring.value(), buffer_component.buffer, buffer_component.slice_stride);
+                }
+            }
+        }
+        else
+        {
+            // Data is written directly into the buffers, so just flush the changed ranges. This is free if the memory is host-coherent.
+            auto flush_changes = [](vk::Buffer& buffer, DirtyRangeList& dirty_ranges, std::size_t region_offset, std::size_t region_length)
+            {
+                if(dirty_ranges.is_explicit())
+                {
+                    for(const DirtyRange& range : dirty_ranges.get_ranges())
+                    {
+                        buffer.flush(region_offset + range.offset, range.length);
+                    }
+                }
+                else if(region_length > 0)
+                {
+                    buffer.flush(region_offset, region_length);
+                }
+                dirty_ranges.clear();
+            };
+            for(DynamicInputRegion& region : this->dynamic_vertex_regions)
+            {
+                flush_changes(this->dynamic_vertex_buffer, region.input->dirty_ranges, region.offset, region.length);
+            }
+            for(BufferComponentVulkan& buffer_component : this->buffer_components)
+            {
+                if(buffer_component.resource->data_access() == RendererInputDataAccess::DynamicFixed)
+                {
+                    auto& dynamic_resource = static_cast<IDynamicResource&>(*buffer_component.resource);
+                    flush_changes(buffer_component.buffer, dynamic_resource.dirty_ranges, 0, dynamic_resource.get_resource_bytes().size_bytes());
+                }
+            }
+        }
+    }
+
     std::span<const BufferComponentVulkan> RendererBufferManagerVulkan::get_buffer_components() const
     {
         return this->buffer_components;
@@ -443,7 +641,9 @@ namespace tz::gl
     physical_device(this->device->get_queue_family().dev),
     render_pass(&builder.get_render_pass()),
     swapchain(device_info.device_swapchain),
-    maybe_swapchain_offscreen_imageview(std::nullopt),
+    frames_in_flight(device_info.frames_in_flight),
+    offscreen_images(),
+    offscreen_imageviews(),
     texture_components(),
     depth_image(std::nullopt),
     depth_imageview(std::nullopt),
@@ -451,8 +651,16 @@ namespace tz::gl
     {
         if(vk::is_headless())
         {
-            this->swapchain_framebuffers.reserve(1);
-            this->maybe_swapchain_offscreen_imageview = vk::ImageView{*this->device, static_cast<const vk::Image&>(*this->swapchain)};
+            this->swapchain_framebuffers.reserve(this->frames_in_flight);
+            // The device's offscreen image only describes the output. Each frame in flight gets its own image like it, so frames can overlap.
+            const auto& device_offscreen_image = static_cast<const vk::Image&>(*this->swapchain);
+            this->offscreen_images.reserve(this->frames_in_flight);
+            this->offscreen_imageviews.reserve(this->frames_in_flight);
+            for(std::size_t i = 0; i < this->frames_in_flight; i++)
+            {
+                vk::Image& offscreen_image = this->offscreen_images.emplace_back(*this->device, device_offscreen_image.get_width(), device_offscreen_image.get_height(), device_offscreen_image.get_format(), vk::Image::UsageField{vk::Image::Usage::ColourAttachment, vk::Image::Usage::TransferSource}, vk::hardware::MemoryResidency::GPU);
+                this->offscreen_imageviews.emplace_back(*this->device, offscreen_image);
+            }
         }
         else
         {
@@ -534,28 +742,41 @@ namespace tz::gl
         }
     }
 
-    void RendererImageManagerVulkan::setup_depth_image()
+    void RendererImageManagerVulkan::setup_depth_image(vk::DeletionQueue& deletion_queue, std::uint64_t last_used_frame)
     {
+        // Frames still in flight may be rendering into the old depth image. The view must go before the image it views.
+        if(this->depth_imageview.has_value())
+        {
+            deletion_queue.defer(std::move(this->depth_imageview.value()), last_used_frame);
+            deletion_queue.defer(std::move(this->depth_image.value()), last_used_frame);
+        }
         auto swapchain_width = static_cast<std::uint32_t>(this->swapchain->get_width());
         auto swapchain_height = static_cast<std::uint32_t>(this->swapchain->get_height());
         this->depth_image = vk::Image{*this->device, swapchain_width, swapchain_height, vk::Image::Format::DepthFloat32, {vk::Image::Usage::DepthStencilAttachment}, vk::hardware::MemoryResidency::GPU};
         this->depth_imageview = vk::ImageView{*this->device, this->depth_image.value()};
     }
 
-    void RendererImageManagerVulkan::setup_swapchain_framebuffers()
+    void RendererImageManagerVulkan::setup_swapchain_framebuffers(vk::DeletionQueue& deletion_queue, std::uint64_t last_used_frame)
     {
+        for(vk::Framebuffer& framebuffer : this->swapchain_framebuffers)
+        {
+            deletion_queue.defer(std::move(framebuffer), last_used_frame);
+        }
         this->swapchain_framebuffers.clear();
         auto swapchain_width = static_cast<std::uint32_t>(this->swapchain->get_width());
         auto swapchain_height = static_cast<std::uint32_t>(this->swapchain->get_height());
         if(vk::is_headless())
         {
-            if(this->depth_imageview.has_value())
-            {
-                this->swapchain_framebuffers.emplace_back(this->render_pass->vk_get_render_pass(), this->maybe_swapchain_offscreen_imageview.value(), this->depth_imageview.value(), VkExtent2D(swapchain_width, swapchain_height));
-            }
-            else
+            for(std::size_t i = 0; i < this->frames_in_flight; i++)
             {
-                this->swapchain_framebuffers.emplace_back(this->render_pass->vk_get_render_pass(), this->maybe_swapchain_offscreen_imageview.value(), VkExtent2D(swapchain_width, swapchain_height));
+                if(this->depth_imageview.has_value())
+                {
+                    this->swapchain_framebuffers.emplace_back(this->render_pass->vk_get_render_pass(), this->offscreen_imageviews[i], this->depth_imageview.value(), VkExtent2D(swapchain_width, swapchain_height));
+                }
+                else
+                {
+                    this->swapchain_framebuffers.emplace_back(this->render_pass->vk_get_render_pass(), this->offscreen_imageviews[i], VkExtent2D(swapchain_width, swapchain_height));
+                }
             }
         }
         else
@@ -581,6 +802,11 @@ namespace tz::gl
         return this->swapchain_framebuffers;
     }
 
+    std::span<const vk::Image> RendererImageManagerVulkan::get_offscreen_images() const
+    {
+        return this->offscreen_images;
+    }
+
     std::span<const TextureComponentVulkan> RendererImageManagerVulkan::get_texture_components() const
     {
         return this->texture_components;
@@ -596,16 +822,43 @@ namespace tz::gl
     physical_device(this->device->get_queue_family().dev),
     render_pass(&builder.get_render_pass()),
     swapchain(device_info.device_swapchain),
+    frames_in_flight(device_info.frames_in_flight),
     inputs(inputs),
     resource_descriptor_pool(std::nullopt),
     command_pool(*this->device, this->device->get_queue_family(), vk::CommandPool::RecycleBuffer),
+    worker_command_pools(),
+    recording_workers(std::nullopt),
     graphics_present_queue(this->device->get_hardware_queue()),
-    draw_indirect_buffer{this->num_static_inputs() > 0 ? std::optional<vk::Buffer>{vk::Buffer{vk::BufferType::DrawIndirect, vk::BufferPurpose::TransferDestination, *this->device, vk::hardware::MemoryResidency::GPU, sizeof(DrawIndirectCommand) * this->num_static_inputs()}} : std::nullopt},
-    draw_indirect_dynamic_buffer{this->num_dynamic_inputs() > 0 ? std::optional<vk::Buffer>{vk::Buffer{vk::BufferType::DrawIndirect, vk::BufferPurpose::TransferDestination, *this->device, vk::hardware::MemoryResidency::GPU, sizeof(DrawIndirectCommand) * this->num_dynamic_inputs()}} : std::nullopt},
-    frame_admin(*this->device, vk::is_headless() ? 1 : RendererVulkan::frames_in_flight)
+    transfer_command_pool(*this->device, this->device->get_transfer_queue_family(), vk::CommandPool::RecycleBuffer),
+    transfer_queue(this->device->get_transfer_queue()),
+    pending_upload(std::nullopt),
+    offscreen_readbacks(),
+    draw_table(builder.vk_get_inputs()),
+    view_draw_states(),
+    draw_commands(),
+    draw_counts(),
+    draw_version(0),
+    draw_cache(),
+    timestamp_queries(std::nullopt),
+    view_timings_pending(),
+    render_pass_timings(),
+    draw_timings(),
+    deletion_queue(),
+    frame_admin(*this->device, this->frames_in_flight, device_info.frame_sync_mode)
     {
         // Now the command pool
         this->initialise_command_pool();
+        this->transfer_command_pool.with(1);
+        if(vk::is_headless())
+        {
+            const auto& offscreen_image = static_cast<const vk::Image&>(*this->swapchain);
+            tz_assert(offscreen_image.get_format() == vk::Image::Format::Rgba32sRGB, "RendererProcessorVulkan: Offscreen readback only supports 32-bit RGBA output");
+            std::size_t readback_size = static_cast<std::size_t>(offscreen_image.get_width()) * offscreen_image.get_height() * sizeof(std::uint32_t);
+            for(std::size_t i = 0; i < this->get_view_count(); i++)
+            {
+                this->offscreen_readbacks.push_back({.buffer = vk::Buffer{vk::BufferType::Staging, vk::BufferPurpose::TransferDestination, *this->device, vk::hardware::MemoryResidency::CPUReadback, readback_size}, .frame_value = 0, .taken = false});
+            }
+        }
     }
 
     void RendererProcessorVulkan::initialise_resource_descriptors(const RendererPipelineManagerVulkan& pipeline_manager, const RendererBufferManagerVulkan& buffer_manager, const RendererImageManagerVulkan& image_manager, std::vector<const IResource*> resources)
@@ -653,8 +906,16 @@ namespace tz::gl
                 vk::DescriptorSetsCreationRequest& request = requests.new_request();
                 for(decltype(num_buffer_resources) j = 0; j < num_buffer_resources; j++)
                 {
-                    const vk::Buffer& resource_buffer = buffer_manager.get_buffer_components()[j].buffer;
-                    request.add_buffer(resource_buffer, 0, VK_WHOLE_SIZE, j);
+                    const BufferComponentVulkan& buffer_component = buffer_manager.get_buffer_components()[j];
+                    if(buffer_component.frame_ring.has_value())
+                    {
+                        // Each view's descriptor set only sees its own slice.
+                        request.add_buffer(buffer_component.buffer, buffer_component.slice_stride * i, buffer_component.frame_ring->size(), j);
+                    }
+                    else
+                    {
+                        request.add_buffer(buffer_component.buffer, 0, VK_WHOLE_SIZE, j);
+                    }
                 }
                 for(decltype(num_texture_resources) j = 0; j < num_texture_resources; j++)
                 {
@@ -668,12 +929,43 @@ namespace tz::gl
 
     void RendererProcessorVulkan::initialise_command_pool()
     {
+        // Frames still in flight may be executing the old command buffers, so the old pools are destroyed once those frames retire rather than now.
         if(!this->command_pool.empty())
         {
-            this->command_pool.clear();
+            this->deletion_queue.defer(std::exchange(this->command_pool, vk::CommandPool{*this->device, this->device->get_queue_family(), vk::CommandPool::RecycleBuffer}), this->get_frame_value());
+        }
+        this->command_pool.with(this->get_view_count());
+
+        // Draws are recorded into secondary command buffers, spread across the worker pools so they can be recorded in parallel.
+        for(vk::CommandPool& pool : this->worker_command_pools)
+        {
+            this->deletion_queue.defer(std::move(pool), this->get_frame_value());
+        }
+        this->worker_command_pools.clear();
+        std::size_t worker_count = this->get_worker_count();
+        for(std::size_t i = 0; i < worker_count; i++)
+        {
+            vk::CommandPool& pool = this->worker_command_pools.emplace_back(*this->device, this->device->get_queue_family(), vk::CommandPool::RecycleBuffer);
+            // Worker i handles views i, i + n, i + 2n...
+            std::size_t worker_view_count = (this->get_view_count() - i + worker_count - 1) / worker_count;
+            pool.with(worker_view_count, vk::CommandBufferLevel::Secondary);
         }
-        constexpr std::size_t num_scratch_command_bufs = 1;
-        this->command_pool.with(this->get_view_count() + num_scratch_command_bufs);
+        // The calling thread records too, so it needs one fewer thread than there are pools. The threads are kept for the processor's lifetime, as re-recording happens on every draw list change and resize.
+        if(!this->recording_workers.has_value() || this->recording_workers->get_thread_count() != worker_count - 1)
+        {
+            this->recording_workers.emplace(worker_count - 1);
+        }
+
+        // Timestamps are written by the primary and secondary command buffers, so their queries must also live as long as any frame which may use them.
+        if(this->device->get_queue_family().timestamp_valid_bits > 0)
+        {
+            if(this->timestamp_queries.has_value())
+            {
+                this->deletion_queue.defer(std::move(this->timestamp_queries.value()), this->get_frame_value());
+            }
+            this->timestamp_queries.emplace(*this->device, static_cast<std::uint32_t>(this->get_view_count() * GPUTimestampCount));
+        }
+        this->view_timings_pending.assign(this->get_view_count(), false);
     }
 
     void RendererProcessorVulkan::block_until_idle()
@@ -683,203 +975,213 @@ namespace tz::gl
 
     void RendererProcessorVulkan::record_rendering_commands(const RendererPipelineManagerVulkan& pipeline_manager, const RendererBufferManagerVulkan& buffer_manager, const RendererImageManagerVulkan& image_manager, tz::Vec4 clear_colour)
     {
-        VkClearValue vk_clear_colour{clear_colour[0], clear_colour[1], clear_colour[2], clear_colour[3]};
-        for(std::size_t i = 0; i < this->get_view_count(); i++)
+        // Each view gets its own draw-indirect buffer, so the CPU can write new draws for one view while the GPU is still reading another. Each is sized to fit every input once.
+        std::size_t initial_capacity = this->inputs.size();
+        while(this->view_draw_states.size() < this->get_view_count())
         {
-            vk::CommandBufferRecording render = this->command_pool[i].record();
-            vk::RenderPassRun run{this->command_pool[i], this->render_pass->vk_get_render_pass(), image_manager.get_swapchain_framebuffers()[i], this->swapchain->full_render_area(), vk_clear_colour};
-            pipeline_manager.get_pipeline().bind(this->command_pool[i]);
-            if(this->resource_descriptor_pool.has_value())
+            vk::Buffer draw_indirect_buffer = vk::Buffer::null();
+            if(initial_capacity > 0)
             {
-                render.bind(this->resource_descriptor_pool.value()[i], pipeline_manager.get_layout());
+                draw_indirect_buffer = vk::Buffer{vk::BufferType::DrawIndirect, vk::BufferPurpose::NothingSpecial, *this->device, vk::hardware::MemoryResidency::CPUPersistent, sizeof(DrawIndirectCommand) * initial_capacity};
             }
-            if(this->draw_indirect_buffer.has_value())
+            this->view_draw_states.push_back({.draw_indirect_buffer = std::move(draw_indirect_buffer), .capacity = initial_capacity, .draw_version = 0, .draw_counts = {}, .clear_colour = clear_colour});
+        }
+
+        // Record each view's draws in parallel. Each job only touches its own command pool.
+        std::size_t worker_count = this->worker_command_pools.size();
+        auto record_worker_draws = [&](std::size_t worker_id)
+        {
+            for(std::size_t view_id = worker_id; view_id < this->get_view_count(); view_id += worker_count)
             {
-                render.bind(buffer_manager.get_vertex_buffer());
-                render.bind(buffer_manager.get_index_buffer());
-                render.draw_indirect(this->draw_indirect_buffer.value(), this->num_static_draws());
+                this->record_view_draws(view_id, pipeline_manager, buffer_manager, image_manager);
             }
-            if(this->draw_indirect_dynamic_buffer.has_value())
+        };
+        // Waking the workers costs a few microseconds, which small draw lists don't make back.
+        constexpr std::size_t min_draws_for_workers = 256;
+        if(this->draw_commands.size() < min_draws_for_workers)
+        {
+            for(std::size_t i = 0; i < worker_count; i++)
             {
-                render.bind(buffer_manager.get_dynamic_vertex_buffer());
-                render.bind(buffer_manager.get_dynamic_index_buffer());
-                render.draw_indirect(this->draw_indirect_dynamic_buffer.value(), this->num_dynamic_draws());
+                record_worker_draws(i);
             }
         }
-    }
+        else
+        {
+            this->recording_workers->run(worker_count, record_worker_draws);
+        }
 
-    void RendererProcessorVulkan::clear_rendering_commands()
-    {
+        // The primary command buffers all belong to the same pool, so they're recorded here. They're cheap, as all they do is run the render pass.
         for(std::size_t i = 0; i < this->get_view_count(); i++)
         {
-            this->frame_admin.wait_for(i);
-            this->command_pool[i].reset();
+            this->record_view_commands(i, image_manager, clear_colour);
         }
     }
 
-    void RendererProcessorVulkan::record_and_run_scratch_commands(RendererBufferManagerVulkan& buffer_manager, RendererImageManagerVulkan& image_manager)
+    void RendererProcessorVulkan::record_and_submit_upload_commands(RendererBufferManagerVulkan& buffer_manager, RendererImageManagerVulkan& image_manager)
     {
-        vk::Fence copy_fence{*this->device};
-        copy_fence.signal();
-        vk::CommandBuffer& scratch_buf = this->command_pool[this->get_view_count()];
-        vk::Submit do_scratch_operation{vk::CommandBuffers{scratch_buf}, vk::SemaphoreRefs{}, vk::WaitStages{}, vk::SemaphoreRefs{}};
+        tz_profile_scope("RendererProcessorVulkan::record_and_submit_upload_commands");
+        tz_assert(!this->pending_upload.has_value(), "RendererProcessorVulkan: Attempted to upload static data while a previous upload is still pending.");
+        // All static data (input geometry, static buffer resources and textures) is packed into a single staging arena and copied via a single command buffer on the transfer queue.
+        struct StagingRegion
+        {
+            std::span<const std::byte> data;
+            std::size_t offset;
+        };
+        // Offsets into the staging buffer are kept aligned so they're always valid as a buffer->image copy source.
+        constexpr std::size_t staging_alignment = 16;
+        std::size_t staging_size = 0;
+        std::size_t region_count = 0;
+        auto stage = [&staging_size, &region_count](std::span<const std::byte> data)->StagingRegion
+        {
+            std::size_t offset = (staging_size + staging_alignment - 1) & ~(staging_alignment - 1);
+            staging_size = offset + data.size_bytes();
+            region_count++;
+            return {.data = data, .offset = offset};
+        };
+
+        auto upload_begin = std::chrono::steady_clock::now();
+
+        // Gather all static input geometry.
+        std::vector<std::byte> total_vertices;
+        std::vector<unsigned int> total_indices;
+        for(const IRendererInput* input : this->inputs)
+        {
+            if(input != nullptr && input->data_access() == RendererInputDataAccess::StaticFixed)
+            {
+                std::span<const std::byte> input_vertices = input->get_vertex_bytes();
+                std::span<const unsigned int> input_indices = input->get_indices();
+                std::copy(input_vertices.begin(), input_vertices.end(), std::back_inserter(total_vertices));
+                std::copy(input_indices.begin(), input_indices.end(), std::back_inserter(total_indices));
+            }
+        }
+
+        std::optional<StagingRegion> vertex_region, index_region;
+        if(!total_indices.empty())
+        {
+            vertex_region = stage(std::span<const std::byte>{total_vertices});
+            index_region = stage(std::as_bytes(std::span<const unsigned int>{total_indices}));
+        }
 
-        // Run scratch commands to ensure inputs are sorted w.r.t vertex/index/draw-indirect buffers.
+        // Static buffer resources. Dynamic ones are already mapped and written to directly.
+        std::vector<std::optional<StagingRegion>> buffer_regions;
+        for(std::size_t i = 0; i < buffer_manager.get_buffer_components().size(); i++)
         {
-            std::optional<vk::Buffer> draw_staging;
-            if(this->num_static_inputs() > 0)
+            IResource* buffer_resource = buffer_manager.get_buffer_components()[i].resource;
+            tz_report("Buffer Resource (ResourceID: %zu, BufferComponentID: %zu, %zu bytes total)", i, i, buffer_resource->get_resource_bytes().size_bytes());
+            if(buffer_resource->data_access() == RendererInputDataAccess::StaticFixed)
             {
-                draw_staging = vk::Buffer{vk::BufferType::Staging, vk::BufferPurpose::TransferSource, *this->device, vk::hardware::MemoryResidency::CPU, sizeof(DrawIndirectCommand) * this->num_static_inputs()};
+                buffer_regions.push_back(stage(buffer_resource->get_resource_bytes()));
             }
-            std::optional<vk::Buffer> draw_staging_dynamic;
-            if(this->num_dynamic_inputs() > 0)
+            else
             {
-                draw_staging_dynamic = vk::Buffer{vk::BufferType::Staging, vk::BufferPurpose::TransferSource, *this->device, vk::hardware::MemoryResidency::CPU, sizeof(DrawIndirectCommand) * this->num_dynamic_inputs()};
+                buffer_regions.push_back(std::nullopt);
             }
-            std::vector<std::byte> total_vertices, total_dynamic_vertices;
-            std::vector<unsigned int> total_indices, total_dynamic_indices;
-            DrawIndirectCommand* cmd = draw_staging.has_value() ? static_cast<DrawIndirectCommand*>(draw_staging->map_memory()) : nullptr;
-            DrawIndirectCommand* dyn_cmd = draw_staging_dynamic.has_value() ? static_cast<DrawIndirectCommand*>(draw_staging_dynamic->map_memory()) : nullptr;
-            std::uint32_t index_count_so_far = 0;
-            std::uint32_t dyn_index_count_so_far = 0;
-            std::uint32_t vertex_count_so_far = 0;
-            std::uint32_t dyn_vertex_count_so_far = 0;
-
-            for(const IRendererInput* input : this->inputs)
+        }
+
+        // Texture resources.
+        std::vector<StagingRegion> texture_regions;
+        for(std::size_t i = 0; i < image_manager.get_texture_components().size(); i++)
+        {
+            IResource* texture_resource = image_manager.get_texture_components()[i].resource;
+            tz_report("Texture Resource (ResourceID: %zu, TextureComponentID: %zu, %zu bytes total)", buffer_manager.get_buffer_components().size() + i, i, texture_resource->get_resource_bytes().size_bytes());
+            tz_assert(texture_resource->data_access() == RendererInputDataAccess::StaticFixed, "DynamicFixed texture resources not yet implemented (Vulkan)");
+            texture_regions.push_back(stage(texture_resource->get_resource_bytes()));
+        }
+
+        if(staging_size > 0)
+        {
+            // Fill the staging arena.
+            vk::Buffer staging{vk::BufferType::Staging, vk::BufferPurpose::TransferSource, *this->device, vk::hardware::MemoryResidency::CPU, staging_size};
             {
-                if(input != nullptr)
+                auto* staging_mem = static_cast<std::byte*>(staging.map_memory());
+                auto write_region = [staging_mem](const StagingRegion& region)
+                {
+                    std::copy(region.data.begin(), region.data.end(), staging_mem + region.offset);
+                };
+                if(vertex_region.has_value())
+                {
+                    write_region(vertex_region.value());
+                    write_region(index_region.value());
+                }
+                for(const std::optional<StagingRegion>& buffer_region : buffer_regions)
                 {
-                    // Get vertices and indices.
-                    std::span<const std::byte> input_vertices = input->get_vertex_bytes();
-                    std::span<const unsigned int> input_indices = input->get_indices();
-                    // Fill draw cmd
-                    DrawIndirectCommand cur_cmd;
-                    cur_cmd.indexCount = input->get_indices().size();
-                    cur_cmd.instanceCount = 1;
-                    cur_cmd.firstInstance = 0;
-
-                    if(input->data_access() == RendererInputDataAccess::StaticFixed)
+                    if(buffer_region.has_value())
                     {
-                        cur_cmd.firstIndex = index_count_so_far;
-                        cur_cmd.vertexOffset = vertex_count_so_far;
-                        std::copy(input_vertices.begin(), input_vertices.end(), std::back_inserter(total_vertices));
-                        std::copy(input_indices.begin(), input_indices.end(), std::back_inserter(total_indices));
-                        if(cmd != nullptr)
-                        {
-                            *cmd = cur_cmd;
-                            cmd++;
-                        }
-                        index_count_so_far += input->index_count();
-                        vertex_count_so_far += input->vertex_count();
+                        write_region(buffer_region.value());
                     }
-                    else if(input->data_access() == RendererInputDataAccess::DynamicFixed)
-                    {
-                        cur_cmd.firstIndex = dyn_index_count_so_far;
-                        cur_cmd.vertexOffset = dyn_vertex_count_so_far;
-                        std::copy(input_vertices.begin(), input_vertices.end(), std::back_inserter(total_dynamic_vertices));
-                        std::copy(input_indices.begin(), input_indices.end(), std::back_inserter(total_dynamic_indices));
-                        if(dyn_cmd != nullptr)
-                        {
-                            *dyn_cmd = cur_cmd;
-                            ++dyn_cmd;
-                        }
-                        dyn_index_count_so_far += input->index_count();
-                        dyn_vertex_count_so_far += input->vertex_count();
-                    }
-                    
                 }
-            }
-            if(draw_staging.has_value())
-            {
-                draw_staging->unmap_memory();
-            }
-            if(draw_staging_dynamic.has_value())
-            {
-                draw_staging_dynamic->unmap_memory();
+                for(const StagingRegion& texture_region : texture_regions)
+                {
+                    write_region(texture_region);
+                }
+                staging.unmap_memory();
             }
 
-            // Setup input data transfers using the scratch buffers.
-            if(index_count_so_far > 0)
+            // Record every copy into the transfer buffer.
+            vk::CommandBuffer& transfer_buf = this->transfer_command_pool[0];
+            transfer_buf.reset();
             {
-                // Part 1: Transfer vertex data.
-                std::span<const std::byte> vertex_data = total_vertices;
-                copy_fence.signal();
-                vk::Buffer vertices_staging{vk::BufferType::Staging, vk::BufferPurpose::TransferSource, *this->device, vk::hardware::MemoryResidency::CPU, vertex_data.size_bytes()};
-                vertices_staging.write(vertex_data.data(), vertex_data.size_bytes());
+                vk::CommandBufferRecording transfer = transfer_buf.record();
+                if(vertex_region.has_value())
                 {
-                    vk::CommandBufferRecording transfer_vertices = scratch_buf.record();
-                    transfer_vertices.buffer_copy_buffer(vertices_staging, buffer_manager.get_vertex_buffer(), vertex_data.size_bytes());
+                    const GeometryArenaAllocation& static_geometry = buffer_manager.get_static_geometry().value();
+                    transfer.buffer_copy_buffer(staging, buffer_manager.get_vertex_buffer(), vertex_region->data.size_bytes(), vertex_region->offset, static_geometry.vertices.offset);
+                    transfer.buffer_copy_buffer(staging, buffer_manager.get_index_buffer(), index_region->data.size_bytes(), index_region->offset, static_geometry.indices.offset);
                 }
-
-                // Submit Part 1
-                do_scratch_operation(this->graphics_present_queue, copy_fence);
-
-                copy_fence.wait_for();
-                scratch_buf.reset();
-                // Part 2: Transfer index data.
-                std::span<const unsigned int> index_data = total_indices;
-                vk::Buffer indices_staging{vk::BufferType::Staging, vk::BufferPurpose::TransferSource, *this->device, vk::hardware::MemoryResidency::CPU, index_data.size_bytes()};
-                indices_staging.write(index_data.data(), index_data.size_bytes());
+                for(std::size_t i = 0; i < buffer_regions.size(); i++)
+                {
+                    if(buffer_regions[i].has_value())
+                    {
+                        transfer.buffer_copy_buffer(staging, buffer_manager.get_buffer_components()[i].buffer, buffer_regions[i]->data.size_bytes(), buffer_regions[i]->offset);
+                    }
+                }
+                for(std::size_t i = 0; i < texture_regions.size(); i++)
                 {
-                    vk::CommandBufferRecording transfer_indices = scratch_buf.record();
-                    transfer_indices.buffer_copy_buffer(indices_staging, buffer_manager.get_index_buffer(), index_data.size_bytes());
+                    TextureComponentVulkan& texture_component = image_manager.get_texture_components()[i];
+                    transfer.transition_image_layout(texture_component.img, vk::Image::Layout::TransferDestination);
+                    transfer.buffer_copy_image(staging, texture_component.img, texture_regions[i].offset);
+                    transfer.transition_image_layout(texture_component.img, vk::Image::Layout::ShaderResource);
                 }
-                copy_fence.signal();
-                // Submit Part 2
-                do_scratch_operation(this->graphics_present_queue, copy_fence);
-                copy_fence.wait_for();
-                scratch_buf.reset();
             }
 
-            // Part 3: Setup draw commands for the inputs.
-            this->record_draw_list(this->all_inputs_once());
+            // Submit without waiting. The staging buffer must stay alive until the copy is done, so it's kept with the pending upload.
+            PendingUpload& upload = this->pending_upload.emplace(PendingUpload{.staging = std::move(staging), .fence = vk::Fence{*this->device}, .view_semaphores = {}, .view_states = {}});
+            vk::Submit do_upload{vk::CommandBuffers{transfer_buf}, vk::SemaphoreRefs{}, vk::WaitStages{}, vk::SemaphoreRefs{}};
+            for(std::size_t i = 0; i < this->get_view_count(); i++)
+            {
+                do_upload.add_signal(upload.view_semaphores.emplace_back(*this->device));
+                upload.view_states.push_back(UploadWaitState::Unwaited);
+            }
+            upload.fence.signal();
+            do_upload(this->transfer_queue, upload.fence);
         }
 
-        // Setup all components for buffer resources.
-        for(std::size_t i = 0; i < buffer_manager.get_buffer_components().size(); i++)
+        auto upload_duration = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - upload_begin);
+        tz_report("Static Upload (%zu region%s, %zu bytes total, %.3fms to submit, %s transfer queue)", region_count, region_count == 1 ? "" : "s", staging_size, upload_duration.count(), this->device->has_dedicated_transfer_queue() ? "dedicated" : "shared");
+
+        // Static geometry begins part-way into the shared arena buffers, which are bound from the beginning.
+        if(buffer_manager.get_static_geometry().has_value())
         {
-            BufferComponentVulkan& buffer_component = buffer_manager.get_buffer_components()[i];
-            vk::Buffer& resource_buffer = buffer_component.buffer;
-            IResource* buffer_resource = buffer_component.resource;
-            tz_report("Buffer Resource (ResourceID: %zu, BufferComponentID: %zu, %zu bytes total)", i, i, buffer_resource->get_resource_bytes().size_bytes());
-            if(buffer_resource->data_access() == RendererInputDataAccess::StaticFixed)
-            {
-                // Do transfers now.
-                scratch_buf.reset();
-                vk::Buffer resource_staging{vk::BufferType::Staging, vk::BufferPurpose::TransferSource, *this->device, vk::hardware::MemoryResidency::CPU, buffer_resource->get_resource_bytes().size_bytes()};
-                resource_staging.write(buffer_resource->get_resource_bytes().data(), buffer_resource->get_resource_bytes().size_bytes());
-                {
-                    vk::CommandBufferRecording transfer_resource = scratch_buf.record();
-                    transfer_resource.buffer_copy_buffer(resource_staging, resource_buffer, buffer_resource->get_resource_bytes().size_bytes());
-                }
-                copy_fence.signal();
-                do_scratch_operation(this->graphics_present_queue, copy_fence);
-                copy_fence.wait_for();
-            }
+            const GeometryArenaAllocation& static_geometry = buffer_manager.get_static_geometry().value();
+            this->draw_table.rebase_static(static_cast<std::uint32_t>(static_geometry.get_base_index()), static_cast<std::int32_t>(static_geometry.get_base_vertex()));
         }
+        // Setup draw commands for the inputs.
+        this->record_draw_list(this->all_inputs_once());
+    }
 
-        // Setup all components for texture resources.
-        for(std::size_t i = 0; i < image_manager.get_texture_components().size(); i++)
+    void RendererProcessorVulkan::finish_upload()
+    {
+        if(!this->pending_upload.has_value())
         {
-            TextureComponentVulkan& texture_component = image_manager.get_texture_components()[i];
-            IResource* texture_resource = texture_component.resource;
-            tz_report("Texture Resource (ResourceID: %zu, TextureComponentID: %zu, %zu bytes total)", buffer_manager.get_buffer_components().size() + i, i, texture_resource->get_resource_bytes().size_bytes());
-            tz_assert(texture_resource->data_access() == RendererInputDataAccess::StaticFixed, "DynamicFixed texture resources not yet implemented (Vulkan)");
-            {
-                scratch_buf.reset();
-                vk::Buffer resource_staging{vk::BufferType::Staging, vk::BufferPurpose::TransferSource, *this->device, vk::hardware::MemoryResidency::CPU, texture_resource->get_resource_bytes().size_bytes()};
-                resource_staging.write(texture_resource->get_resource_bytes().data(), texture_resource->get_resource_bytes().size_bytes());
-                {
-                    vk::CommandBufferRecording transfer_image = scratch_buf.record();
-                    transfer_image.transition_image_layout(texture_component.img, vk::Image::Layout::TransferDestination);
-                    transfer_image.buffer_copy_image(resource_staging, texture_component.img);
-                    transfer_image.transition_image_layout(texture_component.img, vk::Image::Layout::ShaderResource);
-                }
-                copy_fence.signal();
-                do_scratch_operation(this->graphics_present_queue, copy_fence);
-                copy_fence.wait_for();
-            }
+            return;
         }
+        // Views which already waited on the upload may still be in flight, so the semaphores and staging buffer live until those frames retire. A view which never waited means the transfer itself may still be running, so its fence is checked too (by then it has almost certainly signalled).
+        auto upload = std::make_shared<PendingUpload>(std::move(this->pending_upload.value()));
+        this->pending_upload = std::nullopt;
+        this->deletion_queue.defer(vk::DeferredAction{[upload]()
+        {
+            upload->fence.wait_for();
+        }}, this->get_frame_value());
     }
 
     void RendererProcessorVulkan::set_regeneration_function(std::function<void()> action)
@@ -887,185 +1189,293 @@ namespace tz::gl
         this->frame_admin.set_regeneration_function(action);
     }
 
+    void RendererProcessorVulkan::set_pre_submit_function(std::function<void(std::size_t)> action)
+    {
+        this->frame_admin.set_pre_submit_function([this, action](std::size_t view_id)
+        {
+            this->wait_for_upload(view_id);
+            this->collect_gpu_timings(view_id);
+            action(view_id);
+        });
+    }
+
+    vk::DeletionQueue& RendererProcessorVulkan::get_deletion_queue()
+    {
+        return this->deletion_queue;
+    }
+
+    std::uint64_t RendererProcessorVulkan::get_frame_value() const
+    {
+        return this->frame_admin.get_frame_value();
+    }
+
     void RendererProcessorVulkan::render()
     {
+        this->deletion_queue.collect(this->frame_admin.get_retired_frame_value());
         if(vk::is_headless())
         {
             this->frame_admin.render_frame_headless(this->graphics_present_queue, this->command_pool, vk::WaitStages{vk::WaitStage::ColourAttachmentOutput});
+            // If the view's previous frame was never taken, it's just been overwritten.
+            OffscreenReadback& readback = this->offscreen_readbacks[this->frame_admin.get_image_index()];
+            readback.frame_value = this->frame_admin.get_frame_value();
+            readback.taken = false;
         }
         else
         {
             this->frame_admin.render_frame(this->graphics_present_queue, static_cast<const vk::Swapchain&>(*this->swapchain), this->command_pool, vk::WaitStages{vk::WaitStage::ColourAttachmentOutput});
         }
+        if(this->timestamp_queries.has_value())
+        {
+            this->view_timings_pending[this->frame_admin.get_image_index()] = true;
+        }
     }
 
-    std::size_t RendererProcessorVulkan::get_view_count() const
+    std::optional<RendererOffscreenFrame> RendererProcessorVulkan::take_offscreen_frame(bool wait)
     {
-        if(vk::is_headless())
+        tz_assert(vk::is_headless(), "RendererProcessorVulkan::take_offscreen_frame(...): Only headless renderers render offscreen");
+        auto oldest = this->offscreen_readbacks.end();
+        for(auto iter = this->offscreen_readbacks.begin(); iter != this->offscreen_readbacks.end(); iter++)
         {
-            return 1;
+            if(iter->frame_value != 0 && !iter->taken && (oldest == this->offscreen_readbacks.end() || iter->frame_value < oldest->frame_value))
+            {
+                oldest = iter;
+            }
         }
-        else
+        if(oldest == this->offscreen_readbacks.end())
         {
-            return static_cast<const vk::Swapchain&>(*this->swapchain).get_image_views().size();
+            return std::nullopt;
+        }
+        if(oldest->frame_value > this->frame_admin.get_retired_frame_value())
+        {
+            if(!wait)
+            {
+                return std::nullopt;
+            }
+            this->frame_admin.wait_for_frame(oldest->frame_value);
         }
+        oldest->taken = true;
+        const auto& offscreen_image = static_cast<const vk::Image&>(*this->swapchain);
+        std::size_t readback_size = static_cast<std::size_t>(offscreen_image.get_width()) * offscreen_image.get_height() * sizeof(std::uint32_t);
+        oldest->buffer.invalidate(0, readback_size);
+        return RendererOffscreenFrame
+        {
+            .frame_id = oldest->frame_value,
+            .width = offscreen_image.get_width(),
+            .height = offscreen_image.get_height(),
+            .pixels = {static_cast<const std::byte*>(oldest->buffer.map_memory()), readback_size}
+        };
     }
 
-    std::size_t RendererProcessorVulkan::num_static_inputs() const
+    RendererGPUTimings RendererProcessorVulkan::get_gpu_timings() const
     {
-        
-        std::size_t total = std::accumulate(this->inputs.begin(), this->inputs.end(), 0, [](std::size_t accumulator, const IRendererInput* input)
-        {
-            return accumulator + (input->data_access() == RendererInputDataAccess::StaticFixed ? 1 : 0);
-        });
-
-        return total;
+        return {.render_pass = this->render_pass_timings.get_stats(), .draws = this->draw_timings.get_stats()};
     }
 
-    std::size_t RendererProcessorVulkan::num_dynamic_inputs() const
+    vk::CommandBuffer& RendererProcessorVulkan::get_view_draw_buffer(std::size_t view_id)
     {
-        std::size_t total = std::accumulate(this->inputs.begin(), this->inputs.end(), 0, [](std::size_t accumulator, const IRendererInput* input)
-        {
-            return accumulator + (input->data_access() == RendererInputDataAccess::DynamicFixed ? 1 : 0);
-        });
-        return total;
+        std::size_t worker_count = this->worker_command_pools.size();
+        return this->worker_command_pools[view_id % worker_count][view_id / worker_count];
     }
 
-    std::size_t RendererProcessorVulkan::num_static_draws() const
+    std::size_t RendererProcessorVulkan::get_view_count() const
     {
-        std::size_t total = std::accumulate(this->draw_cache.begin(), this->draw_cache.end(), 0, [this](std::size_t accumulator, const RendererInputHandle& handle)
+        if(vk::is_headless())
         {
-            std::size_t handle_val = static_cast<std::size_t>(static_cast<tz::HandleValue>(handle));
-            return accumulator + (this->inputs[handle_val]->data_access() == RendererInputDataAccess::StaticFixed ? 1 : 0);
-        });
-        return total;
+            // Headless frames are submitted round-robin, so each frame in flight needs its own command buffer.
+            return this->frames_in_flight;
+        }
+        else
+        {
+            return static_cast<const vk::Swapchain&>(*this->swapchain).get_image_views().size();
+        }
     }
-    
-    std::size_t RendererProcessorVulkan::num_dynamic_draws() const
+
+    std::size_t RendererProcessorVulkan::get_worker_count() const
     {
-        std::size_t total = std::accumulate(this->draw_cache.begin(), this->draw_cache.end(), 0, [this](std::size_t accumulator, const RendererInputHandle& handle)
-        {
-            std::size_t handle_val = static_cast<std::size_t>(static_cast<tz::HandleValue>(handle));
-            return accumulator + (this->inputs[handle_val]->data_access() == RendererInputDataAccess::DynamicFixed ? 1 : 0);
-        });
-        return total;
+        // No point having more workers than views.
+        return std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1, this->get_view_count());
     }
 
     void RendererProcessorVulkan::record_draw_list(const RendererDrawList& draws)
     {
+        tz_profile_scope("RendererProcessorVulkan::record_draw_list");
         if(this->draws_match_cache(draws))
         {
             return;
         }
-        // Firstly, retrieve an internal draw command for every input.
-        std::unordered_map<const IRendererInput*, DrawIndirectCommand> input_draws;
-        std::unordered_map<const IRendererInput*, DrawIndirectCommand> dynamic_input_draws;
+        // Translate into draw commands. The vector keeps its capacity between draw lists so we don't reallocate every time.
+        this->draw_commands.resize(draws.length());
+        this->draw_counts = this->draw_table.gather(draws, this->draw_commands);
+
+        // The GPU may still be reading the draw-indirect buffers, so they're not touched here. Each view is updated right before it is next submitted.
+        this->draw_version++;
+        this->draw_cache = draws;
+    }
 
+    void RendererProcessorVulkan::update_view(std::size_t view_id, const RendererPipelineManagerVulkan& pipeline_manager, RendererBufferManagerVulkan& buffer_manager, const RendererImageManagerVulkan& image_manager, tz::Vec4 clear_colour)
+    {
+        buffer_manager.publish_dynamic_data(view_id);
+
+        ViewDrawState& state = this->view_draw_states[view_id];
+        bool draw_counts_changed = false;
+        if(state.draw_version != this->draw_version)
         {
-            std::size_t static_vtx_count = 0, static_idx_count = 0;
-            std::size_t dynamic_vtx_count = 0, dynamic_idx_count = 0;
-            for(const IRendererInput* input : this->inputs)
+            std::size_t draw_count = this->draw_commands.size();
+            if(draw_count > state.capacity)
             {
-                DrawIndirectCommand cmd;
-                cmd.indexCount = input->index_count();
-                cmd.instanceCount = 1;
-                cmd.firstInstance = 0;
-                switch(input->data_access())
-                {
-                    case RendererInputDataAccess::StaticFixed:
-                        cmd.vertexOffset = static_vtx_count;
-                        cmd.firstIndex = static_idx_count;
-                        static_vtx_count += input->vertex_count();
-                        static_idx_count += input->index_count();
-                        input_draws[input] = cmd;
-                    break;
-                    case RendererInputDataAccess::DynamicFixed:
-                        cmd.vertexOffset = dynamic_vtx_count;
-                        cmd.firstIndex = dynamic_idx_count;
-                        dynamic_vtx_count += input->vertex_count();
-                        dynamic_idx_count += input->index_count();
-                        dynamic_input_draws[input] = cmd;
-                    break;
-                    default:
-                        tz_error("Unknown renderer input data access (Vulkan)");
-                    break;
-                }
+                // Only happens if the draw list contains duplicates. Like any other replaced resource, the old buffer is destroyed once every frame which may have used it retires.
+                this->deletion_queue.defer(std::exchange(state.draw_indirect_buffer, vk::Buffer{vk::BufferType::DrawIndirect, vk::BufferPurpose::NothingSpecial, *this->device, vk::hardware::MemoryResidency::CPUPersistent, sizeof(DrawIndirectCommand) * draw_count}), this->get_frame_value());
+                state.capacity = draw_count;
             }
+            if(draw_count > 0)
+            {
+                std::copy(this->draw_commands.begin(), this->draw_commands.end(), static_cast<DrawIndirectCommand*>(state.draw_indirect_buffer.map_memory()));
+            }
+
+            draw_counts_changed = state.draw_counts != this->draw_counts;
+            state.draw_version = this->draw_version;
+            state.draw_counts = this->draw_counts;
+        }
+        // Draw counts are baked into the secondary, so only if they've changed do we need to record it again.
+        if(draw_counts_changed)
+        {
+            this->get_view_draw_buffer(view_id).reset();
+            this->record_view_draws(view_id, pipeline_manager, buffer_manager, image_manager);
+        }
+        // The clear colour is baked into the primary. Re-recording the secondary also invalidates the primary which executes it. Either way the primary only runs the render pass, so recording it again is cheap.
+        if(draw_counts_changed || state.clear_colour != clear_colour)
+        {
+            this->command_pool[view_id].reset();
+            this->record_view_commands(view_id, image_manager, clear_colour);
         }
+    }
+
+    bool RendererProcessorVulkan::draws_match_cache(const RendererDrawList& draws) const
+    {
+        return this->draw_cache == draws;
+    }
+
+    void RendererProcessorVulkan::record_view_draws(std::size_t view_id, const RendererPipelineManagerVulkan& pipeline_manager, const RendererBufferManagerVulkan& buffer_manager, const RendererImageManagerVulkan& image_manager)
+    {
+        const ViewDrawState& state = this->view_draw_states[view_id];
+        vk::CommandBuffer& command_buffer = this->get_view_draw_buffer(view_id);
 
-        // Secondly, convert the draw list to a list of indirect draw commands.
-        std::vector<DrawIndirectCommand> internal_draws;
-        std::vector<DrawIndirectCommand> internal_draws_dynamic;
-        internal_draws.reserve(draws.length());
-        for(RendererInputHandle handle : draws)
+        vk::CommandBufferRecording render = command_buffer.record_secondary(this->render_pass->vk_get_render_pass(), image_manager.get_swapchain_framebuffers()[view_id]);
+        pipeline_manager.get_pipeline().bind(command_buffer);
+        vk::pipeline::ViewportState viewport_state = pipeline_manager.get_viewport_state();
+        render.set_viewport(viewport_state.get_viewport());
+        render.set_scissor(viewport_state.get_scissor());
+        if(this->resource_descriptor_pool.has_value())
         {
-            std::size_t handle_val = static_cast<std::size_t>(static_cast<tz::HandleValue>(handle));
-            const IRendererInput* input = this->inputs[handle_val];
-            switch(input->data_access())
+            render.bind(this->resource_descriptor_pool.value()[view_id], pipeline_manager.get_layout());
+        }
+        auto write_timestamp = [this, &render, view_id](GPUTimestamp timestamp, vk::TimestampStage stage)
+        {
+            if(this->timestamp_queries.has_value())
             {
-                case RendererInputDataAccess::StaticFixed:
-                    internal_draws.push_back(input_draws[input]);
-                break;
-                case RendererInputDataAccess::DynamicFixed:
-                    internal_draws_dynamic.push_back(dynamic_input_draws[input]);
-                break;
-                default:
-                        tz_error("Unknown renderer input data access (Vulkan)");
-                break;
+                render.write_timestamp(this->timestamp_queries.value(), this->get_timestamp_query(view_id, timestamp), stage);
             }
+        };
+        if(state.draw_counts.static_draws > 0)
+        {
+            write_timestamp(StaticDrawsBegin, vk::TimestampStage::Top);
+            render.bind(buffer_manager.get_vertex_buffer());
+            render.bind(buffer_manager.get_index_buffer());
+            render.draw_indirect(state.draw_indirect_buffer, state.draw_counts.static_draws);
+            write_timestamp(StaticDrawsEnd, vk::TimestampStage::Bottom);
+        }
+        if(state.draw_counts.dynamic_draws > 0)
+        {
+            write_timestamp(DynamicDrawsBegin, vk::TimestampStage::Top);
+            render.bind(buffer_manager.get_dynamic_vertex_buffer(), buffer_manager.get_dynamic_vertex_offset(view_id));
+            render.bind(buffer_manager.get_dynamic_index_buffer(), buffer_manager.get_dynamic_index_offset(view_id));
+            render.draw_indirect(state.draw_indirect_buffer, state.draw_counts.dynamic_draws, sizeof(DrawIndirectCommand) * state.draw_counts.static_draws);
+            write_timestamp(DynamicDrawsEnd, vk::TimestampStage::Bottom);
         }
-        tz_assert(internal_draws.size() + internal_draws_dynamic.size() == draws.length(), "Internal draw total didn't match number of inputs in draw list");
+    }
 
-        vk::Fence copy_fence{*this->device};
-        copy_fence.signal();
-        vk::CommandBuffer& scratch_buf = this->command_pool[this->get_view_count()];
-        vk::Submit do_scratch_operation{vk::CommandBuffers{scratch_buf}, vk::SemaphoreRefs{}, vk::WaitStages{}, vk::SemaphoreRefs{}};
+    void RendererProcessorVulkan::record_view_commands(std::size_t view_id, const RendererImageManagerVulkan& image_manager, tz::Vec4 clear_colour)
+    {
+        VkClearValue vk_clear_colour{clear_colour[0], clear_colour[1], clear_colour[2], clear_colour[3]};
+        vk::CommandBuffer& command_buffer = this->command_pool[view_id];
+        this->view_draw_states[view_id].clear_colour = clear_colour;
 
-        if(internal_draws.empty())
+        vk::CommandBufferRecording render = command_buffer.record();
+        if(this->timestamp_queries.has_value())
         {
-            this->draw_indirect_buffer = std::nullopt;
+            // The view's queries are reset every time it's submitted, so its timestamps must have been collected before then (see `collect_gpu_timings`).
+            render.reset_queries(this->timestamp_queries.value(), this->get_timestamp_query(view_id, PassBegin), GPUTimestampCount);
+            render.write_timestamp(this->timestamp_queries.value(), this->get_timestamp_query(view_id, PassBegin), vk::TimestampStage::Top);
         }
-        else
         {
-            std::size_t draw_size_bytes = internal_draws.size() * sizeof(DrawIndirectCommand);
-
-            this->draw_indirect_buffer = vk::Buffer{vk::BufferType::DrawIndirect, vk::BufferPurpose::TransferDestination, *this->device, vk::hardware::MemoryResidency::GPU, draw_size_bytes};
-            vk::Buffer draw_staging{vk::BufferType::Staging, vk::BufferPurpose::TransferSource, *this->device, vk::hardware::MemoryResidency::CPU, draw_size_bytes};
-            draw_staging.write(internal_draws.data(), draw_size_bytes);
-            {
-                vk::CommandBufferRecording transfer_draw_commands = scratch_buf.record();
-                transfer_draw_commands.buffer_copy_buffer(draw_staging, this->draw_indirect_buffer.value(), draw_size_bytes);
-            }
-            copy_fence.signal();
-            do_scratch_operation(this->graphics_present_queue, copy_fence);
-            copy_fence.wait_for();
+            vk::RenderPassRun run{command_buffer, this->render_pass->vk_get_render_pass(), image_manager.get_swapchain_framebuffers()[view_id], this->swapchain->full_render_area(), vk_clear_colour, vk::RenderPassContents::SecondaryCommandBuffers};
+            render.execute(this->get_view_draw_buffer(view_id));
         }
+        if(this->timestamp_queries.has_value())
+        {
+            render.write_timestamp(this->timestamp_queries.value(), this->get_timestamp_query(view_id, PassEnd), vk::TimestampStage::Bottom);
+        }
+        if(vk::is_headless())
+        {
+            // Copy the finished frame somewhere the CPU can read it, once the frame has retired.
+            render.image_copy_buffer(image_manager.get_offscreen_images()[view_id], this->offscreen_readbacks[view_id].buffer);
+        }
+    }
 
-        if(internal_draws_dynamic.empty())
+    void RendererProcessorVulkan::wait_for_upload(std::size_t view_id)
+    {
+        if(!this->pending_upload.has_value())
         {
-            this->draw_indirect_dynamic_buffer = std::nullopt;
+            return;
         }
-        else
+        PendingUpload& upload = this->pending_upload.value();
+        tz_assert(view_id < upload.view_states.size(), "RendererProcessorVulkan: View %zu has no upload semaphore (%zu views). The upload should have been finished before the view count changed.", view_id, upload.view_states.size());
+        UploadWaitState& state = upload.view_states[view_id];
+        switch(state)
         {
-            std::size_t draw_size_bytes = internal_draws_dynamic.size() * sizeof(DrawIndirectCommand);
+            case UploadWaitState::Unwaited:
+                this->frame_admin.wait_on_next_submit(upload.view_semaphores[view_id], vk::WaitStage::DrawIndirect);
+                state = UploadWaitState::Waiting;
+            break;
+            case UploadWaitState::Waiting:
+                // The pre-submit function only runs once the GPU is done with the view's previous submission, which was the one waiting on the upload.
+                state = UploadWaitState::Done;
+            break;
+            default:
+            break;
+        }
+        // Once every view is done with them, the staging buffer and semaphores are no longer needed.
+        if(std::all_of(upload.view_states.begin(), upload.view_states.end(), [](UploadWaitState view_state){return view_state == UploadWaitState::Done;}))
+        {
+            upload.fence.wait_for();
+            this->pending_upload = std::nullopt;
+        }
+    }
 
-            this->draw_indirect_dynamic_buffer = vk::Buffer{vk::BufferType::DrawIndirect, vk::BufferPurpose::TransferDestination, *this->device, vk::hardware::MemoryResidency::GPU, draw_size_bytes};
-            vk::Buffer draw_staging{vk::BufferType::Staging, vk::BufferPurpose::TransferSource, *this->device, vk::hardware::MemoryResidency::CPU, draw_size_bytes};
-            draw_staging.write(internal_draws_dynamic.data(), draw_size_bytes);
-            {
-                vk::CommandBufferRecording transfer_draw_commands = scratch_buf.record();
-                transfer_draw_commands.buffer_copy_buffer(draw_staging, this->draw_indirect_dynamic_buffer.value(), draw_size_bytes);
-            }
-            copy_fence.signal();
-            do_scratch_operation(this->graphics_present_queue, copy_fence);
-            copy_fence.wait_for();
+    void RendererProcessorVulkan::collect_gpu_timings(std::size_t view_id)
+    {
+        if(!this->timestamp_queries.has_value() || !this->view_timings_pending[view_id])
+        {
+            return;
         }
-        this->draw_cache = draws;
+        this->view_timings_pending[view_id] = false;
+        const vk::TimestampQueryPool& queries = this->timestamp_queries.value();
+        std::optional<float> pass_ms = queries.get_elapsed_milliseconds(this->get_timestamp_query(view_id, PassBegin), this->get_timestamp_query(view_id, PassEnd));
+        if(!pass_ms.has_value())
+        {
+            // The view's previous submission has finished, so this shouldn't happen. Drop the frame rather than wait on it.
+            return;
+        }
+        // Batches with no draws never write their timestamps.
+        float draws_ms = queries.get_elapsed_milliseconds(this->get_timestamp_query(view_id, StaticDrawsBegin), this->get_timestamp_query(view_id, StaticDrawsEnd)).value_or(0.0f)
+                       + queries.get_elapsed_milliseconds(this->get_timestamp_query(view_id, DynamicDrawsBegin), this->get_timestamp_query(view_id, DynamicDrawsEnd)).value_or(0.0f);
+        this->render_pass_timings.add(pass_ms.value());
+        this->draw_timings.add(draws_ms);
     }
 
-    bool RendererProcessorVulkan::draws_match_cache(const RendererDrawList& draws) const
+    std::uint32_t RendererProcessorVulkan::get_timestamp_query(std::size_t view_id, GPUTimestamp timestamp) const
     {
-        return this->draw_cache == draws;
+        return static_cast<std::uint32_t>(view_id * GPUTimestampCount) + timestamp;
     }
 
     RendererDrawList RendererProcessorVulkan::all_inputs_once() const
@@ -1081,13 +1491,14 @@ namespace tz::gl
     RendererVulkan::RendererVulkan(RendererBuilderVulkan builder, RendererBuilderDeviceInfoVulkan device_info):
     renderer_inputs(this->copy_inputs(builder)),
     renderer_resources(),
-    buffer_manager(device_info, this->get_inputs()),
+    buffer_manager(device_info, this->get_inputs(), builder.get_dynamic_data_mode()),
     pipeline_manager(builder, device_info),
     image_manager(builder, device_info),
     processor(builder, device_info, this->get_inputs()),
     clear_colour(),
     requires_depth_image(builder.get_render_pass().requires_depth_image())
     {
+        tz_profile_scope("RendererVulkan::RendererVulkan");
         this->clear_colour = {0.0f, 0.0f, 0.0f, 0.0f};
 
         std::vector<const IResource*> all_resources;
@@ -1114,27 +1525,34 @@ namespace tz::gl
         this->image_manager.initialise_resources(texture_resources);
         if(this->requires_depth_image)
         {
-            this->image_manager.setup_depth_image();
+            this->image_manager.setup_depth_image(this->processor.get_deletion_queue(), this->processor.get_frame_value());
         }
-        this->image_manager.setup_swapchain_framebuffers();
+        this->image_manager.setup_swapchain_framebuffers(this->processor.get_deletion_queue(), this->processor.get_frame_value());
 
         this->processor.initialise_resource_descriptors(this->pipeline_manager, this->buffer_manager, this->image_manager, all_resources);
-        // Command Buffers for each swapchain image, but an extra general-purpose recycleable buffer.
         // Now setup the swapchain image buffers
         this->processor.record_rendering_commands(this->pipeline_manager, this->buffer_manager, this->image_manager, this->clear_colour);
 
-        this->processor.record_and_run_scratch_commands(this->buffer_manager, this->image_manager);
+        this->processor.record_and_submit_upload_commands(this->buffer_manager, this->image_manager);
         // If frame admin needs to regenerate, allow it to.
         this->processor.set_regeneration_function([this](){this->handle_resize();});
+        // Any changes to the draw list are applied to a view just before it is submitted, once the GPU is definitely done with it.
+        this->processor.set_pre_submit_function([this](std::size_t view_id){this->processor.update_view(view_id, this->pipeline_manager, this->buffer_manager, this->image_manager, this->clear_colour);});
         // Tell the device to notify us when it detects a window resize. We will also need to regenerate then too.
         *device_info.on_resize = [this](){this->handle_resize();};
         tz_report("RendererVulkan (%zu input%s, %zu resource%s)", this->renderer_inputs.size(), this->renderer_inputs.size() == 1 ? "" : "s", this->renderer_resources.size(), this->renderer_resources.size() == 1 ? "" : "s");
     }
 
+    RendererVulkan::~RendererVulkan()
+    {
+        // The processor is the first member to be destroyed after this. It waits for the device to go idle, then its deletion queue returns the static geometry to the arena.
+        this->buffer_manager.release_static_geometry(this->processor.get_deletion_queue(), this->processor.get_frame_value());
+    }
+
     void RendererVulkan::set_clear_colour(tz::Vec4 clear_colour)
     {
+        // Each view picks up the new clear colour just before it is next submitted, so there's no need to wait for the GPU here.
         this->clear_colour = clear_colour;
-        this->handle_clear_colour_change();
     }
 
     tz::Vec4 RendererVulkan::get_clear_colour() const
@@ -1190,20 +1608,26 @@ namespace tz::gl
 
     void RendererVulkan::render()
     {
+        tz_profile_scope("RendererVulkan::render");
         this->processor.render();
     }
 
     void RendererVulkan::render(RendererDrawList draws)
     {
-        if(!this->processor.draws_match_cache(draws))
-        {
-            this->processor.clear_rendering_commands();
-            this->processor.record_draw_list(draws);
-            this->processor.record_rendering_commands(this->pipeline_manager, this->buffer_manager, this->image_manager, this->clear_colour);
-        }
+        this->processor.record_draw_list(draws);
         this->processor.render();
     }
 
+    RendererGPUTimings RendererVulkan::get_gpu_timings() const
+    {
+        return this->processor.get_gpu_timings();
+    }
+
+    std::optional<RendererOffscreenFrame> RendererVulkan::vk_take_offscreen_frame(bool wait)
+    {
+        return this->processor.take_offscreen_frame(wait);
+    }
+
     std::vector<std::unique_ptr<IRendererInput>> RendererVulkan::copy_inputs(const RendererBuilderVulkan builder)
     {
         std::vector<std::unique_ptr<IRendererInput>> input_duplicates;
@@ -1226,22 +1650,16 @@ namespace tz::gl
 
     void RendererVulkan::handle_resize()
     {
-        this->pipeline_manager.reconstruct_pipeline();
-
+        // The number of views may be about to change, but each view has its own upload semaphore.
+        this->processor.finish_upload();
+        // The pipeline uses dynamic viewport and scissor, so it doesn't need to be rebuilt. The new size is picked up when the commands are recorded again.
+        // Anything replaced here may still be in use by frames in flight, so it goes to the deletion queue instead of being destroyed straight away.
         if(this->requires_depth_image)
         {
-            this->image_manager.setup_depth_image();
+            this->image_manager.setup_depth_image(this->processor.get_deletion_queue(), this->processor.get_frame_value());
         }
 
-        this->image_manager.setup_swapchain_framebuffers();
-
-        this->processor.initialise_command_pool();
-        this->processor.record_rendering_commands(this->pipeline_manager, this->buffer_manager, this->image_manager, this->clear_colour);
-    }
-
-    void RendererVulkan::handle_clear_colour_change()
-    {
-        this->processor.block_until_idle();
+        this->image_manager.setup_swapchain_framebuffers(this->processor.get_deletion_queue(), this->processor.get_frame_value());
 
         this->processor.initialise_command_pool();
         this->processor.record_rendering_commands(this->pipeline_manager, this->buffer_manager, this->image_manager, this->clear_colour);
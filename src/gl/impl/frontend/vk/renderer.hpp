@@ -1,15 +1,22 @@
 #ifndef TOPAZ_GL_IMPL_VK_RENDERER_HPP
 #define TOPAZ_GL_IMPL_VK_RENDERER_HPP
 #if TZ_VULKAN
+#include "core/worker_pool.hpp"
 #include "gl/api/renderer.hpp"
 #include "gl/impl/frontend/common/device.hpp"
+#include "gl/impl/frontend/common/draw_table.hpp"
+#include "gl/impl/frontend/common/frame_ring.hpp"
+#include "gl/impl/frontend/common/gpu_timings.hpp"
+#include "gl/impl/frontend/vk/geometry_arena.hpp"
 
 #include "gl/impl/backend/vk/pipeline/graphics_pipeline.hpp"
 #include "gl/impl/backend/vk/logical_device.hpp"
 #include "gl/impl/backend/vk/pipeline/shader_module.hpp"
 #include "gl/impl/backend/vk/swapchain.hpp"
 #include "gl/impl/backend/vk/framebuffer.hpp"
+#include "gl/impl/backend/vk/deletion_queue.hpp"
 #include "gl/impl/backend/vk/frame_admin.hpp"
+#include "gl/impl/backend/vk/query_pool.hpp"
 
 namespace tz::gl
 {
@@ -28,6 +35,8 @@ namespace tz::gl
 
         virtual void set_culling_strategy(RendererCullingStrategy culling_strategy) final;
         virtual RendererCullingStrategy get_culling_strategy() const final;
+        virtual void set_dynamic_data_mode(RendererDynamicDataMode dynamic_data_mode) final;
+        virtual RendererDynamicDataMode get_dynamic_data_mode() const final;
         virtual void set_render_pass(const RenderPass& render_pass) final;
         virtual const RenderPass& get_render_pass() const final;
         virtual void set_shader(const Shader& shader) final;
@@ -45,6 +54,7 @@ namespace tz::gl
         std::vector<const IResource*> buffer_resources;
         std::vector<const IResource*> texture_resources;
         RendererCullingStrategy culling_strategy = RendererCullingStrategy::NoCulling;
+        RendererDynamicDataMode dynamic_data_mode = RendererDynamicDataMode::DirectMapped;
         const RenderPass* render_pass = nullptr;
         const Shader* shader = nullptr;
     };
@@ -53,16 +63,26 @@ namespace tz::gl
     {
         const vk::LogicalDevice* device;
         vk::pipeline::PrimitiveTopology primitive_type;
+        vk::FrameSyncMode frame_sync_mode;
+        /// Maximum number of frames the renderer may have in flight at once.
+        std::size_t frames_in_flight;
         const DeviceWindowBufferVulkan* device_swapchain;
         DeviceWindowResizeCallback* on_resize;
+        /// Device-wide cache used when creating the renderer's pipeline.
+        vk::PipelineCache* pipeline_cache;
+        /// Device-wide storage for static input geometry.
+        GeometryArenaVulkan* geometry_arena;
     };
 
     class RendererPipelineManagerVulkan
     {
     public:
         RendererPipelineManagerVulkan(RendererBuilderVulkan builder, RendererBuilderDeviceInfoVulkan device_info);
-        void reconstruct_pipeline();
         const vk::GraphicsPipeline& get_pipeline() const;
+        /**
+         * @brief Retrieve the viewport state matching the current size of the swapchain. The pipeline uses dynamic viewport and scissor, so this must be set whenever the pipeline is bound.
+         */
+        vk::pipeline::ViewportState get_viewport_state() const;
         const vk::DescriptorSetLayout& get_resource_descriptor_layout() const;
         const vk::pipeline::Layout& get_layout() const;
     private:
@@ -75,6 +95,7 @@ namespace tz::gl
         vk::pipeline::InputAssembly input_assembly;
         vk::pipeline::RasteriserState rasteriser_state;
         const DeviceWindowBufferVulkan* swapchain;
+        vk::PipelineCache* pipeline_cache;
         vk::DescriptorSetLayout resource_descriptor_layout;
         vk::pipeline::Layout layout;
         vk::GraphicsPipeline graphics_pipeline;
@@ -85,6 +106,10 @@ namespace tz::gl
     {
         vk::Buffer buffer;
         IResource* resource;
+        /// Distance in bytes between the slices of each view within `buffer`. Zero unless the resource is dynamic and the renderer uses @ref RendererDynamicDataMode::FrameRing.
+        std::size_t slice_stride = 0;
+        /// Host copy of the resource data which the user writes to, if `slice_stride` is non-zero.
+        std::optional<RendererFrameRing> frame_ring = std::nullopt;
     };
 
     /**
@@ -100,8 +125,19 @@ namespace tz::gl
          * 
          * @param device_info Information about the Device.
          * @param renderer_inputs List of all inputs. We should sort the input data into buffers.
+         * @param dynamic_data_mode How dynamic input and dynamic buffer resource data should be stored.
+         */
+        RendererBufferManagerVulkan(RendererBuilderDeviceInfoVulkan device_info, std::vector<IRendererInput*> renderer_inputs, RendererDynamicDataMode dynamic_data_mode);
+        RendererBufferManagerVulkan(const RendererBufferManagerVulkan& copy) = delete;
+        /// Precondition: The static geometry has been released via `release_static_geometry`.
+        ~RendererBufferManagerVulkan();
+        RendererBufferManagerVulkan& operator=(const RendererBufferManagerVulkan& rhs) = delete;
+        /**
+         * @brief Hand the static geometry back to the device's geometry arena, once every frame which may read it has retired.
+         * @param deletion_queue Queue which returns the geometry to the arena once `last_used_frame` retires.
+         * @param last_used_frame Value of the last frame which may read the geometry.
          */
-        RendererBufferManagerVulkan(RendererBuilderDeviceInfoVulkan device_info, std::vector<IRendererInput*> renderer_inputs);
+        void release_static_geometry(vk::DeletionQueue& deletion_queue, std::uint64_t last_used_frame);
         /**
          * @brief Create empty buffer components for each buffer resource.
          * 
@@ -113,9 +149,17 @@ namespace tz::gl
          * 
          */
         void setup_buffers();
+        /**
+         * @brief Retrieve where the static input geometry lives within the device's geometry arena, if there is any.
+         */
+        const std::optional<GeometryArenaAllocation>& get_static_geometry() const;
+        /**
+         * @brief Retrieve the vertex buffer containing the static input geometry. It is shared with other renderers, so the geometry begins at @ref RendererBufferManagerVulkan::get_static_geometry().
+         * @pre There must be some static input geometry.
+         */
         const vk::Buffer& get_vertex_buffer() const;
         vk::Buffer& get_vertex_buffer();
-        
+        /// Retrieve the index buffer containing the static input geometry. See @ref RendererBufferManagerVulkan::get_vertex_buffer().
         const vk::Buffer& get_index_buffer() const;
         vk::Buffer& get_index_buffer();
 
@@ -124,6 +168,19 @@ namespace tz::gl
 
         const vk::Buffer& get_dynamic_index_buffer() const;
         vk::Buffer& get_dynamic_index_buffer();
+        /**
+         * @brief Retrieve the offset into the dynamic vertex buffer which the given view should bind.
+         */
+        std::size_t get_dynamic_vertex_offset(std::size_t view_id) const;
+        /**
+         * @brief Retrieve the offset into the dynamic index buffer which the given view should bind.
+         */
+        std::size_t get_dynamic_index_offset(std::size_t view_id) const;
+        /**
+         * @brief Make any changes to dynamic data visible to the given view. Only ranges marked dirty are copied/flushed, unless the owner of the data has never marked any ranges dirty.
+         * @pre The GPU must not currently be using the given view.
+         */
+        void publish_dynamic_data(std::size_t view_id);
         /**
          * @brief Retrieve all of the buffer components. If there are no buffer resources, this will be empty.
          * @note `get_buffer_components()[handle]` will retrieve the corresponding BufferComponent for the BufferResource created via the handle `handle`.
@@ -139,13 +196,32 @@ namespace tz::gl
          */
         std::span<BufferComponentVulkan> get_buffer_components();
     private:
+        /// Where the vertex data of a dynamic input lives within the dynamic vertex buffer (or its ring).
+        struct DynamicInputRegion
+        {
+            IRendererDynamicInput* input;
+            std::size_t offset;
+            std::size_t length;
+        };
+
         const vk::LogicalDevice* device;
         const vk::hardware::Device* physical_device;
         std::vector<IRendererInput*> inputs;
-        vk::Buffer vertex_buffer;
+        RendererDynamicDataMode dynamic_data_mode;
+        /// Number of slices each dynamic buffer is split into if we're using @ref RendererDynamicDataMode::FrameRing. One per view.
+        std::size_t slice_count;
+        GeometryArenaVulkan* geometry_arena;
+        std::optional<GeometryArenaAllocation> static_geometry;
         vk::Buffer dynamic_vertex_buffer;
-        vk::Buffer index_buffer;
         vk::Buffer dynamic_index_buffer;
+        /// Distance in bytes between the slices of each view within the dynamic vertex/index buffers. Zero if we're using @ref RendererDynamicDataMode::DirectMapped.
+        std::size_t dynamic_vertex_slice_stride;
+        std::size_t dynamic_index_slice_stride;
+        std::optional<RendererFrameRing> dynamic_vertex_ring;
+        std::optional<RendererFrameRing> dynamic_index_ring;
+        std::vector<DynamicInputRegion> dynamic_vertex_regions;
+        /// Ranges copied into a slice by the last publish. Kept around to avoid reallocating every frame.
+        DirtyRangeList published_ranges;
         std::vector<BufferComponentVulkan> buffer_components;
     };
 
@@ -163,9 +239,19 @@ namespace tz::gl
     public:
         RendererImageManagerVulkan(RendererBuilderVulkan builder, RendererBuilderDeviceInfoVulkan device_info);
         void initialise_resources(std::vector<IResource*> renderer_buffer_resources);
-        void setup_depth_image();
-        void setup_swapchain_framebuffers();
+        /**
+         * @brief Create a depth image matching the swapchain size. Any previous depth image is handed to the deletion queue, as in-flight frames may still be using it.
+         */
+        void setup_depth_image(vk::DeletionQueue& deletion_queue, std::uint64_t last_used_frame);
+        /**
+         * @brief Create a framebuffer for each swapchain image. Any previous framebuffers are handed to the deletion queue, as in-flight frames may still be using them.
+         */
+        void setup_swapchain_framebuffers(vk::DeletionQueue& deletion_queue, std::uint64_t last_used_frame);
         std::span<const vk::Framebuffer> get_swapchain_framebuffers() const;
+        /**
+         * @brief Retrieve the offscreen images rendered into when headless, one per frame in flight. Empty if not headless.
+         */
+        std::span<const vk::Image> get_offscreen_images() const;
         std::span<const TextureComponentVulkan> get_texture_components() const;
         std::span<TextureComponentVulkan> get_texture_components();
     private:
@@ -174,7 +260,10 @@ namespace tz::gl
         const vk::hardware::Device* physical_device;
         const RenderPass* render_pass;
         const DeviceWindowBufferVulkan* swapchain;
-        std::optional<vk::ImageView> maybe_swapchain_offscreen_imageview;
+        /// When headless, every frame in flight renders into its own offscreen image, so frames can overlap and be read back independently.
+        std::size_t frames_in_flight;
+        std::vector<vk::Image> offscreen_images;
+        std::vector<vk::ImageView> offscreen_imageviews;
         std::vector<TextureComponentVulkan> texture_components;
         std::optional<vk::Image> depth_image;
         std::optional<vk::ImageView> depth_imageview;
@@ -189,39 +278,160 @@ namespace tz::gl
         void initialise_command_pool();
         void block_until_idle();
         void record_rendering_commands(const RendererPipelineManagerVulkan& pipeline_manager, const RendererBufferManagerVulkan& buffer_manager, const RendererImageManagerVulkan& image_manager, tz::Vec4 clear_colour);
-        void clear_rendering_commands();
-        void record_and_run_scratch_commands(RendererBufferManagerVulkan& buffer_manager, RendererImageManagerVulkan& image_manager);
+        /**
+         * @brief Copy all static data to the GPU via the transfer queue, without waiting for the copy to finish. Each view waits for the copy on the GPU the first time it is submitted.
+         */
+        void record_and_submit_upload_commands(RendererBufferManagerVulkan& buffer_manager, RendererImageManagerVulkan& image_manager);
+        /**
+         * @brief Block until the upload has finished and no view needs to wait on it anymore. Must be invoked before the number of views changes.
+         */
+        void finish_upload();
         void set_regeneration_function(std::function<void()> action);
+        /**
+         * @brief Retrieve the queue of resources waiting for in-flight frames to retire. Resources handed to it are destroyed during a later call to `render`.
+         */
+        vk::DeletionQueue& get_deletion_queue();
+        /**
+         * @brief Retrieve the value of the most recently submitted frame. A resource used by that frame can be destroyed once it retires.
+         */
+        std::uint64_t get_frame_value() const;
+        void set_pre_submit_function(std::function<void(std::size_t)> action);
+        /**
+         * @brief Set the list of inputs to be drawn. This only updates the CPU-side draw commands -- each view picks them up via `update_view` just before it is next submitted.
+         */
         void record_draw_list(const RendererDrawList& draws);
+        /**
+         * @brief Ensure the dynamic data and draw-indirect buffer for the given view reflect the current state, re-recording the view's commands if the number of draws or the clear colour has changed.
+         * @pre The GPU must not currently be using the command buffer or draw-indirect buffer for this view.
+         */
+        void update_view(std::size_t view_id, const RendererPipelineManagerVulkan& pipeline_manager, RendererBufferManagerVulkan& buffer_manager, const RendererImageManagerVulkan& image_manager, tz::Vec4 clear_colour);
         bool draws_match_cache(const RendererDrawList& draws) const;
         void render();
+        /**
+         * @brief Retrieve the oldest headless frame which has not yet been retrieved. See @ref RendererVulkan::vk_take_offscreen_frame.
+         */
+        std::optional<RendererOffscreenFrame> take_offscreen_frame(bool wait);
+        RendererGPUTimings get_gpu_timings() const;
     private:
+        /// Keeps track of what the draw-indirect buffer of a single view currently contains.
+        struct ViewDrawState
+        {
+            /// Persistently-mapped draw-indirect buffer. Static draws come first, immediately followed by dynamic draws.
+            vk::Buffer draw_indirect_buffer;
+            /// Number of draw commands `draw_indirect_buffer` can fit.
+            std::size_t capacity;
+            /// Value of `draw_version` when `draw_indirect_buffer` was last written to.
+            std::size_t draw_version;
+            /// Number of draws within `draw_indirect_buffer`. The view's commands were recorded with these counts.
+            RendererDrawCounts draw_counts;
+            /// Clear colour the view's primary command buffer was recorded with.
+            tz::Vec4 clear_colour;
+        };
+
+        enum class UploadWaitState
+        {
+            /// The view has not been submitted since the upload began.
+            Unwaited,
+            /// The view's last submission waits on the upload.
+            Waiting,
+            /// The view's last submission that waited on the upload has completed.
+            Done
+        };
+
+        /// Static data currently being copied by the transfer queue. A binary semaphore can only be waited on once, so each view gets its own.
+        struct PendingUpload
+        {
+            vk::Buffer staging;
+            vk::Fence fence;
+            std::vector<vk::Semaphore> view_semaphores;
+            std::vector<UploadWaitState> view_states;
+        };
+
+        /// Host-visible copy of a headless view's offscreen image, made at the end of each frame.
+        struct OffscreenReadback
+        {
+            vk::Buffer buffer;
+            /// Value of the frame last rendered by the view, or 0 if it hasn't rendered yet.
+            std::uint64_t frame_value;
+            /// Whether the frame has already been handed out by `take_offscreen_frame`.
+            bool taken;
+        };
+
+        /// Timestamps written by each view, in the order they're written. Each view owns a contiguous range of `GPUTimestampCount` queries.
+        enum GPUTimestamp : std::uint32_t
+        {
+            PassBegin,
+            StaticDrawsBegin,
+            StaticDrawsEnd,
+            DynamicDrawsBegin,
+            DynamicDrawsEnd,
+            PassEnd,
+            GPUTimestampCount
+        };
+
+        /// Invoked just before a view is submitted. If the upload is still pending and the view hasn't yet waited on it, the submission will.
+        void wait_for_upload(std::size_t view_id);
+        /// Invoked just before a view is submitted, once its previous submission has finished. Reads the timestamps from that submission before they're reset.
+        void collect_gpu_timings(std::size_t view_id);
+        /// Retrieve the index of the given timestamp query for the given view.
+        std::uint32_t get_timestamp_query(std::size_t view_id, GPUTimestamp timestamp) const;
+        /// Record the draws for a view into its secondary command buffer. Safe to call concurrently for views belonging to different workers.
+        void record_view_draws(std::size_t view_id, const RendererPipelineManagerVulkan& pipeline_manager, const RendererBufferManagerVulkan& buffer_manager, const RendererImageManagerVulkan& image_manager);
+        /// Record the primary command buffer for a view, which runs the render pass and executes the view's secondary command buffer.
+        void record_view_commands(std::size_t view_id, const RendererImageManagerVulkan& image_manager, tz::Vec4 clear_colour);
+        /// Retrieve the secondary command buffer containing the draws for the given view.
+        vk::CommandBuffer& get_view_draw_buffer(std::size_t view_id);
         std::size_t get_view_count() const;
-        std::size_t num_static_inputs() const;
-        std::size_t num_dynamic_inputs() const;
-        std::size_t num_static_draws() const;
-        std::size_t num_dynamic_draws() const;
+        std::size_t get_worker_count() const;
         RendererDrawList all_inputs_once() const;
 
         const vk::LogicalDevice* device;
         const vk::hardware::Device* physical_device;
         const RenderPass* render_pass;
         const DeviceWindowBufferVulkan* swapchain;
+        /// When headless, there is one view per frame in flight.
+        std::size_t frames_in_flight;
         std::vector<IRendererInput*> inputs;
         std::optional<vk::DescriptorPool> resource_descriptor_pool;
         vk::CommandPool command_pool;
+        /// One pool per recording thread, as command pools cannot be used by multiple threads at once. View `v` records its draws into secondary command buffer `v / n` of pool `v % n`, where `n` is the number of pools.
+        std::vector<vk::CommandPool> worker_command_pools;
+        /// Records into `worker_command_pools` in parallel. Job `i` records every view belonging to pool `i`.
+        std::optional<tz::WorkerPool> recording_workers;
         vk::hardware::Queue graphics_present_queue;
-        std::optional<vk::Buffer> draw_indirect_buffer;
-        std::optional<vk::Buffer> draw_indirect_dynamic_buffer;
+        /// Belongs to the transfer queue family, which may differ from the graphics queue family.
+        vk::CommandPool transfer_command_pool;
+        vk::hardware::Queue transfer_queue;
+        std::optional<PendingUpload> pending_upload;
+        /// One per view when headless, otherwise empty.
+        std::vector<OffscreenReadback> offscreen_readbacks;
+        RendererDrawTable draw_table;
+        std::vector<ViewDrawState> view_draw_states;
+        /// Draw commands for the current draw list. Static draws come first, immediately followed by dynamic draws.
+        std::vector<DrawIndirectCommand> draw_commands;
+        RendererDrawCounts draw_counts;
+        std::size_t draw_version;
         RendererDrawList draw_cache;
+        /// Has `GPUTimestampCount` queries per view. std::nullopt if the graphics queue doesn't support timestamps.
+        std::optional<vk::TimestampQueryPool> timestamp_queries;
+        /// Whether each view has been submitted since its timestamps were last collected.
+        std::vector<bool> view_timings_pending;
+        GPUTimingHistory render_pass_timings;
+        GPUTimingHistory draw_timings;
+        /// Must outlive `frame_admin`, which waits for the device to go idle when it is destroyed.
+        vk::DeletionQueue deletion_queue;
         vk::FrameAdmin frame_admin;
     };
 
     class RendererVulkan : public IRenderer
     {
     public:
-        constexpr static std::size_t frames_in_flight = 2;
         RendererVulkan(RendererBuilderVulkan builder, RendererBuilderDeviceInfoVulkan device_info);
+        RendererVulkan(const RendererVulkan& copy) = delete;
+        RendererVulkan(RendererVulkan&& move) = delete;
+        ~RendererVulkan();
+        RendererVulkan& operator=(const RendererVulkan& rhs) = delete;
+        RendererVulkan& operator=(RendererVulkan&& rhs) = delete;
     
         virtual void set_clear_colour(tz::Vec4 clear_colour) final;
         virtual tz::Vec4 get_clear_colour() const final;
@@ -238,11 +448,20 @@ namespace tz::gl
         
         virtual void render() final;
         virtual void render(RendererDrawList draws) final;
+        virtual RendererGPUTimings get_gpu_timings() const final;
+        /**
+         * @brief Retrieve the oldest frame which has been rendered but not yet retrieved, read back into host memory. Headless only.
+         * @details Each frame in flight renders into its own offscreen image, which is copied into host-visible memory at the end of the frame. This allows frames to be read back without stalling the next.
+         * 
+         * If a frame is not retrieved before its frame-in-flight slot is rendered into again, it is lost.
+         * @param wait If the oldest frame has not finished yet: Block until it has if true, otherwise return std::nullopt.
+         * @return The frame, or std::nullopt if there's no frame ready. The pixels remain valid until the next call to `render`.
+         */
+        std::optional<RendererOffscreenFrame> vk_take_offscreen_frame(bool wait = false);
     private:
         std::vector<std::unique_ptr<IRendererInput>> copy_inputs(const RendererBuilderVulkan builder);
         std::vector<IRendererInput*> get_inputs();
         void handle_resize();
-        void handle_clear_colour_change();
 
         std::vector<std::unique_ptr<IRendererInput>> renderer_inputs;
         std::vector<std::unique_ptr<IResource>> renderer_resources;
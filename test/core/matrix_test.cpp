@@ -4,8 +4,12 @@
 
 #include "core/tz.hpp"
 #include "core/matrix.hpp"
+#include "core/matrix_transform.hpp"
+#include <cmath>
+#include <random>
 #include <string>
 #include <cstring>
+#include <vector>
 
 void identity()
 {
@@ -109,6 +113,99 @@ void inversion()
 	}
 }
 
+bool nearly_identity(const tz::Mat4& m)
+{
+	for(std::size_t i = 0; i < 4; i++)
+	{
+		for(std::size_t j = 0; j < 4; j++)
+		{
+			if(std::abs(m(i, j) - (i == j ? 1.0f : 0.0f)) > 1e-4f)
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+void affine_inversion()
+{
+	tz::Mat4 model = tz::model({1.0f, -2.0f, 30.0f}, {0.3f, -1.2f, 2.5f}, {2.0f, 0.5f, 4.0f});
+	tz::Mat4 affine = model.inverse_affine();
+	tz_assert(nearly_identity(model * affine), "Mat4::inverse_affine() did not invert a model matrix");
+	tz::Mat4 general = model.inverse();
+	tz_assert(nearly_identity(model * general), "Mat4::inverse() did not invert a model matrix");
+
+	tz::Mat4 camera = tz::translate({-5.0f, 3.0f, 8.0f}) * tz::rotate({1.0f, 0.2f, -0.7f});
+	tz::Mat4 rigid = camera.inverse_rigid();
+	tz_assert(nearly_identity(camera * rigid), "Mat4::inverse_rigid() did not invert a camera matrix");
+	tz_assert(nearly_identity(tz::view({-5.0f, 3.0f, 8.0f}, {1.0f, 0.2f, -0.7f}) * camera), "tz::view did not produce the inverse of the camera transform");
+}
+
+void gauss_jordan_inversion()
+{
+	// Needs a row swap, as the top-left element is zero.
+	tz::Mat3 m{{std::array<float, 3>{0.0f, 2.0f, 1.0f}, {1.0f, 1.0f, 0.0f}, {3.0f, 0.0f, 5.0f}}};
+	tz::Mat3 product = m * m.inverse();
+	for(std::size_t i = 0; i < 3; i++)
+	{
+		for(std::size_t j = 0; j < 3; j++)
+		{
+			float expected = i == j ? 1.0f : 0.0f;
+			tz_assert(std::abs(product(i, j) - expected) <= 1e-5f, "Mat3 * Mat3::inverse() gave %g at (%zu, %zu), expected %g", product(i, j), i, j, expected);
+		}
+	}
+
+	// Double-precision 4x4 matrices are not SIMD-accelerated, so they go through Gauss-Jordan too.
+	tz::Matrix<double, 4, 4> fours;
+	for(std::size_t i = 0; i < 4; i++)
+	{
+		for(std::size_t j = 0; j < 4; j++)
+		{
+			fours(i, j) = (i + j == 3) ? 4.0 : -4.0;
+		}
+	}
+	tz::Matrix<double, 4, 4> sixteenths = fours.inverse();
+	for(std::size_t i = 0; i < 4; i++)
+	{
+		for(std::size_t j = 0; j < 4; j++)
+		{
+			double expected = (i + j == 3) ? 1.0 / 16.0 : -1.0 / 16.0;
+			tz_assert(std::abs(sixteenths(i, j) - expected) <= 1e-12, "Matrix<double, 4, 4>::inverse() gave %g at (%zu, %zu), expected %g", sixteenths(i, j), i, j, expected);
+		}
+	}
+}
+
+void model_batch()
+{
+	std::mt19937 rng{5};
+	std::uniform_real_distribution<float> dist{-10.0f, 10.0f};
+	// Odd-sized, so the last few models miss out on SIMD. The large batch is split across threads.
+	for(std::size_t count : {std::size_t{1003}, std::size_t{70001}})
+	{
+		std::vector<tz::Vec3> positions, rotations, scales;
+		for(std::size_t i = 0; i < count; i++)
+		{
+			positions.push_back({dist(rng), dist(rng), dist(rng)});
+			rotations.push_back({dist(rng), dist(rng), dist(rng)});
+			scales.push_back({dist(rng), dist(rng), dist(rng)});
+		}
+		std::vector<tz::Mat4> models(count);
+		tz::model_batch(positions, rotations, scales, models, 4);
+		for(std::size_t i = 0; i < count; i++)
+		{
+			tz::Mat4 expected = tz::model(positions[i], rotations[i], scales[i]);
+			for(std::size_t j = 0; j < 4; j++)
+			{
+				for(std::size_t k = 0; k < 4; k++)
+				{
+					tz_assert(std::abs(models[i](j, k) - expected(j, k)) <= 1e-4f * std::max(1.0f, std::abs(expected(j, k))), "tz::model_batch gave %g at (%zu, %zu) of model %zu/%zu, but tz::model gave %g", models[i](j, k), j, k, i, count, expected(j, k));
+				}
+			}
+		}
+	}
+}
+
 void column_major()
 {
 	tz::Mat4 order{{std::array<float, 4>{0, 1, 2, 3}, {4, 5, 6, 7}, {8, 9, 10, 11}, {12, 13, 14, 15}}};
@@ -124,10 +221,85 @@ void column_major()
 	tz_assert(order(3, 1) == 7.0f, "Expected %g but got %g", 7.0f, order(3, 1));
 }
 
+void transpose()
+{
+	tz::Mat4 order{{std::array<float, 4>{0, 1, 2, 3}, {4, 5, 6, 7}, {8, 9, 10, 11}, {12, 13, 14, 15}}};
+	tz::Mat4 transposed = order.transpose();
+	for(std::size_t i = 0; i < 4; i++)
+	{
+		for(std::size_t j = 0; j < 4; j++)
+		{
+			tz_assert(transposed(i, j) == order(j, i), "Mat4::transpose() gave %g at (%zu, %zu), expected %g", transposed(i, j), i, j, order(j, i));
+		}
+	}
+	tz_assert(transposed.transpose() == order, "Transposing a matrix twice should give the original matrix");
+}
+
+constexpr std::array<float, 5> fovs{0.1f, 0.5f, 1.27f, 2.0f, 3.0f};
+
+constexpr bool nearly_equal_constexpr(float a, float b)
+{
+	float difference = a - b;
+	return (difference < 0.0f ? -difference : difference) <= 1e-6f;
+}
+
+void compile_time()
+{
+	// Everything below is evaluated by the compiler.
+	constexpr tz::Mat4 order{{std::array<float, 4>{0, 1, 2, 3}, {4, 5, 6, 7}, {8, 9, 10, 11}, {12, 13, 14, 15}}};
+	static_assert(order(0, 1) == 4.0f && order(3, 1) == 7.0f);
+	static_assert(order.transpose()(0, 1) == 1.0f && order.transpose()(3, 1) == 13.0f);
+	static_assert(order.transpose().transpose() == order);
+	static_assert(order * tz::Mat4::identity() == order);
+	static_assert((order + 1.0f) - 1.0f == order);
+	static_assert(tz::Mat4::identity() * tz::Vec4{1.0f, 2.0f, 3.0f, 4.0f} == tz::Vec4{1.0f, 2.0f, 3.0f, 4.0f});
+
+	constexpr tz::Mat4 translation = tz::translate({1.0f, 2.0f, 3.0f});
+	static_assert(translation * tz::translate({4.0f, 5.0f, 6.0f}) == tz::translate({5.0f, 7.0f, 9.0f}));
+	static_assert(translation.inverse() == tz::translate({-1.0f, -2.0f, -3.0f}));
+	static_assert(translation.inverse_rigid() == tz::translate({-1.0f, -2.0f, -3.0f}));
+	static_assert((translation * tz::scale({2.0f, 4.0f, 8.0f})).inverse_affine() == tz::scale({0.5f, 0.25f, 0.125f}) * tz::translate({-1.0f, -2.0f, -3.0f}));
+
+	constexpr tz::Mat4 orthographic = tz::orthographic(-2.0f, 2.0f, 1.0f, -1.0f, 0.0f, 10.0f);
+	static_assert(orthographic(0, 0) == 0.5f && orthographic(1, 1) == 1.0f && orthographic(2, 2) == -1.0f);
+
+	// tan(pi / 4) == 1
+	constexpr tz::Mat4 perspective = tz::perspective(1.5707963f, 2.0f, 0.1f, 100.0f);
+	static_assert(nearly_equal_constexpr(perspective(0, 0), 0.5f) && nearly_equal_constexpr(perspective(1, 1), 1.0f));
+	static_assert(perspective(3, 2) == -1.0f && perspective(3, 3) == 0.0f);
+
+	// The compile-time tangent must agree with std::tan, or baked projections would differ from ones computed at runtime.
+	constexpr std::array<tz::Mat4, fovs.size()> baked = []
+	{
+		std::array<tz::Mat4, fovs.size()> projections;
+		for(std::size_t i = 0; i < fovs.size(); i++)
+		{
+			projections[i] = tz::perspective(fovs[i], 1.5f, 0.1f, 1000.0f);
+		}
+		return projections;
+	}();
+	for(std::size_t i = 0; i < fovs.size(); i++)
+	{
+		tz::Mat4 runtime = tz::perspective(fovs[i], 1.5f, 0.1f, 1000.0f);
+		for(std::size_t j = 0; j < 4; j++)
+		{
+			for(std::size_t k = 0; k < 4; k++)
+			{
+				tz_assert(std::abs(baked[i](j, k) - runtime(j, k)) <= 1e-6f * std::max(1.0f, std::abs(runtime(j, k))), "tz::perspective(%g, ...) gave %g at (%zu, %zu) at compile-time, but %g at runtime", fovs[i], baked[i](j, k), j, k, runtime(j, k));
+			}
+		}
+	}
+}
+
 int main()
 {
 	identity();
 	addition();
 	inversion();
+	affine_inversion();
+	gauss_jordan_inversion();
+	model_batch();
 	column_major();
+	transpose();
+	compile_time();
 }
\ No newline at end of file
@@ -0,0 +1,114 @@
+#include "core/assert.hpp"
+#include "core/profile.hpp"
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+std::string read_file(const char* path)
+{
+    std::string contents;
+    std::FILE* file = std::fopen(path, "r");
+    tz_assert(file != nullptr, "Could not re-open chrome trace %s", path);
+    for(int c = std::fgetc(file); c != EOF; c = std::fgetc(file))
+    {
+        contents.push_back(static_cast<char>(c));
+    }
+    std::fclose(file);
+    return contents;
+}
+
+void zones_are_timed()
+{
+    tz::profile_clear();
+    std::uint64_t before = tz::profile_now();
+    {
+        tz::ProfileScope outer{"outer"};
+        {
+            tz::ProfileScope inner{"inner"};
+        }
+    }
+    std::uint64_t after = tz::profile_now();
+    tz_assert(before <= after, "tz::profile_now() went backwards (%llu then %llu)", static_cast<unsigned long long>(before), static_cast<unsigned long long>(after));
+    tz_assert(tz::profile_zone_count() == 2, "Expected 2 zones, got %zu", tz::profile_zone_count());
+}
+
+void many_zones_many_threads()
+{
+    tz::profile_clear();
+    // More zones than fit in a single chunk, so each thread has to grow its buffer.
+    constexpr std::size_t thread_count = 4;
+    constexpr std::size_t zones_per_thread = 10000;
+    std::vector<std::thread> threads;
+    for(std::size_t i = 0; i < thread_count; i++)
+    {
+        threads.emplace_back([]()
+        {
+            for(std::size_t j = 0; j < zones_per_thread; j++)
+            {
+                tz::ProfileScope zone{"worker"};
+            }
+        });
+    }
+    for(std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    tz_assert(tz::profile_zone_count() == thread_count * zones_per_thread, "Expected %zu zones, got %zu", thread_count * zones_per_thread, tz::profile_zone_count());
+    tz::profile_clear();
+    tz_assert(tz::profile_zone_count() == 0, "Expected no zones after clearing, got %zu", tz::profile_zone_count());
+}
+
+void chrome_trace_written()
+{
+    tz::profile_clear();
+    {
+        tz::ProfileScope zone{"needs \"escaping\""};
+        tz_profile_scope("macro zone");
+    }
+    const char* path = "tz_profile_test_trace.json";
+    tz_assert(tz::profile_write_chrome_trace(path), "Failed to write chrome trace to %s", path);
+    std::string contents = read_file(path);
+    std::remove(path);
+    tz_assert(contents.starts_with("{") && contents.find("\"traceEvents\":[") != std::string::npos, "Chrome trace is missing its traceEvents array");
+    tz_assert(contents.find("\"name\":\"needs \\\"escaping\\\"\",\"ph\":\"X\"") != std::string::npos, "Chrome trace did not contain the escaped zone name");
+    #if TZ_PROFILE
+        tz_assert(contents.find("\"macro zone\"") != std::string::npos, "tz_profile_scope did not record a zone, even though TZ_PROFILE is enabled");
+    #else
+        tz_assert(contents.find("\"macro zone\"") == std::string::npos, "tz_profile_scope recorded a zone, even though TZ_PROFILE is disabled");
+    #endif
+}
+
+void exited_threads_are_recycled()
+{
+    tz::profile_clear();
+    const char* path = "tz_profile_test_recycle.json";
+    std::string first_thread_id;
+    for(std::size_t i = 0; i < 100; i++)
+    {
+        std::thread{[](){tz::ProfileScope zone{"short-lived"};}}.join();
+        tz_assert(tz::profile_zone_count() == 1, "Zone from exited thread was lost before being written out (iteration %zu)", i);
+        tz_assert(tz::profile_write_chrome_trace(path), "Failed to write chrome trace to %s", path);
+        std::string contents = read_file(path);
+        std::size_t zone = contents.find("\"short-lived\"");
+        tz_assert(zone != std::string::npos && contents.find("\"short-lived\"", zone + 1) == std::string::npos, "Expected exactly one zone from the exited thread in the trace (iteration %zu)", i);
+        // Once written out, the exited thread's buffer is emptied and handed to the next thread, which therefore gets the same thread id.
+        tz_assert(tz::profile_zone_count() == 0, "Exited thread's zones were kept after being written out (iteration %zu)", i);
+        std::size_t tid = contents.find("\"tid\":", zone);
+        std::string thread_id = contents.substr(tid, contents.find(',', tid) - tid);
+        if(i == 0)
+        {
+            first_thread_id = thread_id;
+        }
+        tz_assert(thread_id == first_thread_id, "Exited thread's buffer was not recycled (iteration %zu)", i);
+    }
+    std::remove(path);
+}
+
+int main()
+{
+    zones_are_timed();
+    many_zones_many_threads();
+    chrome_trace_written();
+    exited_threads_are_recycled();
+}
@@ -0,0 +1,112 @@
+#include "core/assert.hpp"
+#include "core/matrix_transform.hpp"
+#include "core/quaternion.hpp"
+#include <cmath>
+#include <random>
+
+bool nearly_equal(float a, float b)
+{
+	return std::abs(a - b) <= 1e-4f * std::max(1.0f, std::max(std::abs(a), std::abs(b)));
+}
+
+bool nearly_equal(const tz::Mat4& a, const tz::Mat4& b)
+{
+	for(std::size_t i = 0; i < 4; i++)
+	{
+		for(std::size_t j = 0; j < 4; j++)
+		{
+			if(!nearly_equal(a(i, j), b(i, j)))
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+// q and -q are the same rotation.
+bool same_rotation(const tz::Quaternion& a, const tz::Quaternion& b)
+{
+	return std::abs(std::abs(a.dot(b)) - 1.0f) <= 1e-4f;
+}
+
+tz::Vec3 random_vec3(std::mt19937& rng, float min, float max)
+{
+	std::uniform_real_distribution<float> dist{min, max};
+	return tz::Vec3{std::array<float, 3>{dist(rng), dist(rng), dist(rng)}};
+}
+
+void euler_angles()
+{
+	std::mt19937 rng{1};
+	for(std::size_t test = 0; test < 100; test++)
+	{
+		tz::Vec3 rotation = random_vec3(rng, -6.0f, 6.0f);
+		tz::Quaternion q = tz::Quaternion::from_euler(rotation);
+		tz_assert(nearly_equal(q.length(), 1.0f), "Quaternion::from_euler gave a non-unit quaternion (length %g)", q.length());
+		tz_assert(nearly_equal(q.to_mat4(), tz::rotate(rotation)), "Quaternion::from_euler(...).to_mat4() != tz::rotate(...) for rotation {%g, %g, %g}", rotation[0], rotation[1], rotation[2]);
+
+		tz::Vec3 position = random_vec3(rng, -100.0f, 100.0f);
+		tz::Vec3 scale = random_vec3(rng, 0.5f, 2.0f);
+		tz_assert(nearly_equal(tz::model(position, q, scale), tz::model(position, rotation, scale)), "tz::model with a quaternion gave a different matrix to tz::model with euler angles");
+		tz_assert(nearly_equal(tz::view(position, q), tz::view(position, rotation)), "tz::view with a quaternion gave a different matrix to tz::view with euler angles");
+	}
+	tz_assert(tz::Quaternion::from_euler({0.0f, 0.0f, 0.0f}) == tz::Quaternion::identity(), "Quaternion::from_euler of no rotation should be the identity quaternion");
+	tz_assert(tz::Quaternion::identity().to_mat4() == tz::Mat4::identity(), "Quaternion::identity().to_mat4() should be the identity matrix");
+}
+
+void multiplication()
+{
+	std::mt19937 rng{2};
+	for(std::size_t test = 0; test < 100; test++)
+	{
+		tz::Quaternion a = tz::Quaternion::from_euler(random_vec3(rng, -3.0f, 3.0f));
+		tz::Quaternion b = tz::Quaternion::from_euler(random_vec3(rng, -3.0f, 3.0f));
+		tz::Quaternion product = a * b;
+		tz::Quaternion expected;
+		tz::simd::scalar::quat_multiply(a.data(), b.data(), expected.data());
+		for(std::size_t i = 0; i < 4; i++)
+		{
+			tz_assert(nearly_equal(product[i], expected[i]), "Quaternion::operator* (%s) gave %g at %zu, expected %g", tz::simd::get_instruction_set_name(), product[i], i, expected[i]);
+		}
+		// Composing quaternions must compose their rotations in the same order as matrices do.
+		tz_assert(nearly_equal(product.to_mat4(), a.to_mat4() * b.to_mat4()), "(a * b).to_mat4() != a.to_mat4() * b.to_mat4()");
+		tz_assert(same_rotation(a * a.conjugate(), tz::Quaternion::identity()), "A quaternion multiplied by its conjugate should give no rotation");
+
+		tz::Vec3 v = random_vec3(rng, -10.0f, 10.0f);
+		tz::Vec3 rotated = a.rotate(v);
+		tz::Mat4 m = a.to_mat4();
+		for(std::size_t i = 0; i < 3; i++)
+		{
+			float expected_rotated = m(i, 0) * v[0] + m(i, 1) * v[1] + m(i, 2) * v[2];
+			tz_assert(nearly_equal(rotated[i], expected_rotated), "Quaternion::rotate gave %g at %zu, expected %g", rotated[i], i, expected_rotated);
+		}
+	}
+}
+
+void interpolation()
+{
+	tz::Quaternion a = tz::Quaternion::from_axis_angle({0.0f, 1.0f, 0.0f}, 0.0f);
+	tz::Quaternion b = tz::Quaternion::from_axis_angle({0.0f, 1.0f, 0.0f}, 2.0f);
+	tz_assert(same_rotation(tz::slerp(a, b, 0.0f), a) && same_rotation(tz::slerp(a, b, 1.0f), b), "tz::slerp endpoints are wrong");
+	tz_assert(same_rotation(tz::nlerp(a, b, 0.0f), a) && same_rotation(tz::nlerp(a, b, 1.0f), b), "tz::nlerp endpoints are wrong");
+	// slerp rotates at a constant rate, so a quarter of the way along is a quarter of the angle.
+	tz_assert(same_rotation(tz::slerp(a, b, 0.25f), tz::Quaternion::from_axis_angle({0.0f, 1.0f, 0.0f}, 0.5f)), "tz::slerp(a, b, 0.25) should rotate by a quarter of the angle");
+	// Halfway is the same for both.
+	tz_assert(same_rotation(tz::nlerp(a, b, 0.5f), tz::Quaternion::from_axis_angle({0.0f, 1.0f, 0.0f}, 1.0f)), "tz::nlerp(a, b, 0.5) should rotate by half of the angle");
+
+	// -b is the same rotation as b, and both should interpolate the short way round.
+	tz::Quaternion halfway = tz::slerp(a, -b, 0.5f);
+	tz_assert(same_rotation(halfway, tz::Quaternion::from_axis_angle({0.0f, 1.0f, 0.0f}, 1.0f)), "tz::slerp should take the shortest path");
+	tz_assert(nearly_equal(tz::nlerp(a, -b, 0.3f).length(), 1.0f), "tz::nlerp should give a unit quaternion");
+	// Nearly-identical rotations fall back to nlerp rather than dividing by sin(~0).
+	tz::Quaternion c = tz::Quaternion::from_axis_angle({1.0f, 0.0f, 0.0f}, 1e-4f);
+	tz_assert(nearly_equal(tz::slerp(a, c, 0.5f).length(), 1.0f), "tz::slerp between nearly-identical rotations should give a unit quaternion");
+}
+
+int main()
+{
+	euler_angles();
+	multiplication();
+	interpolation();
+}
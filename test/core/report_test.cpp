@@ -0,0 +1,96 @@
+#include "core/assert.hpp"
+#include "core/report.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+const std::string log_path = (std::filesystem::temp_directory_path() / "tz_report_test.log").string();
+
+std::string read_log()
+{
+    tz::report_flush();
+    std::string contents;
+    std::FILE* file = std::fopen(log_path.c_str(), "r");
+    tz_assert(file != nullptr, "Could not open %s", log_path.c_str());
+    for(int c = std::fgetc(file); c != EOF; c = std::fgetc(file))
+    {
+        contents.push_back(static_cast<char>(c));
+    }
+    std::fclose(file);
+    return contents;
+}
+
+std::size_t count_occurrences(const std::string& str, const std::string& substr)
+{
+    std::size_t count = 0;
+    for(std::size_t pos = str.find(substr); pos != std::string::npos; pos = str.find(substr, pos + substr.size()))
+    {
+        count++;
+    }
+    return count;
+}
+
+void arguments_survive()
+{
+    {
+        // The string is gone long before the background thread gets round to formatting it.
+        std::string temporary = "temporary string";
+        tz_report("Args: %d %zu %.2f %s %c", -5, std::size_t{123}, 2.5f, temporary.c_str(), 'x');
+        temporary = "overwritten";
+    }
+    const char* null_string = nullptr;
+    tz_report("Null: %s", null_string);
+    tz_warning_report("Careful");
+    std::string log = read_log();
+    tz_assert(log.find("\"Args: -5 123 2.50 temporary string x\" -- ") != std::string::npos, "Report arguments were not formatted correctly");
+    tz_assert(log.find("\"Null: (null)\"") != std::string::npos, "Null string argument was not handled");
+    tz_assert(log.find("[Warning] \"Careful\"") != std::string::npos, "Warning report was not labelled");
+}
+
+void many_threads()
+{
+    // Enough reports to fill each thread's ring several times over.
+    constexpr std::size_t thread_count = 4;
+    constexpr std::size_t reports_per_thread = 5000;
+    std::vector<std::thread> threads;
+    for(std::size_t i = 0; i < thread_count; i++)
+    {
+        threads.emplace_back([i]()
+        {
+            for(std::size_t j = 0; j < reports_per_thread; j++)
+            {
+                tz_report("Thread report %zu/%zu", i, j);
+            }
+        });
+    }
+    for(std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    std::string log = read_log();
+    std::size_t count = count_occurrences(log, "Thread report ");
+    tz_assert(count == thread_count * reports_per_thread, "Expected %zu thread reports, found %zu", thread_count * reports_per_thread, count);
+    tz_assert(log.find("Thread report 3/4999") != std::string::npos, "Last report from the last thread is missing");
+}
+
+void huge_report()
+{
+    // Too big for a ring, so this is written out immediately instead.
+    std::string huge(100000, 'z');
+    tz_report("Huge: %s", huge.c_str());
+    std::string log = read_log();
+    tz_assert(log.find("Huge: " + huge) != std::string::npos, "Huge report is missing");
+}
+
+int main()
+{
+    std::FILE* redirected = std::freopen(log_path.c_str(), "w", stdout);
+    tz_assert(redirected != nullptr, "Could not redirect stdout to %s", log_path.c_str());
+    arguments_survive();
+    many_threads();
+    huge_report();
+    tz::report_flush();
+    std::remove(log_path.c_str());
+}
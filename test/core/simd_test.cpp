@@ -0,0 +1,147 @@
+#include "core/assert.hpp"
+#include "core/matrix.hpp"
+#include "core/simd.hpp"
+#include "core/vector.hpp"
+#include <cmath>
+#include <random>
+
+// FMA variants round differently to the scalar code, so allow some slack.
+bool nearly_equal(float a, float b)
+{
+	return std::abs(a - b) <= 1e-4f * std::max(1.0f, std::max(std::abs(a), std::abs(b)));
+}
+
+tz::Mat4 random_matrix(std::mt19937& rng)
+{
+	std::uniform_real_distribution<float> dist{-10.0f, 10.0f};
+	tz::Mat4 m;
+	for(std::size_t i = 0; i < 4; i++)
+	{
+		for(std::size_t j = 0; j < 4; j++)
+		{
+			m(i, j) = dist(rng);
+		}
+	}
+	return m;
+}
+
+tz::Vec4 random_vec4(std::mt19937& rng)
+{
+	std::uniform_real_distribution<float> dist{-10.0f, 10.0f};
+	return tz::Vec4{std::array<float, 4>{dist(rng), dist(rng), dist(rng), dist(rng)}};
+}
+
+void matrix_multiply()
+{
+	std::mt19937 rng{1};
+	for(std::size_t test = 0; test < 100; test++)
+	{
+		tz::Mat4 a = random_matrix(rng);
+		tz::Mat4 b = random_matrix(rng);
+		tz::Mat4 result = a * b;
+		for(std::size_t i = 0; i < 4; i++)
+		{
+			for(std::size_t j = 0; j < 4; j++)
+			{
+				float expected = 0.0f;
+				for(std::size_t k = 0; k < 4; k++)
+				{
+					expected += a(i, k) * b(k, j);
+				}
+				tz_assert(nearly_equal(result(i, j), expected), "Mat4 * Mat4 (%s) gave %g at (%zu, %zu), expected %g", tz::simd::get_instruction_set_name(), result(i, j), i, j, expected);
+			}
+		}
+		// Multiplying a matrix by itself in-place must not read results it has already written.
+		tz::Mat4 squared = a * a;
+		a *= a;
+		tz_assert(a == squared, "Mat4 *= itself (%s) gave a different result to Mat4 * itself", tz::simd::get_instruction_set_name());
+	}
+}
+
+void matrix_vector_multiply()
+{
+	std::mt19937 rng{2};
+	for(std::size_t test = 0; test < 100; test++)
+	{
+		tz::Mat4 m = random_matrix(rng);
+		tz::Vec4 v = random_vec4(rng);
+		tz::Vec4 result = m * v;
+		float expected[4];
+		tz::simd::scalar::mat4_columns_dot(&m(0, 0), v.data(), expected);
+		for(std::size_t i = 0; i < 4; i++)
+		{
+			tz_assert(nearly_equal(result[i], expected[i]), "Mat4 * Vec4 (%s) gave %g at %zu, expected %g", tz::simd::get_instruction_set_name(), result[i], i, expected[i]);
+		}
+	}
+}
+
+void matrix_inverse()
+{
+	std::mt19937 rng{4};
+	for(std::size_t test = 0; test < 100; test++)
+	{
+		tz::Mat4 m = random_matrix(rng);
+		tz::Mat4 expected;
+		float expected_determinant = tz::simd::scalar::mat4_inverse(&m(0, 0), &expected(0, 0));
+		tz::Mat4 result;
+		float determinant = tz::simd::mat4_inverse(&m(0, 0), &result(0, 0));
+		tz_assert(nearly_equal(determinant, expected_determinant), "mat4_inverse (%s) gave determinant %g, expected %g", tz::simd::get_instruction_set_name(), determinant, expected_determinant);
+		for(std::size_t i = 0; i < 4; i++)
+		{
+			for(std::size_t j = 0; j < 4; j++)
+			{
+				tz_assert(nearly_equal(result(i, j), expected(i, j)), "mat4_inverse (%s) gave %g at (%zu, %zu), expected %g", tz::simd::get_instruction_set_name(), result(i, j), i, j, expected(i, j));
+			}
+		}
+	}
+
+	tz::Mat4 singular = tz::Mat4::identity();
+	singular(2, 2) = 0.0f;
+	tz::Mat4 untouched = tz::Mat4::identity();
+	tz_assert(tz::simd::mat4_inverse(&singular(0, 0), &untouched(0, 0)) == 0.0f, "mat4_inverse (%s) should report a zero determinant for a singular matrix", tz::simd::get_instruction_set_name());
+	tz_assert(untouched == tz::Mat4::identity(), "mat4_inverse (%s) should leave the output unchanged for a singular matrix", tz::simd::get_instruction_set_name());
+}
+
+void vector_operations()
+{
+	std::mt19937 rng{3};
+	for(std::size_t test = 0; test < 100; test++)
+	{
+		tz::Vec4 a = random_vec4(rng);
+		tz::Vec4 b = random_vec4(rng);
+		float expected_dot = tz::simd::scalar::vec4_dot(a.data(), b.data());
+		tz_assert(nearly_equal(a.dot(b), expected_dot), "Vec4::dot (%s) gave %g, expected %g", tz::simd::get_instruction_set_name(), a.dot(b), expected_dot);
+		float expected_length = tz::simd::scalar::vec4_length(a.data());
+		tz_assert(nearly_equal(a.length(), expected_length), "Vec4::length (%s) gave %g, expected %g", tz::simd::get_instruction_set_name(), a.length(), expected_length);
+
+		tz::Vec4 normalised = a.normalised();
+		tz::Vec4 expected_normalised = a;
+		tz::simd::scalar::vec4_normalise(expected_normalised.data());
+		for(std::size_t i = 0; i < 4; i++)
+		{
+			tz_assert(nearly_equal(normalised[i], expected_normalised[i]), "Vec4::normalise (%s) gave %g at %zu, expected %g", tz::simd::get_instruction_set_name(), normalised[i], i, expected_normalised[i]);
+		}
+
+		tz::Vec3 c{std::array<float, 3>{a[0], a[1], a[2]}};
+		tz::Vec3 d{std::array<float, 3>{b[0], b[1], b[2]}};
+		tz::Vec3 cross = tz::cross(c, d);
+		float expected_cross[3];
+		tz::simd::scalar::vec3_cross(c.data(), d.data(), expected_cross);
+		for(std::size_t i = 0; i < 3; i++)
+		{
+			tz_assert(nearly_equal(cross[i], expected_cross[i]), "tz::cross (%s) gave %g at %zu, expected %g", tz::simd::get_instruction_set_name(), cross[i], i, expected_cross[i]);
+		}
+	}
+
+	tz::Vec4 zero{0.0f, 0.0f, 0.0f, 0.0f};
+	zero.normalise();
+	tz_assert(zero[0] == 0.0f && zero[1] == 0.0f && zero[2] == 0.0f && zero[3] == 0.0f, "Normalising a zero Vec4 (%s) should leave it unchanged", tz::simd::get_instruction_set_name());
+}
+
+int main()
+{
+	matrix_multiply();
+	matrix_vector_multiply();
+	matrix_inverse();
+	vector_operations();
+}
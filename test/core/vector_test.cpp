@@ -55,9 +55,21 @@ void cross()
 	// (2, 3, 4) × (5, 6, 7) = (−3, 6, −3)
 }
 
+void compile_time()
+{
+	constexpr tz::Vec4 a{1.0f, 2.0f, 3.0f, 4.0f};
+	constexpr tz::Vec4 b{8.0f, 7.0f, 6.0f, 5.0f};
+	static_assert(a + b == tz::Vec4{9.0f, 9.0f, 9.0f, 9.0f});
+	static_assert(b - a == tz::Vec4{7.0f, 5.0f, 3.0f, 1.0f});
+	static_assert(a * 2.0f == tz::Vec4{2.0f, 4.0f, 6.0f, 8.0f} && (a * 2.0f) / 2.0f == a);
+	static_assert(a.dot(b) == 60.0f);
+	static_assert(tz::cross(tz::Vec3{2.0f, 3.0f, 4.0f}, tz::Vec3{5.0f, 6.0f, 7.0f}) == tz::Vec3{-3.0f, 6.0f, -3.0f});
+}
+
 int main()
 {
 	addition_subtraction();
 	dot();
 	cross();
+	compile_time();
 }
\ No newline at end of file
@@ -0,0 +1,48 @@
+#include "core/assert.hpp"
+#include "core/worker_pool.hpp"
+#include <atomic>
+#include <vector>
+
+void every_job_runs_once(tz::WorkerPool& pool, std::size_t job_count)
+{
+    std::vector<std::atomic<int>> runs(job_count);
+    pool.run(job_count, [&runs](std::size_t i)
+    {
+        runs[i].fetch_add(1, std::memory_order_relaxed);
+    });
+    for(std::size_t i = 0; i < job_count; i++)
+    {
+        tz_assert(runs[i].load() == 1, "WorkerPool with %zu threads ran job %zu/%zu %d times, expected once", pool.get_thread_count(), i, job_count, runs[i].load());
+    }
+}
+
+void jobs_run_once()
+{
+    for(std::size_t thread_count : {0, 1, 3})
+    {
+        tz::WorkerPool pool{thread_count};
+        tz_assert(pool.get_thread_count() == thread_count, "WorkerPool has %zu threads, expected %zu", pool.get_thread_count(), thread_count);
+        for(std::size_t job_count : {0, 1, 2, 4, 100})
+        {
+            every_job_runs_once(pool, job_count);
+        }
+    }
+}
+
+void pool_is_reusable()
+{
+    // Back-to-back batches, so workers are still finishing one batch as the next is handed out.
+    tz::WorkerPool pool{3};
+    for(std::size_t i = 0; i < 2000; i++)
+    {
+        every_job_runs_once(pool, 4);
+    }
+    tz::WorkerPool moved{std::move(pool)};
+    every_job_runs_once(moved, 16);
+}
+
+int main()
+{
+    jobs_run_once();
+    pool_is_reusable();
+}
@@ -0,0 +1,61 @@
+#include "core/assert.hpp"
+#include "gl/impl/frontend/common/dirty_ranges.hpp"
+#include "gl/resource.hpp"
+#include <array>
+
+void ranges_coalesce()
+{
+    tz::gl::DirtyRangeList list;
+    tz_assert(list.empty() && !list.is_explicit(), "New DirtyRangeList should be empty and not explicit");
+    list.add(100, 10);
+    list.add(0, 8);
+    list.add(105, 20);
+    list.add(8, 4);
+    list.add(300, 0);
+    list.add(200, 1);
+    std::span<const tz::gl::DirtyRange> ranges = list.get_ranges();
+    tz_assert(ranges.size() == 3, "Expected 3 coalesced ranges, got %zu", ranges.size());
+    tz_assert((ranges[0] == tz::gl::DirtyRange{.offset = 0, .length = 12}), "First range wrong (%zu, %zu)", ranges[0].offset, ranges[0].length);
+    tz_assert((ranges[1] == tz::gl::DirtyRange{.offset = 100, .length = 25}), "Second range wrong (%zu, %zu)", ranges[1].offset, ranges[1].length);
+    tz_assert((ranges[2] == tz::gl::DirtyRange{.offset = 200, .length = 1}), "Third range wrong (%zu, %zu)", ranges[2].offset, ranges[2].length);
+    list.clear();
+    tz_assert(list.empty() && list.is_explicit(), "Cleared DirtyRangeList should be empty but still explicit");
+}
+
+void sequential_writes_extend()
+{
+    tz::gl::DirtyRangeList list;
+    for(std::size_t i = 0; i < 64; i++)
+    {
+        list.add(i * 4, 4);
+    }
+    tz_assert((list.get_ranges().size() == 1 && list.get_ranges().front() == tz::gl::DirtyRange{.offset = 0, .length = 256}), "Sequential writes should produce a single range");
+}
+
+void writer_marks_dirty()
+{
+    std::array<std::byte, 64> data{};
+    tz::gl::DirtyRangeList list;
+    {
+        tz::gl::DynamicDataWriter writer{std::span<std::byte>{data}.subspan(16, 8), 16, list};
+        tz_assert(list.empty(), "DynamicDataWriter should not mark anything dirty until it is destroyed");
+        writer.bytes()[0] = std::byte{1};
+    }
+    tz_assert((list.get_ranges().size() == 1 && list.get_ranges().front() == tz::gl::DirtyRange{.offset = 16, .length = 8}), "DynamicDataWriter did not mark its range dirty");
+
+    std::array<float, 8> values{};
+    tz::gl::DynamicBufferResource resource{tz::gl::BufferData::from_array<float>(values)};
+    {
+        tz::gl::DynamicDataWriter writer = resource.write(sizeof(float) * 2, sizeof(float) * 3);
+        tz_assert(writer.bytes().size_bytes() == sizeof(float) * 3, "Resource writer covers %zu bytes, expected %zu", writer.bytes().size_bytes(), sizeof(float) * 3);
+        tz_assert(writer.bytes().data() == resource.get_resource_bytes_dynamic().data() + sizeof(float) * 2, "Resource writer does not point at the requested range");
+    }
+    resource.mark_dirty(0, sizeof(float));
+}
+
+int main()
+{
+    ranges_coalesce();
+    sequential_writes_extend();
+    writer_marks_dirty();
+}
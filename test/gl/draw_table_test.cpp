@@ -0,0 +1,147 @@
+#include "core/assert.hpp"
+#include "gl/input.hpp"
+#include "gl/impl/frontend/common/draw_table.hpp"
+#include <unordered_map>
+
+tz::gl::Mesh make_mesh(std::size_t triangle_count)
+{
+    tz::gl::Mesh mesh;
+    for(std::size_t i = 0; i < triangle_count; i++)
+    {
+        mesh.vertices.add(tz::gl::Vertex{{-0.5f, -0.5f, 0.0f}, {1.0f, 0.0f}, {}, {}, {}});
+        mesh.vertices.add(tz::gl::Vertex{{0.5f, -0.5f, 0.0f}, {0.0f, 0.0f}, {}, {}, {}});
+        mesh.vertices.add(tz::gl::Vertex{{0.5f, 0.5f, 0.0f}, {0.0f, 1.0f}, {}, {}, {}});
+        auto idx = static_cast<unsigned int>(i * 3);
+        mesh.indices.add(idx);
+        mesh.indices.add(idx + 1);
+        mesh.indices.add(idx + 2);
+    }
+    return mesh;
+}
+
+bool operator==(const tz::gl::DrawIndirectCommand& lhs, const tz::gl::DrawIndirectCommand& rhs)
+{
+    return lhs.index_count == rhs.index_count && lhs.instance_count == rhs.instance_count && lhs.first_index == rhs.first_index && lhs.vertex_offset == rhs.vertex_offset && lhs.first_instance == rhs.first_instance;
+}
+
+void basic_gather()
+{
+    // Inputs: static (1 tri), dynamic (2 tris), static (2 tris), dynamic (1 tri)
+    tz::gl::MeshInput s0{make_mesh(1)};
+    tz::gl::MeshDynamicInput d0{make_mesh(2)};
+    tz::gl::MeshInput s1{make_mesh(2)};
+    tz::gl::MeshDynamicInput d1{make_mesh(1)};
+    std::vector<const tz::gl::IRendererInput*> inputs{&s0, &d0, &s1, &d1};
+    tz::gl::RendererDrawTable table{inputs};
+
+    tz_assert(table.input_count_of(tz::gl::RendererInputDataAccess::StaticFixed) == 2, "Expected 2 static inputs, got %zu", table.input_count_of(tz::gl::RendererInputDataAccess::StaticFixed));
+    tz_assert(table.input_count_of(tz::gl::RendererInputDataAccess::DynamicFixed) == 2, "Expected 2 dynamic inputs, got %zu", table.input_count_of(tz::gl::RendererInputDataAccess::DynamicFixed));
+
+    auto handle = [](std::size_t i){return tz::gl::RendererInputHandle{static_cast<tz::HandleValue>(i)};};
+    tz::gl::RendererDrawList draws{handle(3), handle(2), handle(1), handle(0), handle(2)};
+    std::vector<tz::gl::DrawIndirectCommand> cmds(draws.length());
+    tz::gl::RendererDrawCounts counts = table.gather(draws, cmds);
+    tz_assert(counts.static_draws == 3 && counts.dynamic_draws == 2, "Unexpected draw counts (static = %zu, dynamic = %zu)", counts.static_draws, counts.dynamic_draws);
+    tz_assert(counts == table.count(draws), "RendererDrawTable::count disagrees with RendererDrawTable::gather");
+
+    // Static draws first, in draw list order: s1, s0, s1. Then dynamic: d1, d0.
+    const tz::gl::DrawIndirectCommand expected_s0{.index_count = 3, .instance_count = 1, .first_index = 0, .vertex_offset = 0, .first_instance = 0};
+    const tz::gl::DrawIndirectCommand expected_s1{.index_count = 6, .instance_count = 1, .first_index = 3, .vertex_offset = 3, .first_instance = 0};
+    const tz::gl::DrawIndirectCommand expected_d0{.index_count = 6, .instance_count = 1, .first_index = 0, .vertex_offset = 0, .first_instance = 0};
+    const tz::gl::DrawIndirectCommand expected_d1{.index_count = 3, .instance_count = 1, .first_index = 6, .vertex_offset = 6, .first_instance = 0};
+    tz_assert(cmds[0] == expected_s1 && cmds[1] == expected_s0 && cmds[2] == expected_s1, "Static draw commands were wrong");
+    tz_assert(cmds[3] == expected_d1 && cmds[4] == expected_d0, "Dynamic draw commands were wrong");
+}
+
+void rebased_static_draws()
+{
+    tz::gl::MeshInput s0{make_mesh(1)};
+    tz::gl::MeshDynamicInput d0{make_mesh(1)};
+    std::vector<const tz::gl::IRendererInput*> inputs{&s0, &d0};
+    tz::gl::RendererDrawTable table{inputs};
+    // As if the static geometry lives part-way into a shared buffer.
+    table.rebase_static(30, 20);
+
+    auto handle = [](std::size_t i){return tz::gl::RendererInputHandle{static_cast<tz::HandleValue>(i)};};
+    tz::gl::RendererDrawList draws{handle(0), handle(1)};
+    std::vector<tz::gl::DrawIndirectCommand> cmds(draws.length());
+    table.gather(draws, cmds);
+    const tz::gl::DrawIndirectCommand expected_s0{.index_count = 3, .instance_count = 1, .first_index = 30, .vertex_offset = 20, .first_instance = 0};
+    const tz::gl::DrawIndirectCommand expected_d0{.index_count = 3, .instance_count = 1, .first_index = 0, .vertex_offset = 0, .first_instance = 0};
+    tz_assert(cmds[0] == expected_s0, "Static draw command was not rebased");
+    tz_assert(cmds[1] == expected_d0, "Dynamic draw command should not be affected by rebasing static draws");
+}
+
+void gather_matches_map_rebuild()
+{
+    // A large draw list should gather to exactly what rebuilding an input->command map every time (which is what the renderers used to do) produces.
+    constexpr std::size_t input_count = 16384;
+    std::vector<tz::gl::MeshInput> static_inputs;
+    std::vector<tz::gl::MeshDynamicInput> dynamic_inputs;
+    static_inputs.reserve(input_count / 2);
+    dynamic_inputs.reserve(input_count / 2);
+    std::vector<const tz::gl::IRendererInput*> inputs;
+    for(std::size_t i = 0; i < input_count; i++)
+    {
+        if(i % 2 == 0)
+        {
+            inputs.push_back(&static_inputs.emplace_back(make_mesh(1 + (i % 3))));
+        }
+        else
+        {
+            inputs.push_back(&dynamic_inputs.emplace_back(make_mesh(1 + (i % 5))));
+        }
+    }
+
+    tz::gl::RendererDrawList draws;
+    for(std::size_t i = 0; i < input_count; i++)
+    {
+        // Scatter the handles a little so we're not just walking the table in order.
+        draws.add(tz::gl::RendererInputHandle{static_cast<tz::HandleValue>((i * 7919) % input_count)});
+    }
+
+    tz::gl::RendererDrawTable table{inputs};
+    std::vector<tz::gl::DrawIndirectCommand> cmds(draws.length());
+    table.gather(draws, cmds);
+
+    std::unordered_map<const tz::gl::IRendererInput*, tz::gl::DrawIndirectCommand> input_draws;
+    std::unordered_map<const tz::gl::IRendererInput*, tz::gl::DrawIndirectCommand> dynamic_input_draws;
+    std::int32_t static_vtx_count = 0, dynamic_vtx_count = 0;
+    std::uint32_t static_idx_count = 0, dynamic_idx_count = 0;
+    for(const tz::gl::IRendererInput* input : inputs)
+    {
+        bool is_static = input->data_access() == tz::gl::RendererInputDataAccess::StaticFixed;
+        std::int32_t& vtx_count = is_static ? static_vtx_count : dynamic_vtx_count;
+        std::uint32_t& idx_count = is_static ? static_idx_count : dynamic_idx_count;
+        (is_static ? input_draws : dynamic_input_draws)[input] = {.index_count = static_cast<std::uint32_t>(input->index_count()), .instance_count = 1, .first_index = idx_count, .vertex_offset = vtx_count, .first_instance = 0};
+        vtx_count += input->vertex_count();
+        idx_count += input->index_count();
+    }
+    std::vector<tz::gl::DrawIndirectCommand> map_cmds, map_cmds_dynamic;
+    for(tz::gl::RendererInputHandle handle : draws)
+    {
+        const tz::gl::IRendererInput* input = inputs[static_cast<std::size_t>(static_cast<tz::HandleValue>(handle))];
+        if(input->data_access() == tz::gl::RendererInputDataAccess::StaticFixed)
+        {
+            map_cmds.push_back(input_draws[input]);
+        }
+        else
+        {
+            map_cmds_dynamic.push_back(dynamic_input_draws[input]);
+        }
+    }
+    map_cmds.insert(map_cmds.end(), map_cmds_dynamic.begin(), map_cmds_dynamic.end());
+
+    tz_assert(map_cmds.size() == cmds.size(), "Draw table produced %zu commands, expected %zu", cmds.size(), map_cmds.size());
+    for(std::size_t i = 0; i < cmds.size(); i++)
+    {
+        tz_assert(cmds[i] == map_cmds[i], "Draw table command %zu did not match the expected command", i);
+    }
+}
+
+int main()
+{
+    basic_gather();
+    rebased_static_draws();
+    gather_matches_map_rebuild();
+}
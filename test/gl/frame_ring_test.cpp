@@ -0,0 +1,92 @@
+#include "core/assert.hpp"
+#include "gl/impl/frontend/common/frame_ring.hpp"
+#include <algorithm>
+#include <vector>
+
+bool slice_matches(tz::gl::RendererFrameRing& ring, const std::vector<std::byte>& slice)
+{
+    return std::equal(ring.data().begin(), ring.data().end(), slice.begin());
+}
+
+void first_publish_copies_everything()
+{
+    std::vector<std::byte> initial(1000, std::byte{7});
+    tz::gl::RendererFrameRing ring{initial, 3};
+    tz_assert(ring.size() == initial.size(), "RendererFrameRing has wrong size. Expected %zu, got %zu", initial.size(), ring.size());
+    tz_assert(ring.get_slice_count() == 3, "RendererFrameRing has wrong slice count. Expected 3, got %zu", ring.get_slice_count());
+    for(std::size_t i = 0; i < ring.get_slice_count(); i++)
+    {
+        std::vector<std::byte> slice(ring.size());
+        std::size_t copied = ring.publish(i, slice);
+        tz_assert(copied == ring.size(), "First publish of slice %zu should copy everything (%zu bytes), but copied %zu", i, ring.size(), copied);
+        tz_assert(slice_matches(ring, slice), "Slice %zu does not match after first publish", i);
+        tz_assert(ring.publish(i, slice) == 0, "Publishing slice %zu again with no changes should copy nothing", i);
+    }
+}
+
+void only_dirty_blocks_copied()
+{
+    constexpr std::size_t block = tz::gl::RendererFrameRing::block_size;
+    std::vector<std::byte> initial(block * 8 + 10);
+    tz::gl::RendererFrameRing ring{initial, 2};
+    std::vector<std::byte> slice0(ring.size()), slice1(ring.size());
+    ring.publish(0, slice0);
+    ring.publish(1, slice1);
+
+    // Change one byte in block 1 and the last byte (partial final block).
+    ring.data()[block + 3] = std::byte{1};
+    ring.data().back() = std::byte{2};
+    ring.mark_dirty(block + 3, 1);
+    ring.mark_dirty(ring.size() - 1, 1);
+    std::size_t copied = ring.publish(0, slice0);
+    tz_assert(copied == block + 10, "Expected to copy one full block and the final partial block (%zu bytes), copied %zu", block + 10, copied);
+    tz_assert(slice_matches(ring, slice0), "Slice 0 does not match after publishing changes");
+
+    // Slice 1 missed that change. Another write happens before it's published, so it needs both.
+    ring.data()[block * 2] = std::byte{3};
+    ring.mark_dirty(block * 2, 1);
+    copied = ring.publish(1, slice1);
+    tz_assert(copied == block * 2 + 10, "Expected slice 1 to receive both rounds of changes (%zu bytes), copied %zu", block * 2 + 10, copied);
+    tz_assert(slice_matches(ring, slice1), "Slice 1 does not match after catching up");
+
+    // Slice 0 only needs the second round.
+    copied = ring.publish(0, slice0);
+    tz_assert(copied == block, "Expected slice 0 to only receive the second change (%zu bytes), copied %zu", block, copied);
+    tz_assert(slice_matches(ring, slice0), "Slice 0 does not match after catching up");
+}
+
+void detected_changes_copied()
+{
+    constexpr std::size_t block = tz::gl::RendererFrameRing::block_size;
+    std::vector<std::byte> initial(block * 4);
+    tz::gl::RendererFrameRing ring{initial, 1};
+    std::vector<std::byte> slice(ring.size());
+    // Nothing has been compared yet, so the first detection assumes everything changed.
+    ring.detect_changes(0, ring.size());
+    ring.publish(0, slice);
+
+    ring.data()[block * 3 + 5] = std::byte{9};
+    ring.detect_changes(0, ring.size());
+    tz::gl::DirtyRangeList copied_ranges;
+    std::size_t copied = ring.publish(0, slice, &copied_ranges);
+    tz_assert(copied == block, "Expected only the changed block to be copied (%zu bytes), copied %zu", block, copied);
+    tz_assert((copied_ranges.get_ranges().size() == 1 && copied_ranges.get_ranges().front() == tz::gl::DirtyRange{.offset = block * 3, .length = block}), "Copied ranges did not describe the changed block");
+    tz_assert(slice_matches(ring, slice), "Slice does not match after detecting changes");
+}
+
+void host_memory_survives_move()
+{
+    std::vector<std::byte> initial(64);
+    tz::gl::RendererFrameRing ring{initial, 1};
+    std::byte* host = ring.data().data();
+    tz::gl::RendererFrameRing moved = std::move(ring);
+    tz_assert(moved.data().data() == host, "RendererFrameRing host memory moved. Inputs would be left with a dangling pointer.");
+}
+
+int main()
+{
+    first_publish_copies_everything();
+    only_dirty_blocks_copied();
+    detected_changes_copied();
+    host_memory_survives_move();
+}
@@ -0,0 +1,70 @@
+#include "core/assert.hpp"
+#include "gl/impl/frontend/common/geometry_arena.hpp"
+
+void allocations_respect_alignment()
+{
+    tz::gl::ArenaAllocator arena{100};
+    std::optional<tz::gl::ArenaRange> a = arena.allocate(7);
+    std::optional<tz::gl::ArenaRange> b = arena.allocate(12, 12);
+    tz_assert(a.has_value() && b.has_value(), "ArenaAllocator failed to allocate from an almost-empty arena");
+    tz_assert(a->offset == 0, "First allocation should be at the beginning of the arena, but was at %zu", a->offset);
+    tz_assert(b->offset == 12, "Allocation with non-power-of-two alignment 12 should be at offset 12, but was at %zu", b->offset);
+    // The padding between the two allocations is still usable.
+    std::optional<tz::gl::ArenaRange> c = arena.allocate(5);
+    tz_assert((c.has_value() && c->offset == 7), "Expected padding left by alignment to be reused");
+    tz_assert(arena.get_free_bytes() == 100 - 7 - 12 - 5, "Wrong number of free bytes. Expected %zu, got %zu", std::size_t{100 - 7 - 12 - 5}, arena.get_free_bytes());
+    tz_assert(!arena.allocate(1000).has_value(), "ArenaAllocator allocated more bytes than it has");
+}
+
+void freeing_coalesces()
+{
+    tz::gl::ArenaAllocator arena{64};
+    tz::gl::ArenaRange a = arena.allocate(16).value();
+    tz::gl::ArenaRange b = arena.allocate(16).value();
+    tz::gl::ArenaRange c = arena.allocate(16).value();
+    tz::gl::ArenaRange d = arena.allocate(16).value();
+    tz_assert(arena.get_free_ranges().empty(), "Arena should be full");
+    arena.free(a);
+    arena.free(c);
+    tz_assert(arena.get_free_ranges().size() == 2, "Expected two separate free ranges, got %zu", arena.get_free_ranges().size());
+    // b joins a and c together.
+    arena.free(b);
+    tz_assert(arena.get_free_ranges().size() == 1, "Freeing the range between two free ranges should coalesce them");
+    tz_assert((arena.get_free_ranges().front() == tz::gl::ArenaRange{.offset = 0, .length = 48}), "Coalesced range is wrong");
+    arena.free(d);
+    tz_assert((arena.get_free_ranges().size() == 1 && arena.get_free_ranges().front() == tz::gl::ArenaRange{.offset = 0, .length = 64}), "Freeing everything should leave a single range covering the whole arena");
+}
+
+void geometry_shares_pages()
+{
+    constexpr std::size_t vertex_page_size = 1024;
+    constexpr std::size_t index_page_size = 256;
+    tz::gl::GeometryArenaAllocator arena{vertex_page_size, index_page_size};
+    tz::gl::GeometryArenaAllocation a = arena.allocate(100, 20, 64);
+    tz::gl::GeometryArenaAllocation b = arena.allocate(120, 24, 64);
+    tz_assert(arena.get_page_count() == 1, "Expected both allocations to share a page, but there are %zu pages", arena.get_page_count());
+    tz_assert(a.page_id == b.page_id, "Expected both allocations to share a page");
+    tz_assert(b.vertices.offset % 24 == 0, "Vertices must begin on a whole vertex");
+    tz_assert(b.get_base_vertex() * 24 == b.vertices.offset, "Base vertex doesn't match the vertex offset");
+    tz_assert(b.get_base_index() == 16, "Expected base index 16, got %zu", b.get_base_index());
+
+    // Doesn't fit in the first page's index buffer, so a new page is needed.
+    tz::gl::GeometryArenaAllocation c = arena.allocate(100, 20, 200);
+    tz_assert(c.page_id == 1 && arena.get_page_count() == 2, "Expected a second page to be created");
+    // Bigger than a page, so gets a page of its own.
+    tz::gl::GeometryArenaAllocation d = arena.allocate(vertex_page_size * 2, 4, 4);
+    tz_assert(d.page_id == 2, "Expected an oversized page to be created");
+    tz_assert(arena.get_vertex_page_capacity(2) == vertex_page_size * 2, "Oversized page has the wrong capacity");
+
+    // Freed space is reused before making new pages.
+    arena.free(a);
+    tz::gl::GeometryArenaAllocation e = arena.allocate(100, 20, 64);
+    tz_assert(e.page_id == 0 && arena.get_page_count() == 3, "Expected freed space in the first page to be reused");
+}
+
+int main()
+{
+    allocations_respect_alignment();
+    freeing_coalesces();
+    geometry_shares_pages();
+}
@@ -0,0 +1,44 @@
+#include "core/assert.hpp"
+#include "gl/impl/frontend/common/gpu_timings.hpp"
+
+void empty_history_has_no_samples()
+{
+    tz::gl::GPUTimingHistory history;
+    tz_assert(history.get_stats().sample_count == 0, "Empty GPUTimingHistory should have no samples, but has %zu", history.get_stats().sample_count);
+}
+
+void stats_cover_all_samples()
+{
+    tz::gl::GPUTimingHistory history{8};
+    history.add(2.0f);
+    history.add(1.0f);
+    history.add(6.0f);
+    tz::gl::RendererGPUTimingStats stats = history.get_stats();
+    tz_assert(stats.sample_count == 3, "Expected 3 samples, got %zu", stats.sample_count);
+    tz_assert(stats.average_ms == 3.0f, "Expected average of 3ms, got %.2fms", stats.average_ms);
+    tz_assert(stats.min_ms == 1.0f, "Expected min of 1ms, got %.2fms", stats.min_ms);
+    tz_assert(stats.max_ms == 6.0f, "Expected max of 6ms, got %.2fms", stats.max_ms);
+}
+
+void oldest_samples_forgotten()
+{
+    tz::gl::GPUTimingHistory history{2};
+    history.add(10.0f);
+    history.add(1.0f);
+    // Replaces the 10ms sample.
+    history.add(3.0f);
+    tz::gl::RendererGPUTimingStats stats = history.get_stats();
+    tz_assert(stats.sample_count == 2, "History should be capped at 2 samples, but has %zu", stats.sample_count);
+    tz_assert(stats.max_ms == 3.0f, "Oldest sample should have been forgotten. Expected max of 3ms, got %.2fms", stats.max_ms);
+    // Replaces the 1ms sample.
+    history.add(5.0f);
+    stats = history.get_stats();
+    tz_assert(stats.min_ms == 3.0f && stats.max_ms == 5.0f, "Expected samples {3ms, 5ms}, got min %.2fms max %.2fms", stats.min_ms, stats.max_ms);
+}
+
+int main()
+{
+    empty_history_has_no_samples();
+    stats_cover_all_samples();
+    oldest_samples_forgotten();
+}
@@ -20,8 +20,8 @@ int main()
         tz::gl::RenderPass render_pass = device.create_render_pass(pass_builder);
 
         tz::gl::ShaderBuilder shader_builder;
-        shader_builder.set_shader_file(tz::gl::ShaderType::VertexShader, ".\\test\\gl\\triangle_test.vertex.tzsl");
-        shader_builder.set_shader_file(tz::gl::ShaderType::FragmentShader, ".\\test\\gl\\triangle_test.fragment.tzsl");
+        shader_builder.set_shader_file(tz::gl::ShaderType::VertexShader, "./test/gl/triangle_test.vertex.tzsl");
+        shader_builder.set_shader_file(tz::gl::ShaderType::FragmentShader, "./test/gl/triangle_test.fragment.tzsl");
 
         tz::gl::Shader shader = device.create_shader(shader_builder);
 
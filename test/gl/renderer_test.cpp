@@ -1,4 +1,5 @@
 #include "core/tz.hpp"
+#include "core/report.hpp"
 #include "gl/device.hpp"
 #include "gl/renderer.hpp"
 
@@ -15,8 +16,8 @@ int main()
         tz::gl::RenderPass render_pass = device.create_render_pass(pass_builder);
 
         tz::gl::ShaderBuilder builder;
-        builder.set_shader_file(tz::gl::ShaderType::VertexShader, ".\\test\\gl\\shader_test.vertex.glsl");
-        builder.set_shader_file(tz::gl::ShaderType::FragmentShader, ".\\test\\gl\\shader_test.fragment.glsl");
+        builder.set_shader_file(tz::gl::ShaderType::VertexShader, "./test/gl/shader_test.vertex.glsl");
+        builder.set_shader_file(tz::gl::ShaderType::FragmentShader, "./test/gl/shader_test.fragment.glsl");
         tz::gl::Shader shader = device.create_shader(builder);
 
         std::array<int, 5> values{1, 2, 3, 4, 5};
@@ -63,6 +64,15 @@ int main()
             tz::window().update();
             renderer.render();
         }
+        // GPU timings lag behind and may not be supported at all, but they should never describe frames that didn't happen.
+        tz::gl::RendererGPUTimings timings = renderer.get_gpu_timings();
+        tz_assert(timings.render_pass.sample_count <= frame_number, "Renderer has GPU timings for %zu frames, but only %zu were rendered", timings.render_pass.sample_count, frame_number);
+        tz_assert(timings.draws.sample_count == timings.render_pass.sample_count, "Renderer has GPU timings for %zu render passes but %zu sets of draws", timings.render_pass.sample_count, timings.draws.sample_count);
+        if(timings.render_pass.sample_count > 0)
+        {
+            tz_assert(timings.render_pass.min_ms <= timings.render_pass.average_ms && timings.render_pass.average_ms <= timings.render_pass.max_ms, "Renderer GPU timings are inconsistent. min %.3fms, average %.3fms, max %.3fms", timings.render_pass.min_ms, timings.render_pass.average_ms, timings.render_pass.max_ms);
+        }
+        tz_report("GPU render pass: %zu samples, average %.3fms", timings.render_pass.sample_count, timings.render_pass.average_ms);
     }
     tz::terminate();
 }
\ No newline at end of file
@@ -10,8 +10,8 @@ int main()
         tz::gl::Device device{tz::gl::DeviceBuilder{}};
 
         tz::gl::ShaderBuilder builder;
-        builder.set_shader_file(tz::gl::ShaderType::VertexShader, ".\\test\\gl\\shader_test.vertex.glsl");
-        builder.set_shader_file(tz::gl::ShaderType::FragmentShader, ".\\test\\gl\\shader_test.fragment.glsl");
+        builder.set_shader_file(tz::gl::ShaderType::VertexShader, "./test/gl/shader_test.vertex.glsl");
+        builder.set_shader_file(tz::gl::ShaderType::FragmentShader, "./test/gl/shader_test.fragment.glsl");
         tz::gl::Shader shader = device.create_shader(builder);
     }
     tz::terminate();
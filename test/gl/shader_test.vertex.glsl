@@ -1,6 +1,12 @@
 #version 450
 #pragma shader_stage(vertex)
+// gl_VertexIndex is Vulkan-only. This shader is also compiled as-is by OpenGL, which spells it gl_VertexID.
+#ifdef VULKAN
 #extension GL_KHR_vulkan_glsl : enable
+#define vertex_index gl_VertexIndex
+#else
+#define vertex_index gl_VertexID
+#endif
 
 vec2 positions[3] = vec2[](
     vec2(0.0, -0.5),
@@ -10,5 +16,5 @@ vec2 positions[3] = vec2[](
 
 void main()
 {
-    gl_Position = vec4(positions[gl_VertexIndex], 0.0, 1.0);
+    gl_Position = vec4(positions[vertex_index], 0.0, 1.0);
 }
\ No newline at end of file